@@ -34,6 +34,10 @@
 #if !defined(OPENSSL_SYS_MSDOS)
 #include OPENSSL_UNISTD
 #endif
+#if defined(OPENSSL_THREADS) && !defined(OPENSSL_SYS_WINDOWS) && !defined(OPENSSL_SYS_NETWARE) && !defined(OPENSSL_SYS_VMS)
+#define S_TIME_THREADS
+#include <pthread.h>
+#endif
 
 #undef PROG
 #define PROG s_time_main
@@ -57,17 +61,64 @@
 
 #undef SECONDS
 #define SECONDS	10
+
+#define MAX_THREADS	256
+
+/* Latency histogram, HdrHistogram style: values are recorded in
+ * microseconds, exactly below ST_HIST_SUB and in ST_HIST_HALF linear
+ * sub-buckets per power of two above it (relative error below 1%). */
+#define ST_HIST_SUB_BITS	7
+#define ST_HIST_SUB		(1 << ST_HIST_SUB_BITS)
+#define ST_HIST_HALF		(ST_HIST_SUB / 2)
+#define ST_HIST_MAGS		40
+#define ST_HIST_BUCKETS		(ST_HIST_SUB + ST_HIST_MAGS * ST_HIST_HALF)
+
+typedef struct s_time_hist_st
+	{
+	unsigned long counts[ST_HIST_BUCKETS];
+	unsigned long total;
+	unsigned long long max;	/* microseconds */
+	double sum;		/* microseconds */
+	} S_TIME_HIST;
+
+/* Everything one connection loop touches, so that -threads can run
+ * several loops side by side against the same SSL_CTX. */
+typedef struct s_time_worker_st
+	{
+	int id;
+	char *proto;                           // Protocol of choice (ssl; spp; pln)
+	int slices_len;                        // Number of slices (spp)
+	int r;                                 // Number of proxies with read access (spp)
+	int w;                                 // Number of proxies with write access (spp)
+	int N_proxies;                         // Number of proxies
+	char **proxies_address;                // Address of each proxy
+	char **purposes;                       // Purpose of each slice
+	int mySoc;                             // Socket of a pln connection
+	long bytes_read;
+	long nConn;                            // Completed connections
+	long nFail;                            // Failed connections (open loop)
+	long nLate;                            // Arrivals started behind schedule
+	double first_byte;                     // When the first response byte arrived
+	S_TIME_HIST handshake;                 // Arrival to handshake done
+	S_TIME_HIST ttfb;                      // Arrival to first response byte
+	char buf[MYBUFSIZ];
+#ifdef S_TIME_THREADS
+	pthread_t thread;
+#endif
+	} S_TIME_WORKER;
+
 extern int verify_depth;
 extern int verify_error;
 
 static void s_time_usage(void);
 static int parseArgs( int argc, char **argv );
-static SSL *doConnection( SSL *scon, char *proto );
+static SSL *doConnection( S_TIME_WORKER *wk, SSL *scon );
 static void s_time_init(void);
 static int read_proxy_list(char *, char ** ); 
 static int check_SSL_write_error( SSL *, int, int );
-static void slices_management( SSL *, SPP_SLICE **, SPP_PROXY ** ); 
-static int send_GET_request( SSL * ); 
+static void slices_management( S_TIME_WORKER *, SSL *, SPP_SLICE **, SPP_PROXY ** ); 
+static int send_GET_request( S_TIME_WORKER *, SSL * ); 
+static int wait_GET_response( S_TIME_WORKER *, SSL * ); 
 int tcp_connect(char *host, int port);
 
 
@@ -87,7 +138,6 @@ static int maxTime = SECONDS;
 static SSL_CTX *tm_ctx = NULL;
 static const SSL_METHOD *s_time_meth = NULL;
 static char *s_www_path = NULL;
-static long bytes_read = 0; 
 static int st_bugs = 0;
 static int perform = 0;
 #ifdef FIONBIO
@@ -96,6 +146,7 @@ static int t_nbio = 0;
 #ifdef OPENSSL_SYS_WIN32
 static int exitNow = 0;                    // Set when it's time to exit main
 #endif
+// Connection setup as parsed; worker_init() copies it into each worker
 static int slices_len = 0;                 // Number of slices (spp) 
 static int r = 0;                          // Number of proxies with read access (spp)
 static int w = 0;                          // Number of proxies with write access (spp)
@@ -104,7 +155,15 @@ static int N_proxies = 0;                  // number of proxies indicated
 static char *filename = "proxyList";       // filename for proxy
 static char **proxies_address;             // array of address for proxies
 static bool reuse = false;                 // SSL session caching 
-static int mySoc = NULL;
+static int n_threads = 0;                  // Number of workers (0 = legacy single loop)
+static double target_rate = 0.0;           // Open loop arrival rate (connections/sec)
+static char *hdr_file = NULL;              // Prefix of the .hgrm histogram dumps
+static double sched_next = 0.0;            // Scheduled start of the next arrival
+static double sched_end = 0.0;             // No arrivals are scheduled past this
+#ifdef S_TIME_THREADS
+static pthread_mutex_t sched_lock = PTHREAD_MUTEX_INITIALIZER;
+static int lock_stats = 0;                 // Count waits per library lock
+#endif
 
 static void s_time_init(void)
 	{
@@ -119,9 +178,11 @@ static void s_time_init(void)
 	tm_ctx=NULL;
 	s_time_meth=NULL;
 	s_www_path=NULL;
-	bytes_read=0; 
 	st_bugs=0;
 	perform=0;
+	n_threads=0;
+	target_rate=0.0;
+	hdr_file=NULL;
 
 #ifdef FIONBIO
 	t_nbio=0;
@@ -163,6 +224,14 @@ static void s_time_usage(void){
 	printf("-proxies      - Number of proxies\n"); 
     printf("-read         - Number of proxies with read access (per slice)\n"); 
     printf("-write        - Number of proxies with write access (per slice)\n");
+	printf("--------------------------------\n");
+#ifdef S_TIME_THREADS
+	printf("-threads n    - Run n connection loops in parallel\n");
+	printf("-lockstats    - With -threads, list the library locks waited for\n");
+#endif
+	printf("-rate n       - Open loop: start n connections/sec regardless of\n");
+	printf("                completions, latency measured from the scheduled start\n");
+	printf("-hdr prefix   - Dump latency distributions to prefix.{handshake,ttfb}.hgrm\n");
 #endif
 	printf( umsg,SECONDS );
 }
@@ -307,6 +376,37 @@ static int parseArgs(int argc, char **argv){
 	    w = atoi(*(++argv));
 	}
 
+#ifdef S_TIME_THREADS
+	// number of parallel connection loops
+	else if( strcmp(*argv,"-threads") == 0) {
+	    if (--argc < 1) goto bad;
+	    n_threads = atoi(*(++argv));
+	    if (n_threads < 1 || n_threads > MAX_THREADS) {
+		BIO_printf(bio_err, "-threads must be between 1 and %d\n", MAX_THREADS);
+		goto bad;
+	    }
+	}
+	else if( strcmp(*argv,"-lockstats") == 0) {
+	    lock_stats = 1;
+	}
+#endif
+
+	// open loop arrival rate
+	else if( strcmp(*argv,"-rate") == 0) {
+	    if (--argc < 1) goto bad;
+	    target_rate = atof(*(++argv));
+	    if (target_rate <= 0) {
+		BIO_printf(bio_err, "-rate must be positive\n");
+		goto bad;
+	    }
+	}
+
+	// latency histogram dump
+	else if( strcmp(*argv,"-hdr") == 0) {
+	    if (--argc < 1) goto bad;
+	    hdr_file = *(++argv);
+	}
+
 	else {
 	    BIO_printf(bio_err,"unknown option %s\n",*argv);
 	    badop=1;
@@ -344,6 +444,177 @@ static double tm_Time_F(int s){
 	return app_tminterval(s, 1);   //defined in [2833, /apps/appsc]
 }
 
+/***********************************************************************
+ * Wall clock time in seconds, for latencies and the arrival schedule
+ */
+static double st_now(void){
+#ifdef CLOCK_MONOTONIC
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+#else
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec + tv.tv_usec / 1e6;
+#endif
+}
+
+static void st_sleep(double secs){
+	struct timeval tv;
+
+	tv.tv_sec = (long)secs;
+	tv.tv_usec = (long)((secs - tv.tv_sec) * 1e6);
+	select(0, NULL, NULL, NULL, &tv);
+}
+
+/***********************************************************************
+ * Latency histograms
+ */
+static int hist_index(unsigned long long v){
+	int shift = 0;
+
+	if (v < ST_HIST_SUB)
+		return (int)v;
+	// bring v into [ST_HIST_HALF, ST_HIST_SUB)
+	while ((v >> shift) >= ST_HIST_SUB)
+		shift++;
+	if (shift > ST_HIST_MAGS)
+		return ST_HIST_BUCKETS - 1;
+	return ST_HIST_SUB + (shift - 1) * ST_HIST_HALF + (int)(v >> shift) - ST_HIST_HALF;
+}
+
+// Highest value (microseconds) that lands in bucket i
+static unsigned long long hist_value(int i){
+	int shift;
+	unsigned long long sub;
+
+	if (i < ST_HIST_SUB)
+		return i;
+	shift = (i - ST_HIST_SUB) / ST_HIST_HALF + 1;
+	sub = (i - ST_HIST_SUB) % ST_HIST_HALF + ST_HIST_HALF;
+	return ((sub + 1) << shift) - 1;
+}
+
+static void hist_record(S_TIME_HIST *h, double secs){
+	unsigned long long v = secs > 0 ? (unsigned long long)(secs * 1e6) : 0;
+
+	h->counts[hist_index(v)]++;
+	h->total++;
+	h->sum += v;
+	if (v > h->max)
+		h->max = v;
+}
+
+static void hist_add(S_TIME_HIST *to, const S_TIME_HIST *from){
+	int i;
+
+	for (i = 0; i < ST_HIST_BUCKETS; i++)
+		to->counts[i] += from->counts[i];
+	to->total += from->total;
+	to->sum += from->sum;
+	if (from->max > to->max)
+		to->max = from->max;
+}
+
+// Value (milliseconds) at percentile q (0..1)
+static double hist_percentile(const S_TIME_HIST *h, double q){
+	unsigned long want, seen = 0;
+	int i;
+
+	if (h->total == 0)
+		return 0.0;
+	want = (unsigned long)(q * h->total + 0.5);
+	if (want < 1)
+		want = 1;
+	for (i = 0; i < ST_HIST_BUCKETS; i++) {
+		seen += h->counts[i];
+		if (seen >= want)
+			return min(hist_value(i), h->max) / 1e3;
+	}
+	return h->max / 1e3;
+}
+
+static void hist_print_summary(const char *what, const S_TIME_HIST *h){
+	if (h->total == 0)
+		return;
+	printf("%s latency (ms): p50=%.3f p99=%.3f p999=%.3f max=%.3f mean=%.3f n=%lu\n",
+		what, hist_percentile(h, 0.5), hist_percentile(h, 0.99),
+		hist_percentile(h, 0.999), h->max / 1e3, h->sum / h->total / 1e3, h->total);
+}
+
+/***********************************************************************
+ * Dump a histogram in HdrHistogram's percentile distribution format
+ * (values in milliseconds, 5 reporting ticks per half distance), which
+ * the HdrHistogram plotters read as is.
+ */
+static int hist_dump(const char *prefix, const char *what, const S_TIME_HIST *h){
+	char name[1024];
+	FILE *fp;
+	unsigned long seen = 0;
+	double pct = 0.0, half;
+	int i;
+
+	if (h->total == 0)
+		return 0;
+	BIO_snprintf(name, sizeof name, "%s.%s.hgrm", prefix, what);
+	if ((fp = fopen(name, "w")) == NULL) {
+		BIO_printf(bio_err, "Error while opening file %s\n", name);
+		return -1;
+	}
+	fprintf(fp, "%12s %14s %10s %14s\n\n", "Value", "Percentile", "TotalCount", "1/(1-Percentile)");
+	for (i = 0; i < ST_HIST_BUCKETS && seen < h->total; i++) {
+		if (h->counts[i] == 0)
+			continue;
+		seen += h->counts[i];
+		while (seen < h->total && (double)seen >= pct * h->total) {
+			fprintf(fp, "%12.3f %2.12f %10lu %14.2f\n",
+				min(hist_value(i), h->max) / 1e3, pct, seen, 1.0 / (1.0 - pct));
+			// halve the remaining distance every 5 ticks
+			for (half = 1.0; half <= 1.0 / (1.0 - pct); half *= 2)
+				;
+			pct += 1.0 / (half * 5);
+		}
+	}
+	fprintf(fp, "%12.3f %2.12f %10lu\n", h->max / 1e3, 1.0, h->total);
+	fprintf(fp, "#[Mean    = %12.3f, Max            = %12.3f]\n", h->sum / h->total / 1e3, h->max / 1e3);
+	fprintf(fp, "#[Count   = %12lu, SubBuckets     = %12d]\n", h->total, ST_HIST_SUB);
+	fclose(fp);
+	return 0;
+}
+
+/***********************************************************************
+ * Open loop arrival schedule: arrivals are spaced 1/target_rate apart
+ * from the start of the run no matter how long earlier connections take,
+ * and each connection's latency is measured from its scheduled start, so
+ * that queueing behind a slow server shows up in the percentiles instead
+ * of silently lowering the offered load. Without -rate each worker starts
+ * its next connection as soon as the previous one is done (closed loop).
+ * Returns 0 once the test time is up; arrivals still queued then are
+ * never started and left in the schedule for the report.
+ */
+static int next_arrival(double *when){
+	double now = st_now();
+	int ok;
+
+	if (target_rate <= 0) {
+		*when = now;
+		return now < sched_end;
+	}
+#ifdef S_TIME_THREADS
+	pthread_mutex_lock(&sched_lock);
+#endif
+	*when = sched_next;
+	ok = *when < sched_end && now < sched_end;
+	if (ok)
+		sched_next += 1.0 / target_rate;
+#ifdef S_TIME_THREADS
+	pthread_mutex_unlock(&sched_lock);
+#endif
+	return ok;
+}
+
 /***********************************************************************
  * Read counter of number of proxies in the provided list 
  */	
@@ -408,7 +679,7 @@ int read_proxy_list(char *file_name, char **proxies_address){
 
 		// Generate a proxy from IP address just read 
 		char *newLine;  
-		newLine = (char *)malloc(strlen(line));    
+		newLine = (char *)malloc(strlen(line) + 1);    
 		strcpy(newLine, line);
 		proxies_address[count] = newLine;
 		
@@ -463,20 +734,15 @@ int check_SSL_write_error(SSL *ssl, int r, int request_len){
  * Create slices and assign read and write rights to proxies 
  */	
 
-void slices_management(SSL *ssl, SPP_SLICE **slice_set, SPP_PROXY ** proxies){
+void slices_management(S_TIME_WORKER *wk, SSL *ssl, SPP_SLICE **slice_set, SPP_PROXY ** proxies){
 
 	// Create slices_n slices with incremental purpose 
 	int i; 
 	#ifdef DEBUG
-	printf("[DEBUG] Generating %d slices\n", slices_len); 
+	printf("[DEBUG] Generating %d slices\n", wk->slices_len); 
 	#endif
-	for (i = 0;  i < slices_len; i++){
-		char *newPurpose;  
-		char str[30]; 
-		sprintf (str, "slices_%d", i); 
-		newPurpose = (char *)malloc(strlen(str));    
-		strcpy(newPurpose, str);
-		slice_set[i] = SPP_generate_slice(ssl, newPurpose); 
+	for (i = 0;  i < wk->slices_len; i++){
+		slice_set[i] = SPP_generate_slice(ssl, wk->purposes[i]); 
 		#ifdef DEBUG
 		printf("[DEBUG] Generated slices %d with purpose %s\n", slice_set[i]->slice_id, slice_set[i]->purpose); 
 		#endif
@@ -484,13 +750,13 @@ void slices_management(SSL *ssl, SPP_SLICE **slice_set, SPP_PROXY ** proxies){
 
 	// Assign write access to proxies for all slices 
 	// Find MAX between r and w
-	int MAX = max(w, r);
+	int MAX = max(wk->w, wk->r);
 	
 	// Iterate among proxies
 	for (i = 0; i < MAX ; i++){
 		// assign read access if requested
-		if (i < r){
-			if (SPP_assign_proxy_read_slices(ssl, proxies[i], slice_set, slices_len) == 1 ) {
+		if (i < wk->r){
+			if (SPP_assign_proxy_read_slices(ssl, proxies[i], slice_set, wk->slices_len) == 1 ) {
 				#ifdef DEBUG
 				printf ("[DEBUG] Proxy %s assigned read access to slice-set (READ_COUNT=%d)\n", proxies[i]->address, (i + 1)); 
 				#endif
@@ -498,8 +764,8 @@ void slices_management(SSL *ssl, SPP_SLICE **slice_set, SPP_PROXY ** proxies){
 		}
 
 		// assign write access if requested
-		if (i < w){
-			if (SPP_assign_proxy_write_slices(ssl, proxies[i], slice_set, slices_len) == 1 ) {
+		if (i < wk->w){
+			if (SPP_assign_proxy_write_slices(ssl, proxies[i], slice_set, wk->slices_len) == 1 ) {
 				#ifdef DEBUG
 				printf ("[DEBUG] Proxy %s assigned write access to slice-set (WRITE COUNT=%d)\n", proxies[i]->address, (i + 1)); 
 				#endif
@@ -511,9 +777,9 @@ void slices_management(SSL *ssl, SPP_SLICE **slice_set, SPP_PROXY ** proxies){
 /***********************************************************************
  * Send a GET request (ssl and spp)
  */
-int send_GET_request(SSL *scon){
+int send_GET_request(S_TIME_WORKER *wk, SSL *scon){
 
-		MS_STATIC char buf[1024*8];   //Buffer allocation 
+		char *buf = wk->buf;
 		int i; 
 		
 		// Logging 
@@ -522,11 +788,11 @@ int send_GET_request(SSL *scon){
 		#endif 
 
 		// Form HTTP GET request 
-		BIO_snprintf(buf, sizeof buf, "GET %s HTTP/1.0\r\n\r\n", s_www_path);
+		BIO_snprintf(buf, MYBUFSIZ, "GET %s HTTP/1.0\r\n\r\n", s_www_path);
 		int request_len = strlen(buf); 
 			
 		// Send HTTP GET request (SPP) 
-		if (strcmp(proto, "spp") == 0){	
+		if (strcmp(wk->proto, "spp") == 0){	
 			for (i = 0; i < scon->slices_len; i++){
 				// currently writing same record -- differentiate per record in the future 
 				int r = SPP_write_record(scon, buf, request_len, scon->slices[i]);
@@ -537,7 +803,7 @@ int send_GET_request(SSL *scon){
 		}
 			
 		// Send HTTP GET request (SSL) 
-		if (strcmp(proto, "ssl") == 0){
+		if (strcmp(wk->proto, "ssl") == 0){
 			#ifdef DEBUG
 			printf("[DEBUG] Sending GET request %s\n", buf); 
 			#endif 
@@ -547,11 +813,11 @@ int send_GET_request(SSL *scon){
 			}
 		}
 				// Send HTTP GET request (SSL) 
-		if (strcmp(proto, "pln") == 0){
+		if (strcmp(wk->proto, "pln") == 0){
 			#ifdef DEBUG
 			printf("[DEBUG] Sending GET request (plain) %s\n", buf); 
 			#endif 
-			int r = write(scon, buf, request_len);
+			int r = write(wk->mySoc, buf, request_len);
 			if (r < 0){
 				return -1; 
 			}
@@ -564,45 +830,51 @@ int send_GET_request(SSL *scon){
 /***********************************************************************
  * Wait GET response (ssl and spp)
  */
-int wait_GET_response(SSL* scon){
+int wait_GET_response(S_TIME_WORKER *wk, SSL* scon){
 
-	MS_STATIC char buf[1024*8];   //Buffer allocation 
+	char *buf = wk->buf;
 	int i = 0; 
 
 	// Wait for HTTP response (SPP)
-	if (strcmp(proto, "spp") == 0){				
+	if (strcmp(wk->proto, "spp") == 0){				
 		SPP_SLICE *slice;    // slice for SPP_read
 		SPP_CTX *ctx;        // context pointer for SPP_read
 		
 		// check error for SSP_read_record
-		while ((i = SPP_read_record(scon, buf, sizeof(buf), &slice, &ctx)) > 0){
-			bytes_read += i;
+		while ((i = SPP_read_record(scon, buf, MYBUFSIZ, &slice, &ctx)) > 0){
+			if (wk->first_byte == 0)
+				wk->first_byte = st_now();
+			wk->bytes_read += i;
 			#ifdef DEBUG
 			//printf("%s", buf); 
-			printf("[DEBUG] GET response received (size=%lu)\n", bytes_read); 
+			printf("[DEBUG] GET response received (size=%lu)\n", wk->bytes_read); 
 			#endif 
 		}
 	}
 	
 	// Wait for HTTP response (SSL)
-	if (strcmp(proto, "ssl") == 0){
+	if (strcmp(wk->proto, "ssl") == 0){
 		// check error for SSP_read_record
-		while ((i = SSL_read(scon, buf, sizeof(buf))) > 0){
-			bytes_read += i;
+		while ((i = SSL_read(scon, buf, MYBUFSIZ)) > 0){
+			if (wk->first_byte == 0)
+				wk->first_byte = st_now();
+			wk->bytes_read += i;
 			#ifdef DEBUG
 			//printf("%s", buf); 
-			printf("[DEBUG] GET response received (size=%lu)\n", bytes_read); 
+			printf("[DEBUG] GET response received (size=%lu)\n", wk->bytes_read); 
 			#endif 
 		}
 	}
 		// Wait for HTTP response (pln)
-	if (strcmp(proto, "pln") == 0){
+	if (strcmp(wk->proto, "pln") == 0){
 		// check error for SSP_read_record
-		while ((i = read(scon, buf, sizeof(buf))) > 0){
-			bytes_read += i;
+		while ((i = read(wk->mySoc, buf, MYBUFSIZ)) > 0){
+			if (wk->first_byte == 0)
+				wk->first_byte = st_now();
+			wk->bytes_read += i;
 			#ifdef DEBUG
 			//printf("%s", buf); 
-			printf("[DEBUG] GET response received (size=%lu)\n", bytes_read); 
+			printf("[DEBUG] GET response received (size=%lu)\n", wk->bytes_read); 
 			#endif 
 		}
 	}
@@ -611,6 +883,145 @@ int wait_GET_response(SSL* scon){
 	return 0; 
 }
 
+/***********************************************************************
+ * Per worker state: private copies of the slice/proxy setup
+ */
+static int worker_init(S_TIME_WORKER *wk, int id){
+	int i;
+
+	memset(wk, 0, sizeof(*wk));
+	wk->id = id;
+	wk->proto = proto;
+	wk->slices_len = slices_len;
+	wk->r = r;
+	wk->w = w;
+	wk->N_proxies = N_proxies;
+	wk->mySoc = -1;
+	wk->proxies_address = OPENSSL_malloc((N_proxies + 1) * sizeof(char *));
+	wk->purposes = OPENSSL_malloc((slices_len + 1) * sizeof(char *));
+	if (wk->proxies_address == NULL || wk->purposes == NULL)
+		return -1;
+	for (i = 0; i < N_proxies; i++)
+		wk->proxies_address[i] = proxies_address[i];
+	for (i = 0; i < slices_len; i++){
+		if ((wk->purposes[i] = OPENSSL_malloc(32)) == NULL){
+			wk->slices_len = i;
+			return -1;
+		}
+		BIO_snprintf(wk->purposes[i], 32, "slices_%d", i);
+	}
+	return 0;
+}
+
+static void worker_cleanup(S_TIME_WORKER *wk){
+	int i;
+
+	if (wk->purposes != NULL){
+		for (i = 0; i < wk->slices_len; i++)
+			OPENSSL_free(wk->purposes[i]);
+		OPENSSL_free(wk->purposes);
+	}
+	if (wk->proxies_address != NULL)
+		OPENSSL_free(wk->proxies_address);
+}
+
+/***********************************************************************
+ * Connection loop of one worker, until the test time is up
+ */
+static void *worker_run(void *arg){
+	S_TIME_WORKER *wk = arg;
+	SSL *scon = NULL;
+	double sched, start, now;
+	int failed;
+
+	while (next_arrival(&sched)){
+		// Wait for the scheduled start (open loop only)
+		now = st_now();
+		start = now;
+		if (target_rate > 0){
+			if (sched > now)
+				st_sleep(sched - now);
+			else if (now - sched > 1.0 / target_rate)
+				wk->nLate++;
+			start = sched;
+		}
+
+		#ifdef DEBUG
+		printf("[DEBUG] Worker %d connection %ld\n", wk->id, wk->nConn); 
+		#endif 
+
+		// Handshake
+		wk->first_byte = 0;
+		failed = 0;
+		if( (scon = doConnection( wk, NULL )) == NULL ){
+			// Under open loop overload is a result, not a reason to stop
+			wk->nFail++;
+			if (target_rate > 0)
+				continue;
+			printf("Error: Could not establish connection\n");
+			break;
+		}
+		hist_record(&wk->handshake, st_now() - start);
+
+		// Ask for a file if indicated in input 
+		if (s_www_path != NULL) {
+			
+			// Send GET request 
+			if (send_GET_request(wk, scon) < 0){
+				printf("Error in sending GET request\n");
+				failed = 1;
+				goto next; 
+			}
+			
+			// Wait for GET response 
+			if (wait_GET_response(wk, scon) < 0){
+				printf("Error in receivign GET response\n");
+				failed = 1;
+				goto next; 
+			}
+			if (wk->first_byte != 0)
+				hist_record(&wk->ttfb, wk->first_byte - start);
+		}
+
+		wk->nConn += 1;
+
+next:
+		if (strcmp(wk->proto, "pln") == 0){	
+			#ifdef DEBUG
+			printf("[DEBUG] Closing %d\n", wk->mySoc);
+			#endif 
+			close(wk->mySoc);
+			wk->mySoc = -1;
+			scon = NULL;
+		} else {
+			// the tls closing does not apply to pln
+#ifdef NO_SHUTDOWN
+			#ifdef DEBUG
+			printf("[DEBUG] NO SSL shutdown\n"); 
+			#endif 
+			SSL_set_shutdown(scon, SSL_SENT_SHUTDOWN|SSL_RECEIVED_SHUTDOWN);
+#else
+			#ifdef DEBUG
+			printf("[DEBUG] SSL shutdown\n"); 
+			#endif 
+			SSL_shutdown(scon);
+#endif
+			SHUTDOWN2(SSL_get_fd(scon));
+			fflush(stdout);
+
+			// Free session 
+			SSL_free(scon);
+			scon = NULL;
+		}
+
+		if (failed){
+			wk->nFail++;
+			if (target_rate <= 0)
+				break;
+		}
+	}
+	return NULL;
+}
 
 /***********************************************************************
  * MAIN - main processing area for client
@@ -621,14 +1032,15 @@ int MAIN(int, char **);
 int MAIN(int argc, char **argv){
 
 	double totalTime = 0.0;
-	int nConn = 0;
-	SSL *scon = NULL;
+	long nConn = 0, nFail = 0, nLate = 0;
+	long bytes_read = 0;
 	long finishtime = 0;
 	int ret = 1, i;
-	MS_STATIC char buf[1024*8];
-	int ver;
 	clock_t start, end;
-	double cpu_time_used;
+	double cpu_time_used, wall;
+	S_TIME_WORKER *workers = NULL;
+	int nWorkers = 0;
+	static S_TIME_HIST handshake, ttfb;
 
 	apps_startup();
 	s_time_init();
@@ -730,135 +1142,88 @@ int MAIN(int argc, char **argv){
 	printf( "[DEBUG] Option=-new Collecting connection statistics for %d seconds\n", maxTime );
 	#endif
 
+	// One worker per thread, or a single one for the classic loop
+	nWorkers = n_threads > 0 ? n_threads : 1;
+	if ((workers = OPENSSL_malloc(nWorkers * sizeof(S_TIME_WORKER))) == NULL){
+		goto end;
+	}
+	for (i = 0; i < nWorkers; i++){
+		if (worker_init(&workers[i], i) < 0){
+			nWorkers = i + 1;
+			goto end;
+		}
+	}
+
 	// Loop and time how long it takes to make connections
-	bytes_read = 0;
 	finishtime = (long) time (NULL) + maxTime;
+	sched_next = wall = st_now();
+	sched_end = sched_next + maxTime;
 	tm_Time_F(START);
 
 	// Successively open and use connections until time expires
 	start = clock();
-	for (;;){
-		// If time is done just break 
-		if (finishtime < (long) time (NULL)){
-			#ifdef DEBUG
-			printf("[DEBUG] Time is up %lu\n", finishtime); 
-			#endif 
-			break;
-		}
-		/*
-		// WIN32 specific stuff
-#ifdef WIN32_STUFF
-		if( flushWinMsgs(0) == -1 ){
+	if (n_threads == 0){
+		worker_run(&workers[0]);
+	}
+#ifdef S_TIME_THREADS
+	else {
+		// The library needs real locks once several workers share tm_ctx
+		if (!CRYPTO_thread_setup_pthreads(lock_stats ? CRYPTO_PTHREADS_LOCK_STATS : 0)){
 			goto end;
 		}
 
-		if( waitingToDie || exitNow ){		
-			goto end;
+		for (i = 0; i < nWorkers; i++){
+			pthread_create(&workers[i].thread, NULL, worker_run, &workers[i]);
 		}
-#endif */
-		// new connection (no re-use) 
-
-		#ifdef DEBUG
-		printf("[DEBUG] Connection %d ", nConn); 
-		#endif 
-		// Handshake
-		if (! reuse){
-			#ifdef DEBUG
-			printf("(new)\n"); 
-			#endif 
-			scon = NULL; 
-		}else{
-			#ifdef DEBUG
-			printf("(reuse)\n"); 
-			#endif 
+		for (i = 0; i < nWorkers; i++){
+			pthread_join(workers[i].thread, NULL);
 		}
 
-
-
-		if( (scon = doConnection( scon, proto )) == NULL ){
-			printf("Error: Could not establish connection\n");
-			goto end;
+		if (lock_stats){
+			CRYPTO_lock_stats_print_fp(stdout);
 		}
-
-		// Ask for a file if indicated in input 
-		if (s_www_path != NULL) {
-			
-			// Send GET request 
-			if (send_GET_request(scon) < 0){
-				printf("Error in sending GET request\n");
-				goto end; 
-			}
-			
-			// Wait for GET response 
-			if (wait_GET_response(scon) < 0){
-				printf("Error in receivign GET response\n");
-				goto end; 
-			}
-		}
-
-		nConn += 1;
-
-		if (strcmp(proto, "pln") == 0){	
-			#ifdef DEBUG
-			printf("[DEBUG] Closing %d\n", scon);
-			#endif 
-			close((int)scon);
-			#ifdef DEBUG
-			printf("[DEBUG] Done %d\n", scon);
-			#endif 
-			scon = NULL;
-			continue; //avoid all the tls closing...
-		}
-
-#ifdef NO_SHUTDOWN
-		#ifdef DEBUG
-		printf("[DEBUG] NO SSL shutdown\n"); 
-		#endif 
-		SSL_set_shutdown(scon, SSL_SENT_SHUTDOWN|SSL_RECEIVED_SHUTDOWN);
-#else
-		#ifdef DEBUG
-		printf("[DEBUG] SSL shutdown\n"); 
-		#endif 
-		SSL_shutdown(scon);
-#endif
-		
-		#ifdef DEBUG
-		printf("[DEBUG] SSL shutdown2 -- ?\n"); 
-		#endif 
-		SHUTDOWN2(SSL_get_fd(scon));
-
-
-		if (SSL_session_reused(scon)){
-			ver = 'r';
-		} else{
-			ver = SSL_version(scon);
-			if (ver == TLS1_VERSION)
-				ver = 't';
-			else if (ver == SSL3_VERSION)
-				ver = '3';
-			else if (ver == SSL2_VERSION)
-				ver = '2';
-			else
-				ver = '*';
-		}
-		#ifdef DEBUG
-		printf("[DEBUG] SSL version=%d\n", ver); 
-		#endif 
-		fflush(stdout);
-
-		// Free session 
-		SSL_free(scon);
-		scon = NULL;
+		CRYPTO_thread_cleanup_pthreads();
 	}
+#endif
 	end = clock();
 	cpu_time_used = ((double) (end - start)) / CLOCKS_PER_SEC;	
 	totalTime += tm_Time_F(STOP); /* Add the time for this iteration */
+	wall = st_now() - wall;
+
+	// Merge what the workers measured
+	memset(&handshake, 0, sizeof(handshake));
+	memset(&ttfb, 0, sizeof(ttfb));
+	for (i = 0; i < nWorkers; i++){
+		nConn += workers[i].nConn;
+		nFail += workers[i].nFail;
+		nLate += workers[i].nLate;
+		bytes_read += workers[i].bytes_read;
+		hist_add(&handshake, &workers[i].handshake);
+		hist_add(&ttfb, &workers[i].ttfb);
+	}
 
-	i = (int)((long)time(NULL) - finishtime + maxTime);
 	//printf( "\n\n%d connections. CPU time=%.2fs; %.2f connections/user sec, bytes read %ld\n", nConn, totalTime, ((double)nConn/totalTime),bytes_read);
-	printf( "\n\n%d connections. CPU time=%.5fs; %.2f connections/user sec, bytes read %ld\n", nConn, totalTime, ((double)nConn/cpu_time_used),bytes_read);
-	printf( "%d connections in %ld real seconds, %ld bytes read per connection\n",nConn, (long)time(NULL) - finishtime + maxTime, bytes_read/nConn);
+	printf( "\n\n%ld connections. CPU time=%.5fs; %.2f connections/user sec, bytes read %ld\n", nConn, totalTime, ((double)nConn/cpu_time_used),bytes_read);
+	printf( "%ld connections in %ld real seconds, %ld bytes read per connection\n",nConn, (long)time(NULL) - finishtime + maxTime, nConn ? bytes_read/nConn : 0);
 	//printf( "\n CPU time=%.5fs; %.5f connections/user sec [NEW]", cpu_time_used, ((double)nConn/cpu_time_used));
+	if (n_threads > 0 || target_rate > 0){
+		// Arrivals the workers fell too far behind to even start
+		long nMissed = 0;
+		if (target_rate > 0 && sched_next < sched_end){
+			nMissed = (long)((sched_end - sched_next) * target_rate + 0.999);
+		}
+		printf("%d worker(s), %s loop: offered %.2f/s, completed %.2f/s, %ld failed, %ld late, %ld not started\n",
+			nWorkers, target_rate > 0 ? "open" : "closed", target_rate > 0 ? target_rate : (nConn + nFail) / wall,
+			nConn / wall, nFail, nLate, nMissed);
+	}
+	hist_print_summary("handshake", &handshake);
+	hist_print_summary("ttfb", &ttfb);
+	if (hdr_file != NULL){
+		if (hist_dump(hdr_file, "handshake", &handshake) < 0 || hist_dump(hdr_file, "ttfb", &ttfb) < 0){
+			goto end;
+		}
+	}
+	ret = 0;
 
 
 /* Now loop and time connections using the same session id over and over
@@ -947,8 +1312,11 @@ next:
 */
 
 end:
-	if (scon != NULL){
-		SSL_free(scon);
+	if (workers != NULL){
+		for (i = 0; i < nWorkers; i++){
+			worker_cleanup(&workers[i]);
+		}
+		OPENSSL_free(workers);
 	}
 
 	if (tm_ctx != NULL){
@@ -994,8 +1362,10 @@ int tcp_connect(char *host, int port){
 
 
 
-	// Resolve host 
+	// Resolve host (gethostbyname() is shared between workers)
+	CRYPTO_w_lock(CRYPTO_LOCK_GETHOSTBYNAME);
 	if(!(hp = gethostbyname(host))){
+		CRYPTO_w_unlock(CRYPTO_LOCK_GETHOSTBYNAME);
 		berr_exit("Couldn't resolve host");
 	}
 	#ifdef DEBUG
@@ -1005,6 +1375,7 @@ int tcp_connect(char *host, int port){
 	memset(&addr, 0, sizeof(addr));
 	addr.sin_addr = *(struct in_addr*)
 	hp->h_addr_list[0];
+	CRYPTO_w_unlock(CRYPTO_LOCK_GETHOSTBYNAME);
 	addr.sin_family = AF_INET;
 	addr.sin_port = htons(port);
 
@@ -1041,21 +1412,29 @@ int tcp_connect(char *host, int port){
  * Returns:
  *		SSL *	= the connection pointer.
  */
-static SSL *doConnection(SSL *scon, char *proto){
+static SSL *doConnection(S_TIME_WORKER *wk, SSL *scon){
 	BIO *conn;
 	SSL *serverCon;
-	int width, i;
+	int width, i = 0;
 	fd_set readfds;
-	SPP_PROXY *proxies[N_proxies];
-	SPP_SLICE *slice_set[slices_len];
+	SPP_PROXY *proxies[wk->N_proxies + 1];
+	SPP_SLICE *slice_set[wk->slices_len + 1];
+
 
+	/* WARNING ONLY FOR TESTING: for PLN the socket is kept in wk->mySoc
+	 * and the returned pointer only tells success from failure */
 
-	/* WARNING ONLY FOR TESTING, THIS OVERRIDES RETURN TYPE FOR PLN PROTOCOL */
+	if ((strcmp(wk->proto, "pln")) == 0){
+		char host_ip[256];
+		char *colon = strchr(host, ':');
 
-	if ((strcmp(proto, "pln")) == 0){
-		char * host_ip = strtok(strdup(host), ":");
-		int host_port = atoi(strtok(NULL, ":")); 
-		return tcp_connect(host_ip, host_port); // WARNING, THIS OVERRIDES RETURN TYPE. ONLY FOR TESTING
+		if (colon == NULL || colon - host >= (int)sizeof(host_ip)){
+			return NULL;
+		}
+		memcpy(host_ip, host, colon - host);
+		host_ip[colon - host] = '\0';
+		wk->mySoc = tcp_connect(host_ip, atoi(colon + 1));
+		return (SSL *)wk;
 	}
 
 
@@ -1073,17 +1452,17 @@ static SSL *doConnection(SSL *scon, char *proto){
 	// Create a new SSL* 
 	if (scon == NULL){
 		serverCon = SSL_new(tm_ctx);
-		if ((strcmp(proto, "spp")) == 0){
+		if ((strcmp(wk->proto, "spp")) == 0){
 			// Assign proxies
 			int j; 
-			for (j = 0; j < N_proxies; j++){
-				proxies[j] = SPP_generate_proxy(serverCon, proxies_address[j]);
+			for (j = 0; j < wk->N_proxies; j++){
+				proxies[j] = SPP_generate_proxy(serverCon, wk->proxies_address[j]);
 				#ifdef DEBUG
 				printf("[DEBUG] Generating proxy: %s\n", proxies[j]->address);
 				#endif 
 			}
 			// Generate and assign slices
-			slices_management(serverCon, slice_set, proxies); 		
+			slices_management(wk, serverCon, slice_set, proxies); 		
 		}
 	} 
 	// Re-use SSL* passed as argument
@@ -1102,10 +1481,10 @@ static SSL *doConnection(SSL *scon, char *proto){
 	// ok, lets connect -- weird 
 	for(;;) {
 		// Check here 
-		if ((strcmp(proto, "spp")) == 0){
-			i = SPP_connect(serverCon, slice_set, slices_len, proxies, N_proxies); 
+		if ((strcmp(wk->proto, "spp")) == 0){
+			i = SPP_connect(serverCon, slice_set, wk->slices_len, proxies, wk->N_proxies); 
 		}
-		if ((strcmp(proto, "ssl")) == 0){
+		if ((strcmp(wk->proto, "ssl")) == 0){
 			i = SSL_connect(serverCon);
 		}		
 		if (BIO_sock_should_retry(i)){
@@ -239,6 +239,10 @@ static void print_result(int alg,int run_no,int count,double time_used);
 static int do_multi(int multi);
 #endif
 
+#if !defined(OPENSSL_NO_AES) && !defined(OPENSSL_NO_SHA256)
+#define SPEED_WITH_SPP
+#endif
+
 #define ALGOR_NUM	30
 #define SIZE_NUM	5
 #define RSA_NUM		4
@@ -270,6 +274,59 @@ static double ecdsa_results[EC_NUM][2];
 static double ecdh_results[EC_NUM][1];
 #endif
 
+#ifdef SPEED_WITH_SPP
+/* 'spp': cost of sealing and opening one record, as done by do_spp_write()
+ * and spp_get_record(), with AES-128-CBC and HMAC-SHA256 (the record
+ * protection of DHE-RSA-AES128-SHA256) over memory buffers. Records go round
+ * robin over 1, 4 or 32 slices, each with its own keys. An endpoint seals
+ * with three MACs and checks all three when opening; a reader proxy decrypts
+ * and checks the read MAC only; a writer proxy checks the read and write
+ * MACs and seals the record again. TLS records, with one MAC, are the
+ * reference. */
+#define SPP_SIZE_NUM	6
+#define SPP_SLICE_NUM	3
+#define SPP_ROW_NUM	(2+4*SPP_SLICE_NUM)
+
+#define SPP_SEAL	0
+#define SPP_OPEN	1
+#define SPP_READER	2
+#define SPP_WRITER	3
+
+static const char *spp_names[SPP_ROW_NUM]={
+  "tls seal","tls open",
+  "spp/1 seal","spp/1 open","spp/1 reader","spp/1 writer",
+  "spp/4 seal","spp/4 open","spp/4 reader","spp/4 writer",
+  "spp/32 seal","spp/32 open","spp/32 reader","spp/32 writer" };
+static int spp_slices[SPP_SLICE_NUM]={1,4,32};
+static int spp_lengths[SPP_SIZE_NUM]={16,64,256,1024,8*1024,16*1024};
+static double spp_results[SPP_ROW_NUM][SPP_SIZE_NUM];
+
+typedef struct speed_spp_slice_st
+	{
+	int id;
+	EVP_CIPHER_CTX enc, dec;
+	HMAC_CTX read_mac, write_mac;
+	unsigned char *rec;	/* a sealed record, for the open tests */
+	int rec_len;
+	} SPEED_SPP_SLICE;
+
+typedef struct speed_spp_st
+	{
+	int tls;
+	int nslices, next;
+	SPEED_SPP_SLICE *slices;
+	HMAC_CTX integrity;
+	unsigned char *work;
+	} SPEED_SPP;
+
+static int spp_speed_init(SPEED_SPP *sp, int tls, int nslices, int len);
+static void spp_speed_cleanup(SPEED_SPP *sp);
+static int spp_speed_seal(SPEED_SPP *sp, SPEED_SPP_SLICE *sl,
+	unsigned char *out, const unsigned char *in, int len);
+static int spp_speed_open(SPEED_SPP *sp, const unsigned char *rec,
+	int rec_len, int role);
+#endif
+
 #if defined(OPENSSL_NO_DSA) && !(defined(OPENSSL_NO_ECDSA) && defined(OPENSSL_NO_ECDH))
 static const char rnd_seed[] = "string to make the random number generator think it has entropy";
 static int rnd_fake = 0;
@@ -623,6 +680,9 @@ int MAIN(int argc, char **argv)
 #endif
 	int doit[ALGOR_NUM];
 	int pr_header=0;
+#ifdef SPEED_WITH_SPP
+	int spp_doit=0;
+#endif
 	const EVP_CIPHER *evp_cipher=NULL;
 	const EVP_MD *evp_md=NULL;
 	int decrypt=0;
@@ -636,6 +696,9 @@ int MAIN(int argc, char **argv)
 
 	apps_startup();
 	memset(results, 0, sizeof(results));
+#ifdef SPEED_WITH_SPP
+	memset(spp_results, 0, sizeof(spp_results));
+#endif
 #ifndef OPENSSL_NO_DSA
 	memset(dsa_key,0,sizeof(dsa_key));
 #endif
@@ -929,6 +992,10 @@ int MAIN(int argc, char **argv)
 			}
 		else
 #endif
+#ifdef SPEED_WITH_SPP
+			if (strcmp(*argv,"spp") == 0) spp_doit=1;
+		else
+#endif
 #ifndef OPENSSL_NO_CAMELLIA
 			if (strcmp(*argv,"camellia") == 0)
 			{
@@ -1085,6 +1152,10 @@ int MAIN(int argc, char **argv)
 			BIO_printf(bio_err,"rsa512   rsa1024  rsa2048  rsa4096\n");
 #endif
 
+#ifdef SPEED_WITH_SPP
+			BIO_printf(bio_err,"spp (SPP and TLS record seal/open)\n");
+#endif
+
 #ifndef OPENSSL_NO_DSA
 			BIO_printf(bio_err,"dsa512   dsa1024  dsa2048\n");
 #endif
@@ -2000,6 +2071,66 @@ int MAIN(int argc, char **argv)
 			}
 		}
 
+#ifdef SPEED_WITH_SPP
+	if (spp_doit)
+		{
+		SPEED_SPP sp;
+		unsigned char *in, *out;
+		int role, row, tls, l;
+
+		in=OPENSSL_malloc(spp_lengths[SPP_SIZE_NUM-1]);
+		out=OPENSSL_malloc(spp_lengths[SPP_SIZE_NUM-1]+1024);
+		if (in == NULL || out == NULL)
+			{
+			BIO_printf(bio_err,"out of memory\n");
+			goto end;
+			}
+		memset(in,'x',spp_lengths[SPP_SIZE_NUM-1]);
+		for (row=0; row<SPP_ROW_NUM; row++)
+			{
+			tls=(row < 2);
+			role=tls ? row : (row-2)%4;
+			for (j=0; j<SPP_SIZE_NUM; j++)
+				{
+				l=spp_lengths[j];
+				if (!spp_speed_init(&sp,tls,
+					tls ? 1 : spp_slices[(row-2)/4],l))
+					{
+					BIO_printf(bio_err,"%s: record check failed\n",
+						spp_names[row]);
+					ERR_print_errors(bio_err);
+					spp_speed_cleanup(&sp);
+					break;
+					}
+				print_message(spp_names[row],save_count,l);
+				Time_F(START);
+				if (role == SPP_SEAL)
+					for (count=0,run=1; COND(save_count*4*lengths[0]/l); count++)
+						{
+						spp_speed_seal(&sp,&sp.slices[sp.next],
+							out,in,l);
+						sp.next=(sp.next+1)%sp.nslices;
+						}
+				else
+					for (count=0,run=1; COND(save_count*4*lengths[0]/l); count++)
+						{
+						SPEED_SPP_SLICE *sl=&sp.slices[sp.next];
+
+						spp_speed_open(&sp,sl->rec,sl->rec_len,role);
+						sp.next=(sp.next+1)%sp.nslices;
+						}
+				d=Time_F(STOP);
+				BIO_printf(bio_err,mr ? "+R6:%ld:%s:%f\n"
+					: "%ld %s's in %.2fs\n",count,spp_names[row],d);
+				spp_results[row][j]=((double)count)/d*l;
+				spp_speed_cleanup(&sp);
+				}
+			}
+		OPENSSL_free(in);
+		OPENSSL_free(out);
+		}
+#endif
+
 	RAND_pseudo_bytes(buf,36);
 #ifndef OPENSSL_NO_RSA
 	for (j=0; j<RSA_NUM; j++)
@@ -2449,6 +2580,36 @@ show_res:
 			}
 		fprintf(stdout,"\n");
 		}
+#ifdef SPEED_WITH_SPP
+	if (spp_doit)
+		{
+		if(mr)
+			fprintf(stdout,"+H6");
+		else
+			{
+			fprintf(stdout,"SPP and TLS records, aes-128 cbc + hmac(sha256), in 1000s of bytes per second.\n");
+			fprintf(stdout,"type         ");
+			}
+		for (j=0;  j<SPP_SIZE_NUM; j++)
+			fprintf(stdout,mr ? ":%d" : "%7d bytes",spp_lengths[j]);
+		fprintf(stdout,"\n");
+		for (k=0; k<SPP_ROW_NUM; k++)
+			{
+			if(mr)
+				fprintf(stdout,"+F6:%d:%s",k,spp_names[k]);
+			else
+				fprintf(stdout,"%-14s",spp_names[k]);
+			for (j=0; j<SPP_SIZE_NUM; j++)
+				{
+				if (spp_results[k][j] > 10000 && !mr)
+					fprintf(stdout," %11.2fk",spp_results[k][j]/1e3);
+				else
+					fprintf(stdout,mr ? ":%.2f" : " %11.2f ",spp_results[k][j]);
+				}
+			fprintf(stdout,"\n");
+			}
+		}
+#endif
 #ifndef OPENSSL_NO_RSA
 	j=1;
 	for (k=0; k<RSA_NUM; k++)
@@ -2573,6 +2734,197 @@ end:
 	OPENSSL_EXIT(mret);
 	}
 
+#ifdef SPEED_WITH_SPP
+/* Record layout, as in do_spp_write(): header (type, version, length and,
+ * for SPP, the slice id), explicit IV, data, the MACs (read, write and
+ * integrity for SPP, one for TLS), CBC padding. The MACs cover a zero
+ * sequence number and the TLS style header, as tls1_mac() does. */
+#define SPP_SPEED_IV	16
+#define SPP_SPEED_MAC	32
+
+static int spp_speed_header_len(SPEED_SPP *sp)
+	{
+	return sp->tls ? 5 : 6;
+	}
+
+static int spp_speed_macs(SPEED_SPP *sp)
+	{
+	return sp->tls ? 1 : 3;
+	}
+
+static void spp_speed_mac(HMAC_CTX *key, int len, const unsigned char *data,
+	unsigned char *md)
+	{
+	HMAC_CTX hmac;
+	unsigned char hdr[13];
+	unsigned int md_len;
+
+	memset(hdr,0,8);
+	hdr[8]=23;
+	hdr[9]=0x06;
+	hdr[10]=0x66;
+	hdr[11]=(len>>8)&0xff;
+	hdr[12]=len&0xff;
+	HMAC_CTX_init(&hmac);
+	HMAC_CTX_copy(&hmac,key);
+	HMAC_Update(&hmac,hdr,sizeof(hdr));
+	HMAC_Update(&hmac,data,len);
+	HMAC_Final(&hmac,md,&md_len);
+	HMAC_CTX_cleanup(&hmac);
+	}
+
+static int spp_speed_seal(SPEED_SPP *sp, SPEED_SPP_SLICE *sl,
+	unsigned char *out, const unsigned char *in, int len)
+	{
+	unsigned char *p=out+spp_speed_header_len(sp), *d=p+SPP_SPEED_IV;
+	int n=SPP_SPEED_IV+len+spp_speed_macs(sp)*SPP_SPEED_MAC, pad;
+
+	pad=16-n%16;
+	out[0]=23;
+	out[1]=0x06;
+	out[2]=0x66;
+	out[3]=((n+pad)>>8)&0xff;
+	out[4]=(n+pad)&0xff;
+	if (!sp->tls)
+		out[5]=sl->id;
+	RAND_pseudo_bytes(p,SPP_SPEED_IV);
+	memcpy(d,in,len);
+	spp_speed_mac(&sl->read_mac,len,d,d+len);
+	if (!sp->tls)
+		{
+		spp_speed_mac(&sl->write_mac,len,d,d+len+SPP_SPEED_MAC);
+		spp_speed_mac(&sp->integrity,len,d,d+len+2*SPP_SPEED_MAC);
+		}
+	memset(p+n,pad-1,pad);
+	EVP_Cipher(&sl->enc,p,p,n+pad);
+	return spp_speed_header_len(sp)+n+pad;
+	}
+
+/* Returns the payload length, or -1 if the record does not check out. */
+static int spp_speed_open(SPEED_SPP *sp, const unsigned char *rec,
+	int rec_len, int role)
+	{
+	SPEED_SPP_SLICE *sl=&sp->slices[0];
+	unsigned char md[SPP_SPEED_MAC], *d=sp->work+SPP_SPEED_IV;
+	int i, n, pad, len, hl=spp_speed_header_len(sp), ok=1;
+
+	if (!sp->tls)
+		{
+		/* like SPP_get_slice_by_id() */
+		for (i=0; i<sp->nslices; i++)
+			if (sp->slices[i].id == rec[5])
+				break;
+		if (i == sp->nslices)
+			return -1;
+		sl=&sp->slices[i];
+		}
+	n=(rec[3]<<8)|rec[4];
+	if (n != rec_len-hl || n%16 != 0)
+		return -1;
+	EVP_Cipher(&sl->dec,sp->work,rec+hl,n);
+	pad=sp->work[n-1];
+	len=n-SPP_SPEED_IV-pad-1-spp_speed_macs(sp)*SPP_SPEED_MAC;
+	if (len < 0)
+		return -1;
+	for (i=n-pad-1; i<n; i++)
+		ok&=(sp->work[i] == pad);
+
+	spp_speed_mac(&sl->read_mac,len,d,md);
+	ok&=!CRYPTO_memcmp(md,d+len,SPP_SPEED_MAC);
+	if (!sp->tls && role != SPP_READER)
+		{
+		spp_speed_mac(&sl->write_mac,len,d,md);
+		ok&=!CRYPTO_memcmp(md,d+len+SPP_SPEED_MAC,SPP_SPEED_MAC);
+		}
+	if (!sp->tls && role == SPP_OPEN)
+		{
+		spp_speed_mac(&sp->integrity,len,d,md);
+		ok&=!CRYPTO_memcmp(md,d+len+2*SPP_SPEED_MAC,SPP_SPEED_MAC);
+		}
+	if (!ok)
+		return -1;
+	if (role == SPP_WRITER)
+		{
+		/* forward a modified record: new read and write MACs, the
+		 * integrity MAC is kept */
+		RAND_pseudo_bytes(sp->work,SPP_SPEED_IV);
+		spp_speed_mac(&sl->read_mac,len,d,d+len);
+		spp_speed_mac(&sl->write_mac,len,d,d+len+SPP_SPEED_MAC);
+		EVP_Cipher(&sl->enc,sp->work,sp->work,n);
+		}
+	return len;
+	}
+
+static int spp_speed_init(SPEED_SPP *sp, int tls, int nslices, int len)
+	{
+	unsigned char key[16+2*SPP_SPEED_MAC];
+	SPEED_SPP_SLICE *sl;
+	int i, size=len+1024;
+
+	memset(sp,0,sizeof(*sp));
+	sp->tls=tls;
+	HMAC_CTX_init(&sp->integrity);
+	sp->slices=OPENSSL_malloc(nslices*sizeof(*sp->slices));
+	sp->work=OPENSSL_malloc(size);
+	if (sp->slices == NULL || sp->work == NULL)
+		return 0;
+	memset(sp->slices,0,nslices*sizeof(*sp->slices));
+	for (i=0; i<nslices; i++)
+		{
+		sl=&sp->slices[i];
+		EVP_CIPHER_CTX_init(&sl->enc);
+		EVP_CIPHER_CTX_init(&sl->dec);
+		HMAC_CTX_init(&sl->read_mac);
+		HMAC_CTX_init(&sl->write_mac);
+		}
+	sp->nslices=nslices;
+
+	RAND_pseudo_bytes(key,SPP_SPEED_MAC);
+	HMAC_Init_ex(&sp->integrity,key,SPP_SPEED_MAC,EVP_sha256(),NULL);
+	for (i=0; i<nslices; i++)
+		{
+		sl=&sp->slices[i];
+		sl->id=i+1;
+		RAND_pseudo_bytes(key,sizeof(key));
+		if (!EVP_EncryptInit_ex(&sl->enc,EVP_aes_128_cbc(),NULL,key,key)
+			|| !EVP_DecryptInit_ex(&sl->dec,EVP_aes_128_cbc(),NULL,key,key)
+			|| !HMAC_Init_ex(&sl->read_mac,key+16,SPP_SPEED_MAC,EVP_sha256(),NULL)
+			|| !HMAC_Init_ex(&sl->write_mac,key+16+SPP_SPEED_MAC,SPP_SPEED_MAC,EVP_sha256(),NULL))
+			return 0;
+		if ((sl->rec=OPENSSL_malloc(size)) == NULL)
+			return 0;
+		memset(sp->work,'x',len);
+		sl->rec_len=spp_speed_seal(sp,sl,sl->rec,sp->work,len);
+		if (spp_speed_open(sp,sl->rec,sl->rec_len,SPP_OPEN) != len)
+			return 0;
+		}
+	return 1;
+	}
+
+static void spp_speed_cleanup(SPEED_SPP *sp)
+	{
+	SPEED_SPP_SLICE *sl;
+	int i;
+
+	for (i=0; i<sp->nslices; i++)
+		{
+		sl=&sp->slices[i];
+		EVP_CIPHER_CTX_cleanup(&sl->enc);
+		EVP_CIPHER_CTX_cleanup(&sl->dec);
+		HMAC_CTX_cleanup(&sl->read_mac);
+		HMAC_CTX_cleanup(&sl->write_mac);
+		if (sl->rec != NULL)
+			OPENSSL_free(sl->rec);
+		}
+	HMAC_CTX_cleanup(&sp->integrity);
+	if (sp->slices != NULL)
+		OPENSSL_free(sp->slices);
+	if (sp->work != NULL)
+		OPENSSL_free(sp->work);
+	memset(sp,0,sizeof(*sp));
+	}
+#endif
+
 static void print_message(const char *s, long num, int length)
 	{
 #ifdef SIGALRM
@@ -2826,6 +3178,22 @@ static int do_multi(int multi)
 				}
 #endif
 
+#ifdef SPEED_WITH_SPP
+			else if(!strncmp(buf,"+F6:",4))
+				{
+				int k;
+				int j;
+
+				p=buf+4;
+				k=atoi(sstrsep(&p,sep));
+				sstrsep(&p,sep);
+				for(j=0 ; j < SPP_SIZE_NUM ; ++j)
+					spp_results[k][j]+=atof(sstrsep(&p,sep));
+				}
+			else if(!strncmp(buf,"+H6:",4))
+				{
+				}
+#endif
 			else if(!strncmp(buf,"+H:",3))
 				{
 				}
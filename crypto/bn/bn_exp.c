@@ -112,6 +112,7 @@
 
 #include "cryptlib.h"
 #include "bn_lcl.h"
+#include "rsaz_exp.h"
 
 #include <stdlib.h>
 #ifdef _WIN32
@@ -619,6 +620,25 @@ int BN_mod_exp_mont_consttime(BIGNUM *rr, const BIGNUM *a, const BIGNUM *p,
 		if (!BN_MONT_CTX_set(mont,m,ctx)) goto err;
 		}
 
+#ifdef RSAZ_ENABLED
+	/* The CRT halves of RSA-2048 private key operations */
+	if ((16 == a->top) && (16 == p->top) && (BN_num_bits(m) == 1024) &&
+		!a->neg && (BN_ucmp(a,m) < 0) && rsaz_avx2_eligible())
+		{
+		BN_ULONG RR[16];
+
+		if (NULL == bn_wexpand(rr, 16)) goto err;
+		memset(RR, 0, sizeof(RR));
+		memcpy(RR, mont->RR.d, mont->RR.top*sizeof(BN_ULONG));
+		RSAZ_1024_mod_exp_avx2(rr->d, a->d, p->d, m->d, RR, mont->n0[0]);
+		rr->top = 16;
+		rr->neg = 0;
+		bn_correct_top(rr);
+		ret = 1;
+		goto err;
+		}
+#endif
+
 	/* Get the window size to use with size of p. */
 	window = BN_window_bits_for_ctime_exponent_size(bits);
 #if defined(OPENSSL_BN_ASM_MONT5)
@@ -0,0 +1,305 @@
+/* crypto/bn/rsaz_exp.c */
+/*
+ * 1024-bit modular exponentiation with AVX2.
+ *
+ * Numbers are kept in 36 digits of 29 bits, one 64-bit lane each, so that
+ * the 1024-bit operand takes nine 256-bit registers and vpmuludq makes
+ * four digit products at a time without carries. Multiplication is
+ * "almost Montgomery" (AMM) with R = 2^1044: for a, b < 2m the result is
+ * again below 2m (as 4m < R), so there are no final subtractions until
+ * the very end. The digits of the accumulator are only carried after 16
+ * of the 36 steps of a multiplication and at the end: 20 steps of two
+ * products below 2^58 each fit a lane.
+ *
+ * The accumulator has ten registers. Rather than moving it down by a digit
+ * each step, a and m are read from addresses shifted by one more digit
+ * each step, and after four steps the lowest register, all done, is dropped.
+ * The reduction digit of each step depends on the lowest digit not done
+ * yet, so the lowest four digits are also kept in general purpose
+ * registers: the dependency chain from one step to the next then doesn't
+ * go through the vector unit.
+ *
+ * The exponentiation uses a fixed 5-bit window over all 1024 exponent
+ * bits and reads the whole table of 32 powers for each window, so neither
+ * its timing nor its memory access pattern depend on the exponent.
+ */
+
+#include "cryptlib.h"
+#include "bn_lcl.h"
+#include "rsaz_exp.h"
+
+#ifdef RSAZ_ENABLED
+
+#include <immintrin.h>
+
+#define RSAZ_DIGITS	36		/* 36*29 = 1044 bits */
+#define RSAZ_VECS	(RSAZ_DIGITS/4)
+#define RSAZ_BITS	29
+#define RSAZ_MASK	((1UL<<RSAZ_BITS)-1)
+#define RSAZ_WINDOW	5
+
+typedef union
+	{
+	__m256i v[RSAZ_VECS];
+	BN_ULONG d[RSAZ_DIGITS];
+	} RSAZ_NUM;
+
+/* A number with a vector of zero digits below and two above it, for reading
+ * it shifted by up to three digits either way */
+typedef union
+	{
+	__m256i v[RSAZ_VECS+3];
+	BN_ULONG d[4*(RSAZ_VECS+3)];
+	} RSAZ_PADDED;
+
+extern unsigned int OPENSSL_ia32cap_P[];
+
+int rsaz_avx2_eligible(void)
+	{
+	return (OPENSSL_ia32cap_P[2] & (1<<5)) != 0;	/* AVX2 */
+	}
+
+static void rsaz_from_words(RSAZ_NUM *r, const BN_ULONG a[16])
+	{
+	int i,bit,w,s;
+	BN_ULONG v;
+
+	for (i=0; i<RSAZ_DIGITS; i++)
+		{
+		bit=i*RSAZ_BITS;
+		w=bit/64;
+		s=bit%64;
+		v=a[w]>>s;
+		if (s > 64-RSAZ_BITS && w+1 < 16)
+			v|=a[w+1]<<(64-s);
+		r->d[i]=v&RSAZ_MASK;
+		}
+	}
+
+static const BN_ULONG *rsaz_pad(RSAZ_PADDED *r, const RSAZ_NUM *a)
+	{
+	memset(r->d,0,4*sizeof(BN_ULONG));
+	memcpy(r->d+4,a->d,sizeof(a->d));
+	memset(r->d+4+RSAZ_DIGITS,0,8*sizeof(BN_ULONG));
+	return r->d+4;
+	}
+
+/* a must be fully reduced */
+static void rsaz_to_words(BN_ULONG r[16], const RSAZ_NUM *a)
+	{
+	int i,bit,w,s;
+
+	memset(r,0,16*sizeof(BN_ULONG));
+	for (i=0; i<RSAZ_DIGITS; i++)
+		{
+		bit=i*RSAZ_BITS;
+		w=bit/64;
+		s=bit%64;
+		r[w]|=a->d[i]<<s;
+		if (s > 64-RSAZ_BITS && w+1 < 16)
+			r[w+1]|=a->d[i]>>(64-s);
+		}
+	}
+
+/* The compiler would otherwise do the multiplications of all four steps
+ * first and spill their products; these keep it a step at a time, in the
+ * sixteen registers there are. */
+#define RSAZ_BARRIER(x)	__asm__("" : "+x"(x))
+#define RSAZ_ACC_BARRIER() \
+	__asm__("" : "+x"(acc[0]),"+x"(acc[1]),"+x"(acc[2]),"+x"(acc[3]), \
+		"+x"(acc[4]),"+x"(acc[5]),"+x"(acc[6]),"+x"(acc[7]), \
+		"+x"(acc[8]),"+x"(acc[9]))
+
+/* One digit step of rsaz_amm(), the j-th of a group of four: adds a*b[i]
+ * and y*m for the reduction digit y of position j, both shifted up by j
+ * positions, to the accumulator. s[] mirrors positions 0 to 3 of it with
+ * all carries; the carry out of position j goes to s[j+1], or to c for the
+ * next group. */
+#define RSAZ_STEP(j) \
+	do { \
+	bd=b->d[i+j]; \
+	bi=_mm256_set1_epi64x(bd); \
+	RSAZ_BARRIER(bi); \
+	s[j]+=ap[0]*bd; \
+	y=(s[j]*k0)&RSAZ_MASK; \
+	yi=_mm256_set1_epi64x(y); \
+	c=(s[j]+y*mp[0])>>RSAZ_BITS; \
+	for (p=j+1; p<4; p++) \
+		s[p]+=ap[p-j]*bd+mp[p-j]*y; \
+	if (j < 3) \
+		s[j+1]+=c; \
+	for (k=0; k<RSAZ_VECS+1; k++) \
+		acc[k]=_mm256_add_epi64(acc[k],_mm256_add_epi64( \
+			_mm256_mul_epu32(_mm256_loadu_si256( \
+				(const __m256i *)(ap+4*k-j)),bi), \
+			_mm256_mul_epu32(_mm256_loadu_si256( \
+				(const __m256i *)(mp+4*k-j)),yi))); \
+	RSAZ_ACC_BARRIER(); \
+	} while (0)
+
+/* r = a*b/R mod m, r < 2m for a, b < 2m. r may be a or b. mp is m as
+ * from rsaz_pad(). */
+__attribute__((target("avx2")))
+static void rsaz_amm(RSAZ_NUM *r, const RSAZ_NUM *a, const RSAZ_NUM *b,
+	const BN_ULONG *mp, BN_ULONG k0)
+	{
+	RSAZ_PADDED apad;
+	const BN_ULONG *ap;
+	__m256i acc[RSAZ_VECS+1];
+	__m256i bi,yi,t,u,mask,zero;
+	BN_ULONG s[4],bd,y,c;
+	int i,k,p;
+
+	ap=rsaz_pad(&apad,a);
+	zero=_mm256_setzero_si256();
+	mask=_mm256_set1_epi64x(RSAZ_MASK);
+	for (k=0; k<RSAZ_VECS+1; k++)
+		acc[k]=zero;
+	s[0]=s[1]=s[2]=s[3]=0;
+
+	/* Every four steps the lowest four positions are done with: the
+	 * accumulator moves down by a register instead of a digit each
+	 * step, and a and m are read from shifted addresses instead. */
+	for (i=0; i<RSAZ_DIGITS; i+=4)
+		{
+		RSAZ_STEP(0);
+		RSAZ_STEP(1);
+		RSAZ_STEP(2);
+		RSAZ_STEP(3);
+		for (k=0; k<RSAZ_VECS; k++)
+			acc[k]=acc[k+1];
+		acc[RSAZ_VECS]=zero;
+
+		if (i == 12)
+			{
+			/* Carry each digit into the next once, so that the
+			 * remaining 20 steps have room again. The top ones
+			 * have no carry as the value is below 2^1026. */
+			u=zero;
+			for (k=0; k<RSAZ_VECS; k++)
+				{
+				t=_mm256_srli_epi64(acc[k],RSAZ_BITS);
+				acc[k]=_mm256_and_si256(acc[k],mask);
+				acc[k]=_mm256_add_epi64(acc[k],_mm256_blend_epi32(
+					_mm256_permute4x64_epi64(t,0x93),u,0x03));
+				u=_mm256_permute4x64_epi64(t,0x93);
+				}
+			}
+		s[0]=_mm256_extract_epi64(acc[0],0)+c;
+		s[1]=_mm256_extract_epi64(acc[0],1);
+		s[2]=_mm256_extract_epi64(acc[0],2);
+		s[3]=_mm256_extract_epi64(acc[0],3);
+		}
+
+	for (k=0; k<RSAZ_VECS; k++)
+		_mm256_store_si256(&r->v[k],acc[k]);
+	r->d[0]+=c;
+	for (c=0, i=0; i<RSAZ_DIGITS; i++)
+		{
+		c+=r->d[i];
+		r->d[i]=c&RSAZ_MASK;
+		c>>=RSAZ_BITS;
+		}
+	}
+
+/* r = table[idx], reading all entries */
+__attribute__((target("avx2")))
+static void rsaz_gather(RSAZ_NUM *r, const RSAZ_NUM *table, int idx)
+	{
+	__m256i acc[RSAZ_VECS],sel,want;
+	int i,k;
+
+	for (k=0; k<RSAZ_VECS; k++)
+		acc[k]=_mm256_setzero_si256();
+	want=_mm256_set1_epi64x(idx);
+	for (i=0; i<1<<RSAZ_WINDOW; i++)
+		{
+		sel=_mm256_cmpeq_epi64(_mm256_set1_epi64x(i),want);
+		for (k=0; k<RSAZ_VECS; k++)
+			acc[k]=_mm256_or_si256(acc[k],
+				_mm256_and_si256(_mm256_load_si256(&table[i].v[k]),sel));
+		}
+	for (k=0; k<RSAZ_VECS; k++)
+		_mm256_store_si256(&r->v[k],acc[k]);
+	}
+
+/* RSAZ_WINDOW bits of e from bit pos up */
+static int rsaz_window(const BN_ULONG e[16], int pos)
+	{
+	int w=pos/64,s=pos%64;
+	BN_ULONG v;
+
+	v=e[w]>>s;
+	if (s > 64-RSAZ_WINDOW && w+1 < 16)
+		v|=e[w+1]<<(64-s);
+	return (int)(v&((1<<RSAZ_WINDOW)-1));
+	}
+
+void RSAZ_1024_mod_exp_avx2(BN_ULONG result[16],
+	const BN_ULONG base[16], const BN_ULONG exponent[16],
+	const BN_ULONG m_words[16], const BN_ULONG RR[16], BN_ULONG k0)
+	{
+	RSAZ_NUM table[1<<RSAZ_WINDOW];
+	RSAZ_NUM m,acc,tmp,r2,one;
+	RSAZ_PADDED mpad;
+	const BN_ULONG *mp;
+	BN_ULONG borrow,d,sel;
+	int i,pos;
+
+	rsaz_from_words(&m,m_words);
+	mp=rsaz_pad(&mpad,&m);
+	k0&=RSAZ_MASK;
+	memset(&one,0,sizeof(one));
+	one.d[0]=1;
+
+	/* R^2 mod m for R = 2^1044 from the 2^2048 of the BN_MONT_CTX:
+	 * (2^2048)^2/R * 2^80/R = 2^2088 */
+	rsaz_from_words(&tmp,RR);
+	rsaz_amm(&tmp,&tmp,&tmp,mp,k0);
+	memset(&r2,0,sizeof(r2));
+	r2.d[80/RSAZ_BITS]=(BN_ULONG)1<<(80%RSAZ_BITS);
+	rsaz_amm(&r2,&tmp,&r2,mp,k0);
+
+	/* base^i*R for i < 32 */
+	rsaz_amm(&table[0],&r2,&one,mp,k0);
+	rsaz_from_words(&tmp,base);
+	rsaz_amm(&table[1],&tmp,&r2,mp,k0);
+	for (i=2; i<1<<RSAZ_WINDOW; i++)
+		rsaz_amm(&table[i],&table[i-1],&table[1],mp,k0);
+
+	/* 1024 = 4 + 204*5 */
+	pos=1024-1024%RSAZ_WINDOW;
+	rsaz_gather(&acc,table,rsaz_window(exponent,pos));
+	while (pos > 0)
+		{
+		pos-=RSAZ_WINDOW;
+		for (i=0; i<RSAZ_WINDOW; i++)
+			rsaz_amm(&acc,&acc,&acc,mp,k0);
+		rsaz_gather(&tmp,table,rsaz_window(exponent,pos));
+		rsaz_amm(&acc,&acc,&tmp,mp,k0);
+		}
+
+	/* out of the Montgomery domain, which leaves acc <= m, and subtract
+	 * m once more unless that borrows */
+	rsaz_amm(&acc,&acc,&one,mp,k0);
+	for (borrow=0, i=0; i<RSAZ_DIGITS; i++)
+		{
+		d=acc.d[i]-m.d[i]-borrow;
+		tmp.d[i]=d&RSAZ_MASK;
+		borrow=d>>63;
+		}
+	sel=0-borrow;
+	for (i=0; i<RSAZ_DIGITS; i++)
+		acc.d[i]=(acc.d[i]&sel)|(tmp.d[i]&~sel);
+	rsaz_to_words(result,&acc);
+
+	OPENSSL_cleanse(table,sizeof(table));
+	OPENSSL_cleanse(&acc,sizeof(acc));
+	OPENSSL_cleanse(&tmp,sizeof(tmp));
+	}
+
+#else
+
+static void *dummy=&dummy;
+
+#endif
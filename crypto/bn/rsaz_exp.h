@@ -0,0 +1,30 @@
+/* crypto/bn/rsaz_exp.h */
+/*
+ * 1024-bit modular exponentiation with AVX2, for the CRT halves of
+ * RSA-2048 private key operations. See rsaz_exp.c.
+ */
+
+#ifndef HEADER_RSAZ_EXP_H
+#define HEADER_RSAZ_EXP_H
+
+#undef RSAZ_ENABLED
+#if !defined(OPENSSL_NO_ASM) && defined(OPENSSL_CPUID_OBJ) && \
+	(defined(__x86_64) || defined(__x86_64__)) && \
+	(defined(__clang__) || \
+	 (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+# define RSAZ_ENABLED
+
+# include <openssl/bn.h>
+
+int rsaz_avx2_eligible(void);
+
+/* result = base^exponent mod m, all of them 16 words, in constant time.
+ * base must be below m, RR is R^2 mod m for R = 2^1024 and k0 the
+ * Montgomery constant -m^-1 mod 2^64, as in m's BN_MONT_CTX. */
+void RSAZ_1024_mod_exp_avx2(BN_ULONG result[16],
+	const BN_ULONG base[16], const BN_ULONG exponent[16],
+	const BN_ULONG m[16], const BN_ULONG RR[16], BN_ULONG k0);
+
+#endif
+
+#endif
@@ -0,0 +1,34 @@
+/* crypto/chacha/chacha.h */
+/*
+ * ChaCha20 stream cipher, as specified in RFC 7539.
+ */
+
+#ifndef HEADER_CHACHA_H
+#define HEADER_CHACHA_H
+
+#include <openssl/opensslconf.h>
+
+#if defined(OPENSSL_NO_CHACHA)
+#error ChaCha support is disabled.
+#endif
+
+#include <stddef.h>
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/* CRYPTO_chacha_20 encrypts |in_len| bytes from |in| with the given 256-bit
+ * key and 96-bit nonce and writes the result to |out|, which may be equal to
+ * |in|. |counter| is the block counter of the first block. */
+void CRYPTO_chacha_20(unsigned char *out,
+		      const unsigned char *in, size_t in_len,
+		      const unsigned char key[32],
+		      const unsigned char nonce[12],
+		      unsigned int counter);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,280 @@
+/* crypto/chacha/chacha_enc.c */
+/*
+ * ChaCha20 (RFC 7539).
+ *
+ * Besides the plain C code there are versions that run four (SSE2) or
+ * eight (AVX2) blocks side by side. Vector register i then holds word i
+ * of each of the blocks, so the rounds are the same as in the scalar code
+ * and only adding the input back and the transposition into blocks at the
+ * end are different. Whatever is left of the input after the last full
+ * batch of blocks goes through the scalar code.
+ */
+
+#include <string.h>
+#include "cryptlib.h"
+#include <openssl/chacha.h>
+
+#if !defined(OPENSSL_NO_ASM) && (defined(__x86_64) || defined(__x86_64__)) && \
+	defined(__SSE2__)
+# define CHACHA_SSE2
+# if defined(OPENSSL_CPUID_OBJ) && (defined(__clang__) || \
+	(defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+#  define CHACHA_AVX2
+# endif
+#endif
+
+#if defined(CHACHA_SSE2) || defined(CHACHA_AVX2)
+# include <immintrin.h>
+#endif
+
+typedef unsigned int u32;
+
+#define U8TO32_LITTLE(p) \
+	(((u32)((p)[0])) | ((u32)((p)[1]) << 8) | \
+	 ((u32)((p)[2]) << 16) | ((u32)((p)[3]) << 24))
+
+#define U32TO8_LITTLE(p, v) \
+	{ (p)[0] = (unsigned char)(v); (p)[1] = (unsigned char)((v) >> 8); \
+	  (p)[2] = (unsigned char)((v) >> 16); (p)[3] = (unsigned char)((v) >> 24); }
+
+static const unsigned char sigma[16] = "expand 32-byte k";
+
+/* One quarter round and a double round (a column and a diagonal round) of
+ * ChaCha, on whatever x holds, given the operations to use. */
+#define CHACHA_QR(ADD,XOR,R16,R12,R8,R7, a,b,c,d) \
+	x[a] = ADD(x[a], x[b]); x[d] = R16(XOR(x[d], x[a])); \
+	x[c] = ADD(x[c], x[d]); x[b] = R12(XOR(x[b], x[c])); \
+	x[a] = ADD(x[a], x[b]); x[d] = R8(XOR(x[d], x[a])); \
+	x[c] = ADD(x[c], x[d]); x[b] = R7(XOR(x[b], x[c]));
+
+#define CHACHA_DOUBLEROUND(ADD,XOR,R16,R12,R8,R7) \
+	CHACHA_QR(ADD,XOR,R16,R12,R8,R7, 0, 4, 8,12) \
+	CHACHA_QR(ADD,XOR,R16,R12,R8,R7, 1, 5, 9,13) \
+	CHACHA_QR(ADD,XOR,R16,R12,R8,R7, 2, 6,10,14) \
+	CHACHA_QR(ADD,XOR,R16,R12,R8,R7, 3, 7,11,15) \
+	CHACHA_QR(ADD,XOR,R16,R12,R8,R7, 0, 5,10,15) \
+	CHACHA_QR(ADD,XOR,R16,R12,R8,R7, 1, 6,11,12) \
+	CHACHA_QR(ADD,XOR,R16,R12,R8,R7, 2, 7, 8,13) \
+	CHACHA_QR(ADD,XOR,R16,R12,R8,R7, 3, 4, 9,14)
+
+#define PLUS(a,b)	((u32)((a) + (b)))
+#define XOR(a,b)	((a) ^ (b))
+#define ROTL(v,n)	((u32)((v) << (n)) | ((v) >> (32 - (n))))
+#define ROTL16(v)	ROTL(v,16)
+#define ROTL12(v)	ROTL(v,12)
+#define ROTL8(v)	ROTL(v,8)
+#define ROTL7(v)	ROTL(v,7)
+
+/* chacha_core writes the keystream block for input to output. */
+static void chacha_core(unsigned char output[64], const u32 input[16])
+	{
+	u32 x[16];
+	int i;
+
+	memcpy(x, input, sizeof(x));
+	for (i = 0; i < 10; i++)
+		{
+		CHACHA_DOUBLEROUND(PLUS,XOR,ROTL16,ROTL12,ROTL8,ROTL7)
+		}
+	for (i = 0; i < 16; i++)
+		U32TO8_LITTLE(output + 4 * i, PLUS(x[i], input[i]));
+	}
+
+#if defined(CHACHA_SSE2)
+
+#define SSE2_ROTL(v,n)	_mm_or_si128(_mm_slli_epi32(v,n), _mm_srli_epi32(v,32-(n)))
+#define SSE2_ROTL16(v)	_mm_shufflehi_epi16(_mm_shufflelo_epi16(v,0xb1),0xb1)
+#define SSE2_ROTL12(v)	SSE2_ROTL(v,12)
+#define SSE2_ROTL8(v)	SSE2_ROTL(v,8)
+#define SSE2_ROTL7(v)	SSE2_ROTL(v,7)
+
+/* XOR words w..w+3 of four blocks, held in a, b, c and d, into the output. */
+#define SSE2_STORE(w,a,b,c,d) \
+	{ \
+	__m128i t0 = _mm_unpacklo_epi32(a, b), t1 = _mm_unpacklo_epi32(c, d); \
+	__m128i t2 = _mm_unpackhi_epi32(a, b), t3 = _mm_unpackhi_epi32(c, d); \
+	SSE2_XOR16(4*(w),		_mm_unpacklo_epi64(t0, t1)); \
+	SSE2_XOR16(4*(w) + 64,		_mm_unpackhi_epi64(t0, t1)); \
+	SSE2_XOR16(4*(w) + 128,	_mm_unpacklo_epi64(t2, t3)); \
+	SSE2_XOR16(4*(w) + 192,	_mm_unpackhi_epi64(t2, t3)); \
+	}
+#define SSE2_XOR16(off,v) \
+	_mm_storeu_si128((__m128i *)(out + (off)), \
+		_mm_xor_si128(_mm_loadu_si128((const __m128i *)(in + (off))), v))
+
+/* chacha_vec4 processes as many 256-byte chunks of in as there are and
+ * returns their length. */
+static size_t chacha_vec4(unsigned char *out, const unsigned char *in,
+			  size_t in_len, u32 input[16])
+	{
+	__m128i x[16], s[16];
+	size_t done = 0;
+	int i;
+
+	for (i = 0; i < 16; i++)
+		s[i] = _mm_set1_epi32(input[i]);
+	s[12] = _mm_add_epi32(s[12], _mm_set_epi32(3, 2, 1, 0));
+
+	for (; in_len - done >= 256; done += 256, in += 256, out += 256)
+		{
+		for (i = 0; i < 16; i++)
+			x[i] = s[i];
+		for (i = 0; i < 10; i++)
+			{
+			CHACHA_DOUBLEROUND(_mm_add_epi32,_mm_xor_si128,
+				SSE2_ROTL16,SSE2_ROTL12,SSE2_ROTL8,SSE2_ROTL7)
+			}
+		for (i = 0; i < 16; i++)
+			x[i] = _mm_add_epi32(x[i], s[i]);
+		SSE2_STORE(0, x[0], x[1], x[2], x[3]);
+		SSE2_STORE(4, x[4], x[5], x[6], x[7]);
+		SSE2_STORE(8, x[8], x[9], x[10], x[11]);
+		SSE2_STORE(12, x[12], x[13], x[14], x[15]);
+		s[12] = _mm_add_epi32(s[12], _mm_set1_epi32(4));
+		}
+	input[12] += (u32)(done / 64);
+	return done;
+	}
+
+#endif
+
+#if defined(CHACHA_AVX2)
+
+extern unsigned int OPENSSL_ia32cap_P[];
+
+#define AVX2_ROTL(v,n)	_mm256_or_si256(_mm256_slli_epi32(v,n), _mm256_srli_epi32(v,32-(n)))
+#define AVX2_ROTL16(v)	_mm256_shuffle_epi8(v, rot16)
+#define AVX2_ROTL12(v)	AVX2_ROTL(v,12)
+#define AVX2_ROTL8(v)	_mm256_shuffle_epi8(v, rot8)
+#define AVX2_ROTL7(v)	AVX2_ROTL(v,7)
+
+/* Transpose words w..w+3 of eight blocks, held in a, b, c and d. The low
+ * halves of the results then hold blocks 0 to 3 and the high halves
+ * blocks 4 to 7. */
+#define AVX2_TRANSPOSE(a,b,c,d) \
+	{ \
+	__m256i t0 = _mm256_unpacklo_epi32(a, b), t1 = _mm256_unpacklo_epi32(c, d); \
+	__m256i t2 = _mm256_unpackhi_epi32(a, b), t3 = _mm256_unpackhi_epi32(c, d); \
+	a = _mm256_unpacklo_epi64(t0, t1); \
+	b = _mm256_unpackhi_epi64(t0, t1); \
+	c = _mm256_unpacklo_epi64(t2, t3); \
+	d = _mm256_unpackhi_epi64(t2, t3); \
+	}
+/* XOR block j, in the low (h = 0x20) or high (h = 0x31) halves of the
+ * transposed words 0-3 (lo) and 4-7 (hi) etc., into the output. */
+#define AVX2_STORE(j,h,w0,w4,w8,w12) \
+	{ \
+	AVX2_XOR32(64*(j),	_mm256_permute2x128_si256(w0, w4, h)); \
+	AVX2_XOR32(64*(j) + 32,	_mm256_permute2x128_si256(w8, w12, h)); \
+	}
+#define AVX2_XOR32(off,v) \
+	_mm256_storeu_si256((__m256i *)(out + (off)), \
+		_mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(in + (off))), v))
+
+/* chacha_avx2 processes as many 512-byte chunks of in as there are and
+ * returns their length. */
+__attribute__((target("avx2")))
+static size_t chacha_avx2(unsigned char *out, const unsigned char *in,
+			  size_t in_len, u32 input[16])
+	{
+	const __m256i rot16 = _mm256_setr_epi8(
+		2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+		2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+	const __m256i rot8 = _mm256_setr_epi8(
+		3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14,
+		3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14);
+	__m256i x[16], s[16];
+	size_t done = 0;
+	int i;
+
+	for (i = 0; i < 16; i++)
+		s[i] = _mm256_set1_epi32(input[i]);
+	s[12] = _mm256_add_epi32(s[12], _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+
+	for (; in_len - done >= 512; done += 512, in += 512, out += 512)
+		{
+		for (i = 0; i < 16; i++)
+			x[i] = s[i];
+		for (i = 0; i < 10; i++)
+			{
+			CHACHA_DOUBLEROUND(_mm256_add_epi32,_mm256_xor_si256,
+				AVX2_ROTL16,AVX2_ROTL12,AVX2_ROTL8,AVX2_ROTL7)
+			}
+		for (i = 0; i < 16; i++)
+			x[i] = _mm256_add_epi32(x[i], s[i]);
+		AVX2_TRANSPOSE(x[0], x[1], x[2], x[3]);
+		AVX2_TRANSPOSE(x[4], x[5], x[6], x[7]);
+		AVX2_TRANSPOSE(x[8], x[9], x[10], x[11]);
+		AVX2_TRANSPOSE(x[12], x[13], x[14], x[15]);
+		for (i = 0; i < 4; i++)
+			{
+			AVX2_STORE(i, 0x20, x[i], x[4 + i], x[8 + i], x[12 + i]);
+			AVX2_STORE(i + 4, 0x31, x[i], x[4 + i], x[8 + i], x[12 + i]);
+			}
+		s[12] = _mm256_add_epi32(s[12], _mm256_set1_epi32(8));
+		}
+	input[12] += (u32)(done / 64);
+	return done;
+	}
+
+#endif
+
+void CRYPTO_chacha_20(unsigned char *out,
+		      const unsigned char *in, size_t in_len,
+		      const unsigned char key[32],
+		      const unsigned char nonce[12],
+		      unsigned int counter)
+	{
+	u32 input[16];
+	unsigned char buf[64];
+	size_t todo, i;
+
+	input[0] = U8TO32_LITTLE(sigma + 0);
+	input[1] = U8TO32_LITTLE(sigma + 4);
+	input[2] = U8TO32_LITTLE(sigma + 8);
+	input[3] = U8TO32_LITTLE(sigma + 12);
+
+	for (i = 0; i < 8; i++)
+		input[4 + i] = U8TO32_LITTLE(key + 4 * i);
+
+	input[12] = counter;
+	input[13] = U8TO32_LITTLE(nonce + 0);
+	input[14] = U8TO32_LITTLE(nonce + 4);
+	input[15] = U8TO32_LITTLE(nonce + 8);
+
+#if defined(CHACHA_AVX2)
+	if (in_len >= 512 && (OPENSSL_ia32cap_P[2] & (1<<5)))	/* AVX2 */
+		{
+		todo = chacha_avx2(out, in, in_len, input);
+		out += todo;
+		in += todo;
+		in_len -= todo;
+		}
+#endif
+#if defined(CHACHA_SSE2)
+	if (in_len >= 256)
+		{
+		todo = chacha_vec4(out, in, in_len, input);
+		out += todo;
+		in += todo;
+		in_len -= todo;
+		}
+#endif
+
+	while (in_len > 0)
+		{
+		todo = sizeof(buf);
+		if (in_len < todo)
+			todo = in_len;
+
+		chacha_core(buf, input);
+		for (i = 0; i < todo; i++)
+			out[i] = in[i] ^ buf[i];
+
+		out += todo;
+		in += todo;
+		in_len -= todo;
+		input[12]++;
+		}
+	OPENSSL_cleanse(buf, sizeof(buf));
+	}
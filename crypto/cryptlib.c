@@ -665,7 +665,9 @@ const char *CRYPTO_get_lock_name(int type)
 	defined(__INTEL__) || \
 	defined(__x86_64) || defined(__x86_64__) || defined(_M_AMD64) || defined(_M_X64)
 
-unsigned int  OPENSSL_ia32cap_P[2];
+/* [0] and [1] are EDX and ECX of CPUID leaf 1, [2] is EBX of leaf 7
+ * (AVX2 #5, BMI2 #8, ADX #19, SHA #29), [3] is reserved */
+unsigned int  OPENSSL_ia32cap_P[4];
 unsigned long *OPENSSL_ia32cap_loc(void)
 {   if (sizeof(long)==4)
 	/*
@@ -684,27 +686,65 @@ typedef unsigned __int64 IA32CAP;
 #else
 typedef unsigned long long IA32CAP;
 #endif
+
+#if defined(__GNUC__) && (defined(__x86_64) || defined(__x86_64__) || defined(__i386) || defined(__i386__))
+#include <cpuid.h>
+static unsigned int ia32_cpuid_ext(void)
+{ unsigned int a,b,c,d;
+
+    if (__get_cpuid_max(0,NULL) < 7) return 0;
+    __cpuid_count(7,0,a,b,c,d);
+    return b;
+}
+#elif defined(_MSC_VER) && _MSC_VER>=1600
+#include <intrin.h>
+static unsigned int ia32_cpuid_ext(void)
+{ int r[4];
+
+    __cpuid(r,0);
+    if (r[0] < 7) return 0;
+    __cpuidex(r,7,0);
+    return (unsigned int)r[1];
+}
+#else
+static unsigned int ia32_cpuid_ext(void) { return 0; }
+#endif
+
 void OPENSSL_cpuid_setup(void)
 { static int trigger=0;
   IA32CAP OPENSSL_ia32_cpuid(void);
   IA32CAP vec;
+  unsigned int ext;
   char *env;
 
     if (trigger)	return;
 
     trigger=1;
+    ext = ia32_cpuid_ext();
     if ((env=getenv("OPENSSL_ia32cap"))) {
 	int off = (env[0]=='~')?1:0;
+	if (env[0]==':') vec = OPENSSL_ia32_cpuid();
+	else {
 #if defined(_WIN32)
 	if (!sscanf(env+off,"%I64i",&vec)) vec = strtoul(env+off,NULL,0);
 #else
 	if (!sscanf(env+off,"%lli",(long long *)&vec)) vec = strtoul(env+off,NULL,0);
 #endif
 	if (off) vec = OPENSSL_ia32_cpuid()&~vec;
+	}
+	/* "vec:ext" sets or, with "vec:~ext", masks the leaf 7 bits too */
+	if ((env=strchr(env,':'))) {
+	    off = (env[1]=='~')?1:0;
+	    if (off) ext &= ~(unsigned int)strtoul(env+2,NULL,0);
+	    else     ext = (unsigned int)strtoul(env+1,NULL,0);
+	}
     }
     else
 	vec = OPENSSL_ia32_cpuid();
 
+    /* AVX2 takes the YMM state OPENSSL_ia32_cpuid checks for AVX */
+    if (!(vec&((IA32CAP)1<<60))) ext &= ~(1U<<5);
+
     /*
      * |(1<<10) sets a reserved bit to signal that variable
      * was initialized already... This is to avoid interference
@@ -712,6 +752,7 @@ void OPENSSL_cpuid_setup(void)
      */
     OPENSSL_ia32cap_P[0] = (unsigned int)vec|(1<<10);
     OPENSSL_ia32cap_P[1] = (unsigned int)(vec>>32);
+    OPENSSL_ia32cap_P[2] = ext;
 }
 #endif
 
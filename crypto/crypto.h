@@ -460,6 +460,49 @@ struct CRYPTO_dynlock_value *(*CRYPTO_get_dynlock_create_callback(void))(const c
 void (*CRYPTO_get_dynlock_lock_callback(void))(int mode, struct CRYPTO_dynlock_value *l, const char *file,int line);
 void (*CRYPTO_get_dynlock_destroy_callback(void))(struct CRYPTO_dynlock_value *l, const char *file,int line);
 
+/* Built-in locking on POSIX threads with reader/writer locks, optionally
+ * counting acquisitions, waits and the time waited per lock id; see
+ * crypto/threads/lock_pthread.c. Setting up fails on other platforms. */
+#define CRYPTO_PTHREADS_LOCK_STATS	0x01
+typedef struct crypto_lock_stats_st
+	{
+	unsigned long read;		/* acquisitions for reading */
+	unsigned long write;		/* and for writing */
+	unsigned long contended;	/* of them, found the lock taken */
+	double wait;			/* seconds waited in all */
+	double max_wait;		/* longest wait */
+	} CRYPTO_LOCK_STATS;
+int CRYPTO_thread_setup_pthreads(int flags);
+void CRYPTO_thread_cleanup_pthreads(void);
+/* type < 0 is all dynamic locks together */
+int CRYPTO_lock_stats(int type, CRYPTO_LOCK_STATS *st);
+void CRYPTO_lock_stats_reset(void);
+#ifndef OPENSSL_NO_FP_API
+void CRYPTO_lock_stats_print_fp(FILE *fp);
+#endif
+void CRYPTO_lock_stats_print(struct bio_st *bio);
+
+/* Built-in allocator with per-thread caches of small blocks and arenas for
+ * short-lived ones; see crypto/mem_cache.c. CRYPTO_mem_cache_setup() has
+ * to come before anything is allocated and fails on platforms without
+ * POSIX threads. The counters stay zero when it is not installed. */
+typedef struct crypto_mem_stats_st
+	{
+	unsigned long allocs;		/* malloc and realloc calls */
+	unsigned long frees;
+	unsigned long bytes;		/* bytes asked for */
+	unsigned long cached;		/* allocations from a thread cache */
+	unsigned long arena;		/* and from an arena */
+	} CRYPTO_MEM_STATS;
+typedef struct crypto_mem_arena_st CRYPTO_MEM_ARENA;
+int CRYPTO_mem_cache_setup(void);
+void CRYPTO_mem_stats(CRYPTO_MEM_STATS *st);
+CRYPTO_MEM_ARENA *CRYPTO_mem_arena_new(void);
+void CRYPTO_mem_arena_free(CRYPTO_MEM_ARENA *arena);
+CRYPTO_MEM_ARENA *CRYPTO_mem_arena_switch(CRYPTO_MEM_ARENA *arena);
+void CRYPTO_mem_arena_stats(const CRYPTO_MEM_ARENA *arena,
+	CRYPTO_MEM_STATS *st);
+
 /* CRYPTO_set_mem_functions includes CRYPTO_set_locked_mem_functions --
  * call the latter last if you need different functions */
 int CRYPTO_set_mem_functions(void *(*m)(size_t),void *(*r)(void *,size_t), void (*f)(void *));
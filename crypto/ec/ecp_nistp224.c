@@ -285,7 +285,8 @@ static void bin28_to_felem(felem out, const u8 in[28])
 	out[0] = *((const uint64_t *)(in)) & 0x00ffffffffffffff;
 	out[1] = (*((const uint64_t *)(in+7))) & 0x00ffffffffffffff;
 	out[2] = (*((const uint64_t *)(in+14))) & 0x00ffffffffffffff;
-	out[3] = (*((const uint64_t *)(in+21))) & 0x00ffffffffffffff;
+	/* The last word starts a byte early so as not to read past in[27] */
+	out[3] = (*((const uint64_t *)(in+20))) >> 8;
 	}
 
 static void felem_to_bin28(u8 out[28], const felem in)
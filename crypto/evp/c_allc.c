@@ -103,6 +103,13 @@ void OpenSSL_add_all_ciphers(void)
 #endif
 #endif
 
+#ifndef OPENSSL_NO_CHACHA
+	EVP_add_cipher(EVP_chacha20());
+#ifndef OPENSSL_NO_POLY1305
+	EVP_add_cipher(EVP_chacha20_poly1305());
+#endif
+#endif
+
 #ifndef OPENSSL_NO_IDEA
 	EVP_add_cipher(EVP_idea_ecb());
 	EVP_add_cipher(EVP_idea_cfb());
@@ -270,6 +270,86 @@ static int aesni_cbc_cipher(EVP_CIPHER_CTX *ctx,unsigned char *out,
 	return 1;
 }
 
+#if	defined(__x86_64)	|| defined(__x86_64__)	|| \
+	defined(_M_AMD64)	|| defined(_M_X64)
+typedef struct
+	{
+	const unsigned char *inp;
+	unsigned char *out;
+	const AES_KEY *key;
+	unsigned char iv[16];
+	} AESNI_CBC_LANE;
+
+void aesni_multi_cbc_encrypt(AESNI_CBC_LANE lane[4], size_t blocks);
+
+/* Encrypt up to four CBC buffers interleaved. Lanes are trimmed to the
+ * shortest one, the remainders are done one by one. Unused lanes of the
+ * 4-lane subroutine duplicate the last used one. */
+static int aesni_cbc_multi(EVP_CIPHER_LANE *lanes, int n)
+	{
+	AESNI_CBC_LANE mb[4];
+	size_t blocks, done;
+	int i;
+
+	blocks = lanes[0].len / AES_BLOCK_SIZE;
+	for (i = 1; i < n; i++)
+		if (lanes[i].len / AES_BLOCK_SIZE < blocks)
+			blocks = lanes[i].len / AES_BLOCK_SIZE;
+
+	for (i = 0; i < 4; i++)
+		{
+		EVP_CIPHER_LANE *l = &lanes[i < n ? i : n - 1];
+
+		mb[i].inp = l->in;
+		mb[i].out = l->out;
+		mb[i].key = &((EVP_AES_KEY *)l->ctx->cipher_data)->ks;
+		memcpy(mb[i].iv, l->ctx->iv, AES_BLOCK_SIZE);
+		}
+	aesni_multi_cbc_encrypt(mb, blocks);
+
+	done = blocks * AES_BLOCK_SIZE;
+	for (i = 0; i < n; i++)
+		{
+		memcpy(lanes[i].ctx->iv, mb[i].iv, AES_BLOCK_SIZE);
+		if (lanes[i].len > done)
+			aesni_cbc_encrypt(lanes[i].in + done, lanes[i].out + done,
+				lanes[i].len - done, mb[i].key,
+				lanes[i].ctx->iv, 1);
+		}
+	return 1;
+	}
+
+static int aesni_cbc_ctrl(EVP_CIPHER_CTX *c, int type, int arg, void *ptr)
+	{
+	EVP_CIPHER_LANE *lanes = ptr;
+	int i, n;
+
+	if (type != EVP_CTRL_MULTI_LANE_ENCRYPT)
+		return -1;
+
+	for (i = 0; i < arg; i++)
+		if (!lanes[i].ctx->encrypt ||
+		    lanes[i].ctx->cipher != c->cipher ||
+		    lanes[i].len % AES_BLOCK_SIZE)
+			return -1;
+
+	for (i = 0; i < arg; i += n)
+		{
+		n = arg - i > 4 ? 4 : arg - i;
+		if (n == 1)
+			aesni_cbc_cipher(lanes[i].ctx, lanes[i].out,
+				lanes[i].in, lanes[i].len);
+		else
+			aesni_cbc_multi(&lanes[i], n);
+		}
+	return 1;
+	}
+#define AESNI_CBC_FLAGS		EVP_CIPH_FLAG_MULTI_LANE
+#else
+#define aesni_cbc_ctrl		NULL
+#define AESNI_CBC_FLAGS		0
+#endif
+
 static int aesni_ecb_cipher(EVP_CIPHER_CTX *ctx,unsigned char *out,
 	const unsigned char *in, size_t len)
 {
@@ -434,6 +514,29 @@ static const EVP_CIPHER aes_##keylen##_##mode = { \
 const EVP_CIPHER *EVP_aes_##keylen##_##mode(void) \
 { return AESNI_CAPABLE?&aesni_##keylen##_##mode:&aes_##keylen##_##mode; }
 
+/* Same as BLOCK_CIPHER_generic, but AES-NI flavour gets mode specific
+ * flags and ctrl, e.g. for multi-lane CBC */
+#define BLOCK_CIPHER_multi(nid,keylen,blocksize,ivlen,nmode,mode,MODE,flags) \
+static const EVP_CIPHER aesni_##keylen##_##mode = { \
+	nid##_##keylen##_##nmode,blocksize,keylen/8,ivlen, \
+	flags|AESNI_##MODE##_FLAGS|EVP_CIPH_##MODE##_MODE,	\
+	aesni_init_key,			\
+	aesni_##mode##_cipher,		\
+	NULL,				\
+	sizeof(EVP_AES_KEY),		\
+	NULL,NULL,aesni_##mode##_ctrl,NULL }; \
+static const EVP_CIPHER aes_##keylen##_##mode = { \
+	nid##_##keylen##_##nmode,blocksize,	\
+	keylen/8,ivlen, \
+	flags|EVP_CIPH_##MODE##_MODE,	\
+	aes_init_key,			\
+	aes_##mode##_cipher,		\
+	NULL,				\
+	sizeof(EVP_AES_KEY),		\
+	NULL,NULL,NULL,NULL }; \
+const EVP_CIPHER *EVP_aes_##keylen##_##mode(void) \
+{ return AESNI_CAPABLE?&aesni_##keylen##_##mode:&aes_##keylen##_##mode; }
+
 #define BLOCK_CIPHER_custom(nid,keylen,blocksize,ivlen,mode,MODE,flags) \
 static const EVP_CIPHER aesni_##keylen##_##mode = { \
 	nid##_##keylen##_##mode,blocksize, \
@@ -482,10 +585,12 @@ static const EVP_CIPHER aes_##keylen##_##mode = { \
 	NULL,NULL,aes_##mode##_ctrl,NULL }; \
 const EVP_CIPHER *EVP_aes_##keylen##_##mode(void) \
 { return &aes_##keylen##_##mode; }
+
+#define BLOCK_CIPHER_multi BLOCK_CIPHER_generic
 #endif
 
 #define BLOCK_CIPHER_generic_pack(nid,keylen,flags)		\
-	BLOCK_CIPHER_generic(nid,keylen,16,16,cbc,cbc,CBC,flags|EVP_CIPH_FLAG_DEFAULT_ASN1)	\
+	BLOCK_CIPHER_multi(nid,keylen,16,16,cbc,cbc,CBC,flags|EVP_CIPH_FLAG_DEFAULT_ASN1)	\
 	BLOCK_CIPHER_generic(nid,keylen,16,0,ecb,ecb,ECB,flags|EVP_CIPH_FLAG_DEFAULT_ASN1)	\
 	BLOCK_CIPHER_generic(nid,keylen,1,16,ofb128,ofb,OFB,flags|EVP_CIPH_FLAG_DEFAULT_ASN1)	\
 	BLOCK_CIPHER_generic(nid,keylen,1,16,cfb128,cfb,CFB,flags|EVP_CIPH_FLAG_DEFAULT_ASN1)	\
@@ -0,0 +1,395 @@
+/* crypto/evp/e_chacha20_poly1305.c */
+/*
+ * ChaCha20 and the ChaCha20-Poly1305 AEAD (RFC 7539) as EVP ciphers.
+ *
+ * EVP_chacha20() takes a 16-byte IV made of the little-endian initial
+ * block counter followed by the 96-bit nonce.
+ *
+ * EVP_chacha20_poly1305() takes a 12-byte nonce and is used like the GCM
+ * ciphers: EVP_Cipher() with out == NULL adds AAD, in == NULL finishes
+ * the message, and the tag is read and set with EVP_CTRL_AEAD_GET_TAG and
+ * EVP_CTRL_AEAD_SET_TAG. After EVP_CTRL_AEAD_TLS1_AAD the next call
+ * processes a whole TLS record in place as in RFC 7905: the nonce is the
+ * IV from the key block XORed with the sequence number, and the tag
+ * follows the payload.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <openssl/opensslconf.h>
+
+#ifndef OPENSSL_NO_CHACHA
+
+#include <openssl/evp.h>
+#include <openssl/objects.h>
+#include <openssl/crypto.h>
+#include <openssl/chacha.h>
+#ifndef OPENSSL_NO_POLY1305
+#include <openssl/poly1305.h>
+#endif
+
+/* A ChaCha20 key stream that can be consumed in pieces of any size. */
+typedef struct
+	{
+	unsigned char key[32];
+	unsigned char nonce[12];
+	unsigned int counter;		/* block after buf */
+	unsigned char buf[64];		/* key stream of the last block */
+	unsigned int used;		/* bytes of buf consumed, 64 if none left */
+	} EVP_CHACHA_KEY;
+
+static void chacha_stream_start(EVP_CHACHA_KEY *ck, unsigned int counter)
+	{
+	ck->counter = counter;
+	ck->used = sizeof(ck->buf);
+	}
+
+static void chacha_stream_xor(EVP_CHACHA_KEY *ck, unsigned char *out,
+			      const unsigned char *in, size_t len)
+	{
+	size_t n;
+
+	while (len && ck->used < sizeof(ck->buf))
+		{
+		*out++ = *in++ ^ ck->buf[ck->used++];
+		len--;
+		}
+
+	n = len & ~(size_t)63;
+	if (n)
+		{
+		CRYPTO_chacha_20(out, in, n, ck->key, ck->nonce, ck->counter);
+		ck->counter += (unsigned int)(n / 64);
+		out += n;
+		in += n;
+		len -= n;
+		}
+
+	if (len)
+		{
+		memset(ck->buf, 0, sizeof(ck->buf));
+		CRYPTO_chacha_20(ck->buf, ck->buf, sizeof(ck->buf),
+				 ck->key, ck->nonce, ck->counter++);
+		for (ck->used = 0; ck->used < len; ck->used++)
+			out[ck->used] = in[ck->used] ^ ck->buf[ck->used];
+		}
+	}
+
+static int chacha_init_key(EVP_CIPHER_CTX *ctx, const unsigned char *key,
+			   const unsigned char *iv, int enc)
+	{
+	EVP_CHACHA_KEY *ck = ctx->cipher_data;
+
+	if (key)
+		memcpy(ck->key, key, sizeof(ck->key));
+	if (iv)
+		{
+		memcpy(ck->nonce, iv + 4, sizeof(ck->nonce));
+		chacha_stream_start(ck, (unsigned int)iv[0] |
+				    ((unsigned int)iv[1] << 8) |
+				    ((unsigned int)iv[2] << 16) |
+				    ((unsigned int)iv[3] << 24));
+		}
+	return 1;
+	}
+
+static int chacha_cipher(EVP_CIPHER_CTX *ctx, unsigned char *out,
+			 const unsigned char *in, size_t len)
+	{
+	chacha_stream_xor(ctx->cipher_data, out, in, len);
+	return 1;
+	}
+
+static const EVP_CIPHER chacha20_cipher =
+	{
+	NID_chacha20,
+	1,32,16,
+	EVP_CIPH_STREAM_CIPHER|EVP_CIPH_CUSTOM_IV|EVP_CIPH_ALWAYS_CALL_INIT,
+	chacha_init_key,
+	chacha_cipher,
+	NULL,
+	sizeof(EVP_CHACHA_KEY),
+	NULL,
+	NULL,
+	NULL,
+	NULL
+	};
+
+const EVP_CIPHER *EVP_chacha20(void)
+	{
+	return(&chacha20_cipher);
+	}
+
+#ifndef OPENSSL_NO_POLY1305
+
+typedef struct
+	{
+	EVP_CHACHA_KEY ks;
+	unsigned char iv[12];		/* nonce, or TLS fixed IV */
+	poly1305_state poly;
+	size_t aad_len, text_len;
+	int key_set, iv_set;
+	int nonce_set;			/* MAC set up for the current nonce */
+	int text_started;		/* AAD has been padded */
+	int tag_len;			/* -1 if there is no tag */
+	unsigned char tag[16];
+	int tls_aad_len;		/* -1 if not processing a TLS record */
+	unsigned char tls_aad[13];
+	} EVP_CHACHA_AEAD_CTX;
+
+static const unsigned char zero_pad[16];
+
+/* chacha_aead_start sets up a new message under nonce, using the first
+ * block of key stream as the Poly1305 key. */
+static void chacha_aead_start(EVP_CHACHA_AEAD_CTX *actx,
+			      const unsigned char nonce[12])
+	{
+	unsigned char otk[32];
+
+	memset(otk, 0, sizeof(otk));
+	memcpy(actx->ks.nonce, nonce, sizeof(actx->ks.nonce));
+	CRYPTO_chacha_20(otk, otk, sizeof(otk), actx->ks.key, actx->ks.nonce, 0);
+	CRYPTO_poly1305_init(&actx->poly, otk);
+	OPENSSL_cleanse(otk, sizeof(otk));
+	chacha_stream_start(&actx->ks, 1);
+	actx->aad_len = 0;
+	actx->text_len = 0;
+	actx->text_started = 0;
+	actx->nonce_set = 1;
+	}
+
+static void chacha_aead_pad(EVP_CHACHA_AEAD_CTX *actx, size_t len)
+	{
+	if (len % 16)
+		CRYPTO_poly1305_update(&actx->poly, zero_pad, 16 - len % 16);
+	}
+
+static void chacha_aead_finish(EVP_CHACHA_AEAD_CTX *actx, unsigned char tag[16])
+	{
+	unsigned char lens[16];
+	size_t n;
+	int i;
+
+	if (!actx->text_started)
+		chacha_aead_pad(actx, actx->aad_len);
+	chacha_aead_pad(actx, actx->text_len);
+	for (i = 0, n = actx->aad_len; i < 8; i++, n >>= 8)
+		lens[i] = (unsigned char)n;
+	for (i = 8, n = actx->text_len; i < 16; i++, n >>= 8)
+		lens[i] = (unsigned char)n;
+	CRYPTO_poly1305_update(&actx->poly, lens, sizeof(lens));
+	CRYPTO_poly1305_finish(&actx->poly, tag);
+	actx->nonce_set = 0;
+	}
+
+static void chacha_aead_text(EVP_CHACHA_AEAD_CTX *actx, int enc,
+			     unsigned char *out, const unsigned char *in,
+			     size_t len)
+	{
+	if (!actx->text_started)
+		{
+		chacha_aead_pad(actx, actx->aad_len);
+		actx->text_started = 1;
+		}
+	if (enc)
+		{
+		chacha_stream_xor(&actx->ks, out, in, len);
+		CRYPTO_poly1305_update(&actx->poly, out, len);
+		}
+	else
+		{
+		CRYPTO_poly1305_update(&actx->poly, in, len);
+		chacha_stream_xor(&actx->ks, out, in, len);
+		}
+	actx->text_len += len;
+	}
+
+static int chacha_aead_init_key(EVP_CIPHER_CTX *ctx, const unsigned char *key,
+				const unsigned char *iv, int enc)
+	{
+	EVP_CHACHA_AEAD_CTX *actx = ctx->cipher_data;
+
+	if (!iv && !key)
+		return 1;
+	if (key)
+		{
+		memcpy(actx->ks.key, key, sizeof(actx->ks.key));
+		actx->key_set = 1;
+		}
+	if (iv)
+		{
+		memcpy(actx->iv, iv, sizeof(actx->iv));
+		actx->iv_set = 1;
+		}
+	if (actx->key_set && actx->iv_set)
+		chacha_aead_start(actx, actx->iv);
+	return 1;
+	}
+
+static int chacha_aead_tls_cipher(EVP_CIPHER_CTX *ctx, unsigned char *out,
+				  const unsigned char *in, size_t len)
+	{
+	EVP_CHACHA_AEAD_CTX *actx = ctx->cipher_data;
+	unsigned char nonce[12], tag[16];
+	int i, rv = -1;
+
+	if (out != in || len < EVP_CHACHAPOLY_TLS_TAG_LEN)
+		goto err;
+	len -= EVP_CHACHAPOLY_TLS_TAG_LEN;
+
+	/* The nonce is the fixed IV XORed with the sequence number. */
+	memcpy(nonce, actx->iv, sizeof(nonce));
+	for (i = 0; i < 8; i++)
+		nonce[4 + i] ^= actx->tls_aad[i];
+	chacha_aead_start(actx, nonce);
+
+	CRYPTO_poly1305_update(&actx->poly, actx->tls_aad, actx->tls_aad_len);
+	actx->aad_len = actx->tls_aad_len;
+	if (ctx->encrypt)
+		{
+		chacha_aead_text(actx, 1, out, in, len);
+		chacha_aead_finish(actx, out + len);
+		rv = len + EVP_CHACHAPOLY_TLS_TAG_LEN;
+		}
+	else
+		{
+		/* Check the tag before decrypting anything. */
+		chacha_aead_pad(actx, actx->aad_len);
+		actx->text_started = 1;
+		CRYPTO_poly1305_update(&actx->poly, in, len);
+		actx->text_len = len;
+		chacha_aead_finish(actx, tag);
+		if (CRYPTO_memcmp(tag, in + len, EVP_CHACHAPOLY_TLS_TAG_LEN))
+			goto err;
+		chacha_stream_xor(&actx->ks, out, in, len);
+		rv = len;
+		}
+
+err:
+	actx->tls_aad_len = -1;
+	return rv;
+	}
+
+static int chacha_aead_cipher(EVP_CIPHER_CTX *ctx, unsigned char *out,
+			      const unsigned char *in, size_t len)
+	{
+	EVP_CHACHA_AEAD_CTX *actx = ctx->cipher_data;
+
+	if (!actx->key_set)
+		return -1;
+	if (actx->tls_aad_len >= 0)
+		return chacha_aead_tls_cipher(ctx, out, in, len);
+	if (!actx->nonce_set)
+		return -1;
+
+	if (in)
+		{
+		if (out == NULL)
+			{
+			if (actx->text_started)
+				return -1;
+			CRYPTO_poly1305_update(&actx->poly, in, len);
+			actx->aad_len += len;
+			}
+		else
+			chacha_aead_text(actx, ctx->encrypt, out, in, len);
+		return len;
+		}
+
+	if (ctx->encrypt)
+		{
+		chacha_aead_finish(actx, actx->tag);
+		actx->tag_len = 16;
+		return 0;
+		}
+	else
+		{
+		unsigned char tag[16];
+
+		if (actx->tag_len < 0)
+			return -1;
+		chacha_aead_finish(actx, tag);
+		if (CRYPTO_memcmp(tag, actx->tag, actx->tag_len))
+			return -1;
+		return 0;
+		}
+	}
+
+static int chacha_aead_ctrl(EVP_CIPHER_CTX *ctx, int type, int arg, void *ptr)
+	{
+	EVP_CHACHA_AEAD_CTX *actx = ctx->cipher_data;
+
+	switch (type)
+		{
+	case EVP_CTRL_INIT:
+		actx->key_set = 0;
+		actx->iv_set = 0;
+		actx->nonce_set = 0;
+		actx->tag_len = -1;
+		actx->tls_aad_len = -1;
+		return 1;
+
+	case EVP_CTRL_AEAD_SET_IVLEN:
+		return arg == 12;
+
+	case EVP_CTRL_AEAD_SET_TAG:
+		if (arg <= 0 || arg > 16 || ctx->encrypt)
+			return 0;
+		memcpy(actx->tag, ptr, arg);
+		actx->tag_len = arg;
+		return 1;
+
+	case EVP_CTRL_AEAD_GET_TAG:
+		if (arg <= 0 || arg > 16 || !ctx->encrypt || actx->tag_len < 0)
+			return 0;
+		memcpy(ptr, actx->tag, arg);
+		return 1;
+
+	case EVP_CTRL_AEAD_TLS1_AAD:
+		if (arg != sizeof(actx->tls_aad))
+			return 0;
+		memcpy(actx->tls_aad, ptr, arg);
+		if (!ctx->encrypt)
+			{
+			unsigned int len = actx->tls_aad[arg-2] << 8 |
+					   actx->tls_aad[arg-1];
+
+			/* Correct the length for the tag */
+			if (len < EVP_CHACHAPOLY_TLS_TAG_LEN)
+				return 0;
+			len -= EVP_CHACHAPOLY_TLS_TAG_LEN;
+			actx->tls_aad[arg-2] = len >> 8;
+			actx->tls_aad[arg-1] = len & 0xff;
+			}
+		actx->tls_aad_len = arg;
+		return EVP_CHACHAPOLY_TLS_TAG_LEN;
+
+	default:
+		return -1;
+		}
+	}
+
+static const EVP_CIPHER chacha20_poly1305_cipher =
+	{
+	NID_chacha20_poly1305,
+	1,32,12,
+	EVP_CIPH_STREAM_CIPHER|EVP_CIPH_FLAG_AEAD_CIPHER|
+	EVP_CIPH_FLAG_CUSTOM_CIPHER|EVP_CIPH_CUSTOM_IV|
+	EVP_CIPH_ALWAYS_CALL_INIT|EVP_CIPH_CTRL_INIT,
+	chacha_aead_init_key,
+	chacha_aead_cipher,
+	NULL,
+	sizeof(EVP_CHACHA_AEAD_CTX),
+	NULL,
+	NULL,
+	chacha_aead_ctrl,
+	NULL
+	};
+
+const EVP_CIPHER *EVP_chacha20_poly1305(void)
+	{
+	return(&chacha20_poly1305_cipher);
+	}
+
+#endif
+#endif
@@ -365,6 +365,9 @@ struct evp_cipher_st
  */
 #define 	EVP_CIPH_FLAG_CUSTOM_CIPHER	0x100000
 #define		EVP_CIPH_FLAG_AEAD_CIPHER	0x200000
+/* Cipher can encrypt several independent buffers at once, see
+ * EVP_Cipher_multi() */
+#define		EVP_CIPH_FLAG_MULTI_LANE	0x400000
 
 /* ctrl() values */
 
@@ -387,6 +390,9 @@ struct evp_cipher_st
 #define		EVP_CTRL_CCM_SET_TAG		EVP_CTRL_GCM_SET_TAG
 #define		EVP_CTRL_CCM_SET_L		0x14
 #define		EVP_CTRL_CCM_SET_MSGLEN		0x15
+#define		EVP_CTRL_AEAD_SET_IVLEN		EVP_CTRL_GCM_SET_IVLEN
+#define		EVP_CTRL_AEAD_GET_TAG		EVP_CTRL_GCM_GET_TAG
+#define		EVP_CTRL_AEAD_SET_TAG		EVP_CTRL_GCM_SET_TAG
 /* AEAD cipher deduces payload length and returns number of bytes
  * required to store MAC and eventual padding. Subsequent call to
  * EVP_Cipher even appends/verifies MAC.
@@ -396,6 +402,8 @@ struct evp_cipher_st
 #define		EVP_CTRL_AEAD_SET_MAC_KEY	0x17
 /* Set the GCM invocation field, decrypt only */
 #define		EVP_CTRL_GCM_SET_IV_INV		0x18
+/* Encrypt arg EVP_CIPHER_LANEs pointed to by ptr in one go */
+#define		EVP_CTRL_MULTI_LANE_ENCRYPT	0x19
 
 /* GCM TLS constants */
 /* Length of fixed part of IV derived from PRF */
@@ -405,6 +413,18 @@ struct evp_cipher_st
 /* Length of tag for TLS */
 #define EVP_GCM_TLS_TAG_LEN				16
 
+/* Length of the ChaCha20-Poly1305 tag in TLS records */
+#define EVP_CHACHAPOLY_TLS_TAG_LEN			16
+
+/* One buffer of a multi-lane operation, see EVP_Cipher_multi() */
+typedef struct evp_cipher_lane_st
+	{
+	EVP_CIPHER_CTX *ctx;
+	unsigned char *out;
+	const unsigned char *in;
+	size_t len;
+	} EVP_CIPHER_LANE;
+
 typedef struct evp_cipher_info_st
 	{
 	const EVP_CIPHER *cipher;
@@ -538,6 +558,7 @@ int EVP_Cipher(EVP_CIPHER_CTX *c,
 		unsigned char *out,
 		const unsigned char *in,
 		unsigned int inl);
+int EVP_Cipher_multi(EVP_CIPHER_LANE *lanes, int n);
 
 #define EVP_add_cipher_alias(n,alias) \
 	OBJ_NAME_add((alias),OBJ_NAME_TYPE_CIPHER_METH|OBJ_NAME_ALIAS,(n))
@@ -745,6 +766,12 @@ const EVP_CIPHER *EVP_rc4_40(void);
 const EVP_CIPHER *EVP_rc4_hmac_md5(void);
 #endif
 #endif
+#ifndef OPENSSL_NO_CHACHA
+const EVP_CIPHER *EVP_chacha20(void);
+#ifndef OPENSSL_NO_POLY1305
+const EVP_CIPHER *EVP_chacha20_poly1305(void);
+#endif
+#endif
 #ifndef OPENSSL_NO_IDEA
 const EVP_CIPHER *EVP_idea_ecb(void);
 const EVP_CIPHER *EVP_idea_cfb64(void);
@@ -193,6 +193,31 @@ int EVP_Cipher(EVP_CIPHER_CTX *ctx, unsigned char *out, const unsigned char *in,
 	return ctx->cipher->do_cipher(ctx,out,in,inl);
 	}
 
+/* Equivalent to calling EVP_Cipher() on every lane in turn. Consecutive
+ * lanes encrypting with the same cipher are handed to the cipher in one
+ * go if it can interleave them. */
+int EVP_Cipher_multi(EVP_CIPHER_LANE *lanes, int n)
+	{
+	const EVP_CIPHER *c;
+	int i, j;
+
+	for (i = 0; i < n; i = j)
+		{
+		c = lanes[i].ctx->cipher;
+		for (j = i + 1; j < n && lanes[j].ctx->cipher == c; j++)
+			;
+		if (j - i > 1 && (c->flags & EVP_CIPH_FLAG_MULTI_LANE) &&
+		    c->ctrl(lanes[i].ctx, EVP_CTRL_MULTI_LANE_ENCRYPT,
+				j - i, &lanes[i]) > 0)
+			continue;
+		for (; i < j; i++)
+			if (c->do_cipher(lanes[i].ctx, lanes[i].out,
+					lanes[i].in, lanes[i].len) <= 0)
+				return 0;
+		}
+	return 1;
+	}
+
 const EVP_CIPHER *EVP_CIPHER_CTX_cipher(const EVP_CIPHER_CTX *ctx)
 	{
 	return ctx->cipher;
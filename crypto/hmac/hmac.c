@@ -60,6 +60,15 @@
 #include <string.h>
 #include "cryptlib.h"
 #include <openssl/hmac.h>
+#ifndef OPENSSL_NO_ENGINE
+#include <openssl/engine.h>
+#endif
+#ifndef OPENSSL_NO_MD5
+#include <openssl/md5.h>
+#endif
+#ifndef OPENSSL_NO_SHA
+#include <openssl/sha.h>
+#endif
 
 #ifdef OPENSSL_FIPS
 #include <openssl/fips.h>
@@ -249,3 +258,218 @@ void HMAC_CTX_set_flags(HMAC_CTX *ctx, unsigned long flags)
 	EVP_MD_CTX_set_flags(&ctx->o_ctx, flags);
 	EVP_MD_CTX_set_flags(&ctx->md_ctx, flags);
 	}
+
+/* The precomputed-key HMAC below drives the digests' own Init/Update/Final
+ * functions directly; HMAC_precomp_md_supported() says which. The digest
+ * state in an HMAC_MD_STATE is one of these. */
+typedef union hmac_digest_state_un
+	{
+#ifndef OPENSSL_NO_MD5
+	MD5_CTX md5;
+#endif
+#ifndef OPENSSL_NO_SHA
+	SHA_CTX sha1;
+#endif
+#ifndef OPENSSL_NO_SHA256
+	SHA256_CTX sha256;
+#endif
+#ifndef OPENSSL_NO_SHA512
+	SHA512_CTX sha512;
+#endif
+	int dummy;
+	} HMAC_DIGEST_STATE;
+
+/* Fails to compile if HMAC_MD_STATE_SIZE is too small. */
+typedef char hmac_md_state_size_check[
+	sizeof(HMAC_DIGEST_STATE) <= HMAC_MD_STATE_SIZE ? 1 : -1];
+
+/* The built-in EVP_MD of a supported digest, NULL if there is none. */
+static const EVP_MD *hmac_builtin_md(int type)
+	{
+	switch (type)
+		{
+#ifndef OPENSSL_NO_MD5
+	case NID_md5:	 return EVP_md5();
+#endif
+#ifndef OPENSSL_NO_SHA
+	case NID_sha1:	 return EVP_sha1();
+#endif
+#ifndef OPENSSL_NO_SHA256
+	case NID_sha224: return EVP_sha224();
+	case NID_sha256: return EVP_sha256();
+#endif
+#ifndef OPENSSL_NO_SHA512
+	case NID_sha384: return EVP_sha384();
+	case NID_sha512: return EVP_sha512();
+#endif
+	default:	 return NULL;
+		}
+	}
+
+/* Only the built-in digests qualify, and only while no ENGINE is the
+ * default for them: HMAC_CTX and the TLS MAC would use the ENGINE's. */
+int HMAC_precomp_md_supported(const EVP_MD *md)
+	{
+#ifndef OPENSSL_NO_ENGINE
+	ENGINE *e;
+#endif
+
+	if (md == NULL || md != hmac_builtin_md(EVP_MD_type(md)))
+		return 0;
+#ifndef OPENSSL_NO_ENGINE
+	if ((e = ENGINE_get_digest_engine(EVP_MD_type(md))) != NULL)
+		{
+		ENGINE_finish(e);
+		return 0;
+		}
+#endif
+	return EVP_MD_block_size(md) <= HMAC_MAX_MD_CBLOCK;
+	}
+
+static void hmac_md_init(int type, HMAC_MD_STATE *ms)
+	{
+	HMAC_DIGEST_STATE *st = (HMAC_DIGEST_STATE *)ms;
+
+	switch (type)
+		{
+#ifndef OPENSSL_NO_MD5
+	case NID_md5:	 MD5_Init(&st->md5); break;
+#endif
+#ifndef OPENSSL_NO_SHA
+	case NID_sha1:	 SHA1_Init(&st->sha1); break;
+#endif
+#ifndef OPENSSL_NO_SHA256
+	case NID_sha224: SHA224_Init(&st->sha256); break;
+	case NID_sha256: SHA256_Init(&st->sha256); break;
+#endif
+#ifndef OPENSSL_NO_SHA512
+	case NID_sha384: SHA384_Init(&st->sha512); break;
+	case NID_sha512: SHA512_Init(&st->sha512); break;
+#endif
+		}
+	}
+
+static void hmac_md_update(int type, HMAC_MD_STATE *ms,
+			   const unsigned char *data, size_t len)
+	{
+	HMAC_DIGEST_STATE *st = (HMAC_DIGEST_STATE *)ms;
+
+	switch (type)
+		{
+#ifndef OPENSSL_NO_MD5
+	case NID_md5:	 MD5_Update(&st->md5, data, len); break;
+#endif
+#ifndef OPENSSL_NO_SHA
+	case NID_sha1:	 SHA1_Update(&st->sha1, data, len); break;
+#endif
+#ifndef OPENSSL_NO_SHA256
+	case NID_sha224:
+	case NID_sha256: SHA256_Update(&st->sha256, data, len); break;
+#endif
+#ifndef OPENSSL_NO_SHA512
+	case NID_sha384:
+	case NID_sha512: SHA512_Update(&st->sha512, data, len); break;
+#endif
+		}
+	}
+
+/* SHA224_Final and SHA384_Final are the SHA-256 and SHA-512 ones; the
+ * output length was recorded by the Init function. */
+static void hmac_md_final(int type, HMAC_MD_STATE *ms, unsigned char *md)
+	{
+	HMAC_DIGEST_STATE *st = (HMAC_DIGEST_STATE *)ms;
+
+	switch (type)
+		{
+#ifndef OPENSSL_NO_MD5
+	case NID_md5:	 MD5_Final(md, &st->md5); break;
+#endif
+#ifndef OPENSSL_NO_SHA
+	case NID_sha1:	 SHA1_Final(md, &st->sha1); break;
+#endif
+#ifndef OPENSSL_NO_SHA256
+	case NID_sha224:
+	case NID_sha256: SHA256_Final(md, &st->sha256); break;
+#endif
+#ifndef OPENSSL_NO_SHA512
+	case NID_sha384:
+	case NID_sha512: SHA512_Final(md, &st->sha512); break;
+#endif
+		}
+	}
+
+/* Set up |key| for HMAC with |md| under |secret|. Returns 0 if |md| is not
+ * supported, see HMAC_precomp_md_supported(), in which case the caller has
+ * to use HMAC_CTX instead. */
+int HMAC_precompute(HMAC_PRECOMP *key, const void *secret, int len,
+		    const EVP_MD *md)
+	{
+	unsigned char k[HMAC_MAX_MD_CBLOCK], pad[HMAC_MAX_MD_CBLOCK];
+	unsigned int klen;
+	int i, bs;
+
+#ifdef OPENSSL_FIPS
+	if (FIPS_mode())
+		return 0;
+#endif
+	if (len < 0 || !HMAC_precomp_md_supported(md))
+		return 0;
+	bs = EVP_MD_block_size(md);
+	if (len > bs)
+		{
+		if (!EVP_Digest(secret, len, k, &klen, md, NULL))
+			return 0;
+		}
+	else
+		{
+		memcpy(k, secret, len);
+		klen = len;
+		}
+	memset(k + klen, 0, sizeof(k) - klen);
+
+	key->type = EVP_MD_type(md);
+	key->md_size = EVP_MD_size(md);
+	for (i = 0; i < bs; i++)
+		pad[i] = 0x36 ^ k[i];
+	hmac_md_init(key->type, &key->i_state);
+	hmac_md_update(key->type, &key->i_state, pad, bs);
+	for (i = 0; i < bs; i++)
+		pad[i] = 0x5c ^ k[i];
+	hmac_md_init(key->type, &key->o_state);
+	hmac_md_update(key->type, &key->o_state, pad, bs);
+
+	OPENSSL_cleanse(k, sizeof(k));
+	OPENSSL_cleanse(pad, sizeof(pad));
+	return 1;
+	}
+
+void HMAC_PRECOMP_cleanup(HMAC_PRECOMP *key)
+	{
+	OPENSSL_cleanse(key, sizeof(*key));
+	}
+
+void HMAC_precomp_Init(HMAC_PRECOMP_CTX *ctx, const HMAC_PRECOMP *key)
+	{
+	ctx->key = key;
+	ctx->state = key->i_state;
+	}
+
+void HMAC_precomp_Update(HMAC_PRECOMP_CTX *ctx, const unsigned char *data,
+			 size_t len)
+	{
+	hmac_md_update(ctx->key->type, &ctx->state, data, len);
+	}
+
+/* Writes key->md_size bytes to |md| and wipes |ctx|. */
+void HMAC_precomp_Final(HMAC_PRECOMP_CTX *ctx, unsigned char *md)
+	{
+	const HMAC_PRECOMP *key = ctx->key;
+	unsigned char buf[EVP_MAX_MD_SIZE];
+
+	hmac_md_final(key->type, &ctx->state, buf);
+	ctx->state = key->o_state;
+	hmac_md_update(key->type, &ctx->state, buf, key->md_size);
+	hmac_md_final(key->type, &ctx->state, md);
+	OPENSSL_cleanse(buf, sizeof(buf));
+	OPENSSL_cleanse(ctx, sizeof(*ctx));
+	}
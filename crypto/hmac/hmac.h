@@ -84,6 +84,35 @@ typedef struct hmac_ctx_st
 
 #define HMAC_size(e)	(EVP_MD_size((e)->md))
 
+/* A key whose inner and outer pads have already been through the
+ * compression function. Starting a message is a structure copy of a
+ * digest state, so per-message HMACs neither allocate nor go through EVP.
+ * Only the built-in MD5, SHA-1 and SHA-2 are supported. The digest states
+ * are private to hmac.c. */
+#define HMAC_MD_STATE_SIZE	216	/* sizeof(SHA512_CTX) */
+
+typedef union hmac_md_state_un
+	{
+	unsigned char opaque[HMAC_MD_STATE_SIZE];
+	double align_d;
+	long align_l;
+	void *align_p;
+	} HMAC_MD_STATE;
+
+typedef struct hmac_precomp_st
+	{
+	int type;		/* NID of the digest, NID_undef if unused */
+	unsigned int md_size;
+	HMAC_MD_STATE i_state;
+	HMAC_MD_STATE o_state;
+	} HMAC_PRECOMP;
+
+typedef struct hmac_precomp_ctx_st
+	{
+	const HMAC_PRECOMP *key;
+	HMAC_MD_STATE state;
+	} HMAC_PRECOMP_CTX;
+
 
 void HMAC_CTX_init(HMAC_CTX *ctx);
 void HMAC_CTX_cleanup(HMAC_CTX *ctx);
@@ -103,6 +132,15 @@ int HMAC_CTX_copy(HMAC_CTX *dctx, HMAC_CTX *sctx);
 
 void HMAC_CTX_set_flags(HMAC_CTX *ctx, unsigned long flags);
 
+int HMAC_precomp_md_supported(const EVP_MD *md);
+int HMAC_precompute(HMAC_PRECOMP *key, const void *secret, int len,
+		    const EVP_MD *md);
+void HMAC_PRECOMP_cleanup(HMAC_PRECOMP *key);
+void HMAC_precomp_Init(HMAC_PRECOMP_CTX *ctx, const HMAC_PRECOMP *key);
+void HMAC_precomp_Update(HMAC_PRECOMP_CTX *ctx, const unsigned char *data,
+			 size_t len);
+void HMAC_precomp_Final(HMAC_PRECOMP_CTX *ctx, unsigned char *md);
+
 #ifdef  __cplusplus
 }
 #endif
@@ -121,6 +121,87 @@ static struct test_st
 #endif
 
 static char *pt(unsigned char *md);
+
+/* HMAC_precomp_* against HMAC() for each supported digest, with keys
+ * shorter than, equal to and longer than the block size. */
+static int test_precomp(void)
+	{
+	static const int key_lens[] = { 0, 20, 64, 131 };
+	static const int data_lens[] = { 0, 13, 64, 200, 1000 };
+	const EVP_MD *mds[5];
+	unsigned char key[131], data[1000];
+	unsigned char want[EVP_MAX_MD_SIZE], got[EVP_MAX_MD_SIZE];
+	HMAC_PRECOMP pre;
+	HMAC_PRECOMP_CTX ctx;
+#ifndef OPENSSL_NO_SHA
+	EVP_MD copy;
+#endif
+	int i, j, k, n = 0, err = 0;
+
+#ifndef OPENSSL_NO_MD5
+	mds[n++] = EVP_md5();
+#endif
+#ifndef OPENSSL_NO_SHA
+	mds[n++] = EVP_sha1();
+#endif
+#ifndef OPENSSL_NO_SHA256
+	mds[n++] = EVP_sha256();
+#endif
+#ifndef OPENSSL_NO_SHA512
+	mds[n++] = EVP_sha384();
+	mds[n++] = EVP_sha512();
+#endif
+	for (i = 0; i < (int)sizeof(key); i++)
+		key[i] = (unsigned char)(i * 7 + 3);
+	for (i = 0; i < (int)sizeof(data); i++)
+		data[i] = (unsigned char)(i * 13 + 1);
+
+#ifndef OPENSSL_NO_SHA
+	/* A digest other than the built-in one, an ENGINE's say, has to go
+	 * through EVP. */
+	copy = *EVP_sha1();
+	if (HMAC_precompute(&pre, key, 20, &copy))
+		{
+		printf("HMAC_precompute took a foreign SHA-1\n");
+		err++;
+		}
+#endif
+
+	for (i = 0; i < n; i++)
+		for (j = 0; j < 4; j++)
+			{
+			if (!HMAC_precompute(&pre, key, key_lens[j], mds[i]))
+				{
+				printf("HMAC_precompute failed for %s\n",
+					OBJ_nid2sn(EVP_MD_type(mds[i])));
+				err++;
+				continue;
+				}
+			for (k = 0; k < 5; k++)
+				{
+				HMAC(mds[i], key, key_lens[j], data,
+					data_lens[k], want, NULL);
+				HMAC_precomp_Init(&ctx, &pre);
+				HMAC_precomp_Update(&ctx, data, data_lens[k] / 3);
+				HMAC_precomp_Update(&ctx, data + data_lens[k] / 3,
+					data_lens[k] - data_lens[k] / 3);
+				HMAC_precomp_Final(&ctx, got);
+				if (memcmp(want, got, EVP_MD_size(mds[i])) != 0)
+					{
+					printf("precomputed %s HMAC differs, key %d "
+						"data %d\n",
+						OBJ_nid2sn(EVP_MD_type(mds[i])),
+						key_lens[j], data_lens[k]);
+					err++;
+					}
+				}
+			HMAC_PRECOMP_cleanup(&pre);
+			}
+	if (!err)
+		printf("precomputed HMAC ok\n");
+	return err;
+	}
+
 int main(int argc, char *argv[])
 	{
 #ifndef OPENSSL_NO_MD5
@@ -157,6 +238,7 @@ int main(int argc, char *argv[])
 			printf("test %d ok\n",i);
 		}
 #endif /* OPENSSL_NO_MD5 */
+	err += test_precomp();
 	EXIT(err);
 	return(0);
 	}
@@ -0,0 +1,498 @@
+/* crypto/mem_cache.c */
+/*
+ * Built-in allocator for CRYPTO_set_mem_ex_functions().
+ *
+ * Blocks of up to 2 KB come from a cache of the calling thread, with one
+ * free list per power of two size class from 16 bytes up, so the many
+ * short malloc/free pairs of a handshake seldom reach the system allocator
+ * and never take a lock. A thread caches at most MEM_CACHE_MAX blocks per
+ * class and hands its cache back to the system when it exits. Larger
+ * blocks go to malloc() directly.
+ *
+ * While an arena (CRYPTO_mem_arena_new()) is current on a thread, blocks
+ * of up to MEM_ARENA_MAX bytes are instead cut from 16 KB chunks of the
+ * arena by bumping a pointer, in the same size classes. A block freed while
+ * its arena is current goes on a free list of the arena and is handed out
+ * again before the arena cuts more, so a handshake needs about as many
+ * chunks as it has memory in use at a time rather than as it allocates in
+ * all; otherwise freeing it only counts it off its chunk. A chunk is empty
+ * once none of its blocks is left, neither in use nor on the free list,
+ * and the arena has moved on to another chunk or has been freed; the
+ * thread then keeps it for the next arena, up to MEM_CHUNK_CACHE of them,
+ * or hands it back to the system. A block that outlives the arena keeps
+ * its chunk until it is freed, so the SSL library allocates what stays
+ * with a connection outside the arena.
+ *
+ * Every block has a 16 byte header telling where it came from, so any
+ * thread may free any block. Each thread counts the allocations it makes
+ * (CRYPTO_mem_stats()), and each arena those made while it is current
+ * (CRYPTO_mem_arena_stats()), which the SSL library uses for
+ * per-handshake figures.
+ *
+ * CRYPTO_mem_cache_setup() installs the allocator. Like
+ * CRYPTO_set_mem_functions() it fails once the library has allocated
+ * anything, and it also fails on platforms without POSIX threads. An arena
+ * must not be current on any thread when it is freed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "cryptlib.h"
+#include <openssl/crypto.h>
+
+#if defined(OPENSSL_THREADS) && !defined(OPENSSL_SYS_WINDOWS) && !defined(OPENSSL_SYS_NETWARE) && !defined(OPENSSL_SYS_VMS)
+
+#include <pthread.h>
+
+#ifdef __GNUC__
+#define MEM_ATOMIC_ADD(v,n)	__sync_add_and_fetch(&(v),(n))
+#else
+#define MEM_ATOMIC_ADD(v,n)	CRYPTO_add(&(v),(n),CRYPTO_LOCK_MALLOC)
+#endif
+
+#define MEM_MIN_SHIFT		4	/* smallest class, 16 bytes */
+#define MEM_CLASSES		8	/* up to 2048 bytes */
+#define MEM_CLASS_SIZE(c)	((size_t)1 << ((c) + MEM_MIN_SHIFT))
+#define MEM_CACHE_MAX		64	/* cached blocks per class and thread */
+#define MEM_ARENA_CHUNK		16384
+#define MEM_ARENA_MAX		1024	/* larger blocks bypass arenas */
+#define MEM_CHUNK_CACHE		8	/* empty chunks kept per thread */
+
+#define MEM_CLASS_SYSTEM	(-1)	/* straight from malloc() */
+/* Blocks of an arena chunk keep their size class as -2 down to -8 */
+#define MEM_CLASS_ARENA(c)	(-2-(c))
+#define MEM_IS_ARENA(cls)	((cls) <= MEM_CLASS_ARENA(0))
+#define MEM_ARENA_CLASS(cls)	(-2-(cls))	/* and back */
+
+/* An arena chunk; its blocks follow the header. |refs| counts the blocks
+ * still allocated or on the arena's free lists, plus one as long as it is
+ * the arena's current chunk. */
+typedef union mem_chunk_un
+	{
+	struct
+		{
+		int refs;
+		unsigned int used;	/* bytes handed out, header included */
+		CRYPTO_MEM_ARENA *arena;	/* that cut it */
+		} c;
+	unsigned char pad[16];
+	} MEM_CHUNK;
+
+typedef union mem_hdr_un
+	{
+	struct
+		{
+		/* The chunk of an arena block; the next free block while
+		 * the block is in a thread cache. */
+		void *link;
+		unsigned int size;	/* bytes asked for */
+		int cls;		/* size class or MEM_CLASS_* */
+		} h;
+	unsigned char pad[16];
+	} MEM_HDR;
+
+/* The next block on a free list of an arena, in the block's data */
+#define MEM_ARENA_NEXT(h)	(*(MEM_HDR **)((h)+1))
+
+struct crypto_mem_arena_st
+	{
+	MEM_CHUNK *chunk;		/* current chunk, or NULL */
+	MEM_HDR *free[MEM_CLASSES];	/* freed blocks of its chunks */
+	CRYPTO_MEM_STATS stats;
+	};
+
+/* The next empty chunk in a thread's cache, in the chunk's blocks */
+#define MEM_CHUNK_NEXT(c)	(*(MEM_CHUNK **)((c)+1))
+
+typedef struct mem_thread_st
+	{
+	MEM_HDR *free[MEM_CLASSES];
+	int nfree[MEM_CLASSES];
+	MEM_CHUNK *chunks;		/* empty arena chunks */
+	int nchunks;
+	CRYPTO_MEM_ARENA *arena;	/* current arena, or NULL */
+	CRYPTO_MEM_STATS stats;
+	} MEM_THREAD;
+
+static pthread_key_t mem_key;
+static int mem_installed=0;
+
+static void mem_thread_free(void *arg)
+	{
+	MEM_THREAD *t=arg;
+	MEM_CHUNK *c;
+	MEM_HDR *h;
+	int i;
+
+	for (i=0; i<MEM_CLASSES; i++)
+		{
+		while ((h=t->free[i]) != NULL)
+			{
+			t->free[i]=h->h.link;
+			free(h);
+			}
+		}
+	while ((c=t->chunks) != NULL)
+		{
+		t->chunks=MEM_CHUNK_NEXT(c);
+		free(c);
+		}
+	free(t);
+	}
+
+/* The calling thread's cache, created on first use. NULL if that fails,
+ * in which case blocks come from and go to the system. */
+static MEM_THREAD *mem_thread(void)
+	{
+	MEM_THREAD *t;
+
+	if ((t=pthread_getspecific(mem_key)) != NULL)
+		return t;
+	if ((t=calloc(1,sizeof(*t))) == NULL)
+		return NULL;
+	if (pthread_setspecific(mem_key,t) != 0)
+		{
+		free(t);
+		return NULL;
+		}
+	return t;
+	}
+
+static int mem_class(size_t num)
+	{
+	int c=0;
+
+	if (num > MEM_CLASS_SIZE(MEM_CLASSES-1))
+		return MEM_CLASS_SYSTEM;
+	while (MEM_CLASS_SIZE(c) < num)
+		c++;
+	return c;
+	}
+
+/* Drops a reference to |c|. An empty chunk goes to the cache of the
+ * calling thread, so that the next handshake cuts its blocks from it
+ * rather than from new memory between the blocks that stayed. */
+static void mem_chunk_release(MEM_THREAD *t, MEM_CHUNK *c)
+	{
+	if (MEM_ATOMIC_ADD(c->c.refs,-1) != 0)
+		return;
+	if (t != NULL && t->nchunks < MEM_CHUNK_CACHE)
+		{
+		MEM_CHUNK_NEXT(c)=t->chunks;
+		t->chunks=c;
+		t->nchunks++;
+		}
+	else
+		free(c);
+	}
+
+static MEM_HDR *mem_arena_alloc(MEM_THREAD *t, CRYPTO_MEM_ARENA *a,
+	size_t num)
+	{
+	int cls=mem_class(num);
+	size_t need=sizeof(MEM_HDR)+MEM_CLASS_SIZE(cls);
+	MEM_CHUNK *c=a->chunk;
+	MEM_HDR *h;
+
+	/* a freed block keeps its chunk's reference */
+	if ((h=a->free[cls]) != NULL)
+		{
+		a->free[cls]=MEM_ARENA_NEXT(h);
+		return h;
+		}
+	if (c == NULL || c->c.used+need > MEM_ARENA_CHUNK)
+		{
+		if ((c=t->chunks) != NULL)
+			{
+			t->chunks=MEM_CHUNK_NEXT(c);
+			t->nchunks--;
+			}
+		else if ((c=malloc(MEM_ARENA_CHUNK)) == NULL)
+			return NULL;
+		c->c.refs=1;
+		c->c.used=sizeof(MEM_CHUNK);
+		c->c.arena=a;
+		if (a->chunk != NULL)
+			mem_chunk_release(t,a->chunk);
+		a->chunk=c;
+		}
+	h=(MEM_HDR *)((unsigned char *)c+c->c.used);
+	c->c.used+=need;
+	MEM_ATOMIC_ADD(c->c.refs,1);
+	h->h.link=c;
+	h->h.cls=MEM_CLASS_ARENA(cls);
+	return h;
+	}
+
+/* A block for |num| bytes, counted in |st| if that is not NULL. */
+static MEM_HDR *mem_alloc_block(MEM_THREAD *t, size_t num,
+	CRYPTO_MEM_STATS *st)
+	{
+	CRYPTO_MEM_ARENA *a=t != NULL ? t->arena : NULL;
+	MEM_HDR *h;
+	int cls;
+
+	if (num > UINT_MAX-sizeof(MEM_HDR))
+		return NULL;
+	if (a != NULL && num <= MEM_ARENA_MAX &&
+	    (h=mem_arena_alloc(t,a,num)) != NULL)
+		{
+		if (st != NULL)
+			st->arena++;
+		}
+	else if ((cls=mem_class(num)) >= 0 && t != NULL &&
+		 (h=t->free[cls]) != NULL)
+		{
+		t->free[cls]=h->h.link;
+		t->nfree[cls]--;
+		if (st != NULL)
+			st->cached++;
+		}
+	else
+		{
+		if ((h=malloc(sizeof(MEM_HDR)+
+				(cls >= 0 ? MEM_CLASS_SIZE(cls) : num))) == NULL)
+			return NULL;
+		h->h.cls=cls;
+		}
+	h->h.size=(unsigned int)num;
+	return h;
+	}
+
+static void mem_free_block(MEM_THREAD *t, MEM_HDR *h)
+	{
+	int cls=h->h.cls;
+
+	if (MEM_IS_ARENA(cls))
+		{
+		/* Only the thread the arena is current on uses its free
+		 * lists; if another arena now has the address of the one
+		 * that cut the chunk, it can just as well reuse the block. */
+		if (t != NULL && t->arena != NULL &&
+		    ((MEM_CHUNK *)h->h.link)->c.arena == t->arena)
+			{
+			cls=MEM_ARENA_CLASS(cls);
+			MEM_ARENA_NEXT(h)=t->arena->free[cls];
+			t->arena->free[cls]=h;
+			}
+		else
+			mem_chunk_release(t,h->h.link);
+		}
+	else if (cls >= 0 && t != NULL && t->nfree[cls] < MEM_CACHE_MAX)
+		{
+		h->h.link=t->free[cls];
+		t->free[cls]=h;
+		t->nfree[cls]++;
+		}
+	else
+		free(h);
+	}
+
+/* Counts an allocation of |num| bytes in the thread and the current
+ * arena; |st| holds what mem_alloc_block() noted. */
+static void mem_count_alloc(MEM_THREAD *t, size_t num, CRYPTO_MEM_STATS *st)
+	{
+	if (t == NULL)
+		return;
+	t->stats.allocs++;
+	t->stats.bytes+=num;
+	t->stats.cached+=st->cached;
+	t->stats.arena+=st->arena;
+	if (t->arena != NULL)
+		{
+		t->arena->stats.allocs++;
+		t->arena->stats.bytes+=num;
+		t->arena->stats.cached+=st->cached;
+		t->arena->stats.arena+=st->arena;
+		}
+	}
+
+static void mem_count_free(MEM_THREAD *t)
+	{
+	if (t == NULL)
+		return;
+	t->stats.frees++;
+	if (t->arena != NULL)
+		t->arena->stats.frees++;
+	}
+
+static void *mem_malloc(size_t num, const char *file, int line)
+	{
+	MEM_THREAD *t=mem_thread();
+	CRYPTO_MEM_STATS st;
+	MEM_HDR *h;
+
+	memset(&st,0,sizeof(st));
+	if ((h=mem_alloc_block(t,num,&st)) == NULL)
+		return NULL;
+	mem_count_alloc(t,num,&st);
+	return h+1;
+	}
+
+static void *mem_realloc(void *p, size_t num, const char *file, int line)
+	{
+	MEM_THREAD *t;
+	CRYPTO_MEM_STATS st;
+	MEM_HDR *h, *n;
+
+	if (p == NULL)
+		return mem_malloc(num,file,line);
+	t=mem_thread();
+	memset(&st,0,sizeof(st));
+	h=(MEM_HDR *)p-1;
+	if (num > UINT_MAX-sizeof(MEM_HDR))
+		return NULL;
+	if ((h->h.cls >= 0 && num <= MEM_CLASS_SIZE(h->h.cls)) ||
+	    (MEM_IS_ARENA(h->h.cls) &&
+	     num <= MEM_CLASS_SIZE(MEM_ARENA_CLASS(h->h.cls))))
+		{
+		/* still fits its class */
+		h->h.size=(unsigned int)num;
+		n=h;
+		}
+	else if (h->h.cls == MEM_CLASS_SYSTEM && mem_class(num) < 0)
+		{
+		if ((n=realloc(h,sizeof(MEM_HDR)+num)) == NULL)
+			return NULL;
+		n->h.size=(unsigned int)num;
+		}
+	else
+		{
+		if ((n=mem_alloc_block(t,num,&st)) == NULL)
+			return NULL;
+		memcpy(n+1,p,h->h.size < num ? h->h.size : num);
+		mem_free_block(t,h);
+		}
+	/* as freeing the old block and allocating the new one, so that
+	 * allocations less frees stays the number of blocks in use */
+	mem_count_alloc(t,num,&st);
+	mem_count_free(t);
+	return n+1;
+	}
+
+static void mem_free(void *p)
+	{
+	MEM_THREAD *t;
+
+	if (p == NULL)
+		return;
+	t=mem_thread();
+	mem_count_free(t);
+	mem_free_block(t,(MEM_HDR *)p-1);
+	}
+
+int CRYPTO_mem_cache_setup(void)
+	{
+	if (mem_installed)
+		return 1;
+	if (pthread_key_create(&mem_key,mem_thread_free) != 0)
+		return 0;
+	if (!CRYPTO_set_mem_ex_functions(mem_malloc,mem_realloc,mem_free))
+		{
+		pthread_key_delete(mem_key);
+		return 0;
+		}
+	mem_installed=1;
+	return 1;
+	}
+
+void CRYPTO_mem_stats(CRYPTO_MEM_STATS *st)
+	{
+	MEM_THREAD *t;
+
+	if (mem_installed && (t=mem_thread()) != NULL)
+		*st=t->stats;
+	else
+		memset(st,0,sizeof(*st));
+	}
+
+/* Returns NULL without the allocator, so that callers can treat that like
+ * running without an arena. */
+CRYPTO_MEM_ARENA *CRYPTO_mem_arena_new(void)
+	{
+	CRYPTO_MEM_ARENA *a;
+
+	if (!mem_installed || (a=malloc(sizeof(*a))) == NULL)
+		return NULL;
+	memset(a,0,sizeof(*a));
+	return a;
+	}
+
+void CRYPTO_mem_arena_free(CRYPTO_MEM_ARENA *a)
+	{
+	MEM_THREAD *t;
+	MEM_HDR *h;
+	int i;
+
+	if (a == NULL)
+		return;
+	t=mem_thread();
+	/* chunks left with free blocks only go back here */
+	for (i=0; i<MEM_CLASSES; i++)
+		{
+		while ((h=a->free[i]) != NULL)
+			{
+			a->free[i]=MEM_ARENA_NEXT(h);
+			mem_chunk_release(t,h->h.link);
+			}
+		}
+	if (a->chunk != NULL)
+		mem_chunk_release(t,a->chunk);
+	free(a);
+	}
+
+/* Makes |a| (which may be NULL) the arena of the calling thread and returns
+ * the one that was. */
+CRYPTO_MEM_ARENA *CRYPTO_mem_arena_switch(CRYPTO_MEM_ARENA *a)
+	{
+	CRYPTO_MEM_ARENA *prev;
+	MEM_THREAD *t;
+
+	if (!mem_installed || (t=mem_thread()) == NULL)
+		return NULL;
+	prev=t->arena;
+	t->arena=a;
+	return prev;
+	}
+
+void CRYPTO_mem_arena_stats(const CRYPTO_MEM_ARENA *a, CRYPTO_MEM_STATS *st)
+	{
+	if (a != NULL)
+		*st=a->stats;
+	else
+		memset(st,0,sizeof(*st));
+	}
+
+#else /* OPENSSL_THREADS ... */
+
+int CRYPTO_mem_cache_setup(void)
+	{
+	return 0;
+	}
+
+void CRYPTO_mem_stats(CRYPTO_MEM_STATS *st)
+	{
+	memset(st,0,sizeof(*st));
+	}
+
+CRYPTO_MEM_ARENA *CRYPTO_mem_arena_new(void)
+	{
+	return NULL;
+	}
+
+void CRYPTO_mem_arena_free(CRYPTO_MEM_ARENA *a)
+	{
+	}
+
+CRYPTO_MEM_ARENA *CRYPTO_mem_arena_switch(CRYPTO_MEM_ARENA *a)
+	{
+	return NULL;
+	}
+
+void CRYPTO_mem_arena_stats(const CRYPTO_MEM_ARENA *a, CRYPTO_MEM_STATS *st)
+	{
+	memset(st,0,sizeof(*st));
+	}
+
+#endif
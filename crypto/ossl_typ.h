@@ -178,6 +178,7 @@ typedef struct ssl_ctx_st SSL_CTX;
 typedef struct spp_slice_st SPP_SLICE;
 typedef struct spp_read_st SPP_CTX;
 typedef struct spp_proxy_st SPP_PROXY;
+typedef struct spp_stats_st SPP_STATS;
 typedef struct spp_mac_st SPP_MAC;
 typedef struct spp_ciph_st SPP_CIPH;
 
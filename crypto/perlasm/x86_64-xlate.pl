@@ -67,6 +67,7 @@ open STDOUT,">$output" || die "can't open $output: $!"
 
 my $gas=1;	$gas=0 if ($output =~ /\.asm$/);
 my $elf=1;	$elf=0 if (!$gas);
+my $cfi=0;
 my $win64=0;
 my $prefix="";
 my $decor=".L";
@@ -95,6 +96,7 @@ elsif (!$gas)
     $elf=0;
     $decor="\$L\$";
 }
+$cfi=1 if ($elf && $flavour eq "elf-cfi");
 
 my $current_segment;
 my $current_function;
@@ -772,6 +774,353 @@ my $rdrand = sub {
     }
 };
 
+# Call frame information for the elf-cfi flavour, which the profile-*
+# Configure targets use. The modules don't describe their stack frames,
+# so debuggers and profilers can't unwind through them. Rather than
+# annotating every module by hand, the translated body of each .type-d
+# function is followed instruction by instruction: push/pop, immediate
+# %rsp adjustments, copies of %rsp made before the stack is realigned,
+# whether kept in a register or in a stack slot, and the loads that put
+# them back. Where the frame is lost the return address is marked
+# undefined, so that unwinding stops there rather than going astray.
+{ package cfi;
+    my %gpr;		# any register name -> its 64-bit register
+    my %dwarf=(rax=>0,rdx=>1,rcx=>2,rbx=>3,rsi=>4,rdi=>5,rbp=>6,rsp=>7);
+    foreach (qw(a b c d)) {
+	$gpr{"r${_}x"}=$gpr{"e${_}x"}=$gpr{"${_}x"}=$gpr{"${_}l"}=$gpr{"${_}h"}="r${_}x";
+    }
+    foreach (qw(si di bp sp)) {
+	$gpr{"r$_"}=$gpr{"e$_"}=$gpr{$_}=$gpr{"${_}l"}="r$_";
+    }
+    foreach (8..15) {
+	$gpr{"r$_"}=$gpr{"r${_}d"}=$gpr{"r${_}w"}=$gpr{"r${_}b"}="r$_";
+	$dwarf{"r$_"}=$_;
+    }
+    my %callee=map {$_=>1} qw(rbx rbp r12 r13 r14 r15);
+    my @scratch=qw(rax rcx rdx rsi rdi r8 r9 r10 r11);
+    # registers to define the CFA by when %rsp won't do, best first
+    my @prefer=(qw(rbp rbx r12 r13 r14 r15),reverse(@scratch));
+
+    sub value {		# constant displacement or immediate
+	my $v=shift;
+	return 0 if ($v eq "");
+	return undef if ($v !~ /^(0x[0-9a-f]+|[0-9]+|[\s\+\-\*\/\(\)])+$/i);
+	$v=eval($v);
+	$@ ? undef : $v;
+    }
+    sub operand {
+	my $o=shift;
+	if ($o =~ /^%(\w+)$/)	{ return { reg=>$gpr{$1} }; }
+	if ($o =~ /^\$(.*)$/)	{ return { imm=>value($1) }; }
+	if ($o =~ /^([^\(]*)\(\s*(?:%(\w+))?\s*(?:,\s*%(\w+)\s*(?:,\s*([0-9]+))?)?\s*\)$/) {
+	    return { mem=>1, disp=>value($1), base=>$gpr{$2},
+		     index=>$gpr{$3}, scale=>($4 or 1) };
+	}
+	{ sym=>$o };
+    }
+    sub insn {		# "mnemonic operands" -> node
+	my ($node,$text)=@_;
+	$text =~ s/^\s+|\s+$//g;
+	$text =~ s/^(?:rep\w*|lock)\s+(?=[a-z])//;
+	return if ($text !~ /^([a-z][a-z0-9]*)\s*(.*)$/);
+	$node->{op}=$1;
+	$node->{ops}=[ map(operand($_),grep(/\S/,map { s/^\s+|\s+$//g; $_ }
+				($2 =~ /((?:[^,\(]|\([^\)]*\))+)/g))) ];
+    }
+    # A node per line: a label, an instruction or anything else.
+    sub parse {
+	my $l=shift;
+	my @node;
+	if ($l =~ /^([\w\.\$]+):\s*(.*)$/) {
+	    push @node,{ text=>"$1:", label=>$1 };
+	    return @node if ($2 eq "");
+	    $l="\t$2";
+	}
+	my $n={ text=>$l };
+	if    ($l =~ /^\s*\.byte\s+0xf3,0xc3\s*$/)	{ $n->{op}="ret"; }
+	elsif ($l =~ /^\s*\.byte\s.*#\s*(.*)$/)		{ insn($n,$1); }
+	elsif ($l =~ /^\s*[a-z]/)			{ insn($n,$l); }
+	push @node,$n;
+	@node;
+    }
+
+    # The state at each instruction: distance of %rsp below the CFA if
+    # known, registers holding CFA-k, stack slots holding CFA-k and the
+    # distance below the CFA callee-saved registers were pushed at.
+    sub copy {
+	my $s=shift;
+	{ off=>$s->{off}, al=>{%{$s->{al}}}, sl=>{%{$s->{sl}}}, sv=>{%{$s->{sv}}} };
+    }
+    sub key {
+	my $s=shift;
+	join(";",defined($s->{off})?$s->{off}:"-",
+		map { my $f=$_; join(",",map("$_=$s->{$f}{$_}",sort keys %{$s->{$f}})) } qw(al sl sv));
+    }
+    sub meet {
+	my ($a,$b)=@_;
+	my $m={ off=>(defined($a->{off}) && defined($b->{off}) && $a->{off}==$b->{off}) ? $a->{off} : undef };
+	foreach my $f (qw(al sl sv)) {
+	    $m->{$f}={};
+	    foreach (keys %{$a->{$f}}) {
+		$m->{$f}{$_}=$a->{$f}{$_} if (exists($b->{$f}{$_}) && $b->{$f}{$_}==$a->{$f}{$_});
+	    }
+	}
+	$m;
+    }
+    sub slot {		# %rsp based memory operand -> slot key
+	my $o=shift;
+	return undef if (!$o->{mem} || $o->{base} ne "rsp" || !defined($o->{disp}));
+	"$o->{disp},$o->{index},$o->{scale}";
+    }
+    sub move_rsp {	# %rsp went down by $d
+	my ($s,$d)=@_;
+	my %sl;
+	foreach (keys %{$s->{sl}}) {
+	    my ($disp,$index,$scale)=split(/,/);
+	    $sl{($disp+$d).",$index,$scale"}=$s->{sl}{$_} if ($disp+$d>=0);
+	}
+	$s->{sl}=\%sl;
+	$s->{off}+=$d if (defined($s->{off}));
+	popped($s);
+    }
+    sub set_rsp {
+	my ($s,$off)=@_;
+	if (defined($off) && defined($s->{off})) {
+	    move_rsp($s,$off-$s->{off});
+	} else {
+	    ($s->{off},$s->{sl})=($off,{});
+	    popped($s);
+	}
+    }
+    sub popped {	# saves left above %rsp are gone
+	my $s=shift;
+	return if (!defined($s->{off}));
+	foreach (keys %{$s->{sv}}) { delete $s->{sv}{$_} if ($s->{sv}{$_}>$s->{off}); }
+    }
+    sub clobber {
+	my ($s,$r)=@_;
+	return if (!defined($r));
+	if ($r eq "rsp") { set_rsp($s,undef); return; }
+	delete $s->{al}{$r};
+	foreach (keys %{$s->{sl}}) { delete $s->{sl}{$_} if ((split(/,/))[1] eq $r); }
+    }
+    sub cfa {		# CFA-k held by register or %rsp
+	my ($s,$r)=@_;
+	$r eq "rsp" ? $s->{off} : $s->{al}{$r};
+    }
+    # Applies the instruction to $s, returns whether it falls through
+    # and where it may jump to.
+    sub step {
+	my ($s,$n)=@_;
+	my $op=$n->{op};
+	return (1) if (!defined($op));
+	my @o=@{$n->{ops}};
+	my ($src,$dst)=@o[0,-1];
+	my @wr;
+
+	if ($op =~ /^ret|^ud2/)			{ return (0); }
+	elsif ($op =~ /^jmp/)			{ return (0,$dst->{sym}); }
+	elsif ($op =~ /^(j|loop)/)		{ clobber($s,"rcx") if ($op =~ /^loop/);
+						  return (1,$dst->{sym}); }
+	elsif ($op =~ /^call/)			{ @wr=@scratch; }
+	elsif ($op =~ /^push/) {
+	    move_rsp($s,8);
+	    $s->{sv}{$src->{reg}}=$s->{off}
+		if (@o && $callee{$src->{reg}} && defined($s->{off}) && !exists($s->{sv}{$src->{reg}}));
+	}
+	elsif ($op =~ /^pop/) {
+	    move_rsp($s,-8);
+	    if (@o) { delete $s->{sv}{$src->{reg}}; @wr=($src->{reg}); }
+	}
+	elsif ($op =~ /^leave/) {
+	    set_rsp($s,cfa($s,"rbp"));
+	    move_rsp($s,-8);
+	    delete $s->{sv}{rbp};
+	    @wr=("rbp");
+	}
+	elsif ($op =~ /^lea[q]?$/ && $dst->{reg} eq "rsp" && $src->{base} eq "rsp" &&
+	       !$src->{index} && defined($src->{disp})) {
+	    move_rsp($s,-$src->{disp});
+	}
+	elsif ($op =~ /^lea[q]?$/ && $dst->{reg}) {
+	    my $k;
+	    $k=cfa($s,$src->{base})-$src->{disp}
+		if (defined($src->{disp}) && !$src->{index} && defined(cfa($s,$src->{base})));
+	    if ($dst->{reg} eq "rsp") { set_rsp($s,$k); }
+	    else { clobber($s,$dst->{reg}); $s->{al}{$dst->{reg}}=$k if (defined($k)); }
+	}
+	elsif ($op =~ /^mov[q]?$/ && $dst->{reg} && ($src->{reg} || defined(slot($src)))) {
+	    my $k=$src->{reg} ? cfa($s,$src->{reg}) : $s->{sl}{slot($src)};
+	    if ($dst->{reg} eq "rsp") { set_rsp($s,$k); }
+	    else { clobber($s,$dst->{reg}); $s->{al}{$dst->{reg}}=$k if (defined($k)); }
+	}
+	elsif ($op =~ /^mov[q]?$/ && defined(slot($dst))) {
+	    my $k=cfa($s,$src->{reg});
+	    if (defined($k))	{ $s->{sl}{slot($dst)}=$k; }
+	    else		{ delete $s->{sl}{slot($dst)}; }
+	}
+	elsif ($op =~ /^xchg/ && $src->{reg} && $dst->{reg}) {
+	    my ($a,$b)=($src->{reg},$dst->{reg});
+	    ($a,$b)=($b,$a) if ($b eq "rsp");
+	    my ($ka,$kb)=(cfa($s,$a),cfa($s,$b));
+	    clobber($s,$b);
+	    if ($a eq "rsp") { set_rsp($s,$kb); }
+	    else { clobber($s,$a); $s->{al}{$a}=$kb if (defined($kb)); }
+	    $s->{al}{$b}=$ka if (defined($ka));
+	}
+	elsif ($op =~ /^(add|sub)[q]?$/ && $dst->{reg} eq "rsp" && defined($src->{imm})) {
+	    move_rsp($s,$1 eq "sub" ? $src->{imm} : -$src->{imm});
+	}
+	elsif ($op =~ /^(cmp|test|bt[qlw]?$|u?comis|v?ptest|prefetch|nop|[lms]fence|clflush)/) { }
+	elsif ($op =~ /^(xchg|xadd)/)		{ @wr=map($_->{reg},@o); }
+	elsif ($op =~ /^(mul|div|idiv|cqto|cltq|cltd|cwtl)/ || ($op =~ /^imul/ && @o==1))
+						{ @wr=(qw(rax rdx),$dst->{reg}); }
+	elsif ($op =~ /^cpuid/)			{ @wr=qw(rax rbx rcx rdx); }
+	elsif ($op =~ /^(rdtsc|xgetbv)/)	{ @wr=qw(rax rcx rdx); }
+	elsif ($op =~ /^(movs|stos|lods|scas|cmps)[bwlq]?$/)
+						{ @wr=qw(rax rcx rsi rdi); }
+	elsif ($op =~ /^cmpxchg/)		{ @wr=("rax",$dst->{reg}); }
+	elsif ($op =~ /^mulx/)			{ @wr=($o[-2]->{reg},$dst->{reg}); }
+	else {
+	    @wr=($dst->{reg});
+	    delete $s->{sl}{slot($dst)} if (defined(slot($dst)));
+	}
+	clobber($s,$_) foreach (@wr);
+	(1);
+    }
+
+    sub uleb {
+	my $v=shift;
+	my @b;
+	do { my $c=$v&0x7f; $v>>=7; push @b,$c|($v?0x80:0); } while ($v);
+	@b;
+    }
+    sub sleb {
+	use integer;
+	my $v=shift;
+	my @b;
+	while (1) {
+	    my $c=$v&0x7f; $v>>=7;
+	    if (($v==0 && !($c&0x40)) || ($v==-1 && ($c&0x40))) { push @b,$c; last; }
+	    push @b,$c|0x80;
+	}
+	@b;
+    }
+    # How to find the CFA, as the directive to say so. Only registers the
+    # callee preserves will do at a call.
+    sub rule {
+	my ($s,$call)=@_;
+	return ".cfi_def_cfa\t%rsp,$s->{off}" if (defined($s->{off}));
+	foreach (@prefer) {
+	    next if ($call && !$callee{$_});
+	    return ".cfi_def_cfa\t%$_,$s->{al}{$_}" if (exists($s->{al}{$_}));
+	}
+	foreach (sort keys %{$s->{sl}}) {
+	    my ($disp,$index,$scale)=split(/,/);
+	    next if ($call && $index ne "" && !$callee{$index});
+	    my $k=$s->{sl}{$_};
+	    # DW_CFA_def_cfa_expression: *(%rsp+disp+index*scale)+k
+	    my @e=(0x77,sleb($disp));
+	    if ($index ne "") {
+		push @e,0x70+$dwarf{$index},0;
+		push @e,0x30+{2=>1,4=>2,8=>3}->{$scale},0x24 if ($scale>1);
+		push @e,0x22;
+	    }
+	    push @e,0x06;
+	    push @e,($k>=0 ? (0x23,uleb($k)) : (0x11,sleb($k),0x22));
+	    return ".cfi_escape\t".join(",",map(sprintf("0x%02x",$_),0x0f,uleb(scalar(@e)),@e));
+	}
+	undef;
+    }
+    sub frame {
+	my ($global,@l)=@_;
+	my @node=map(parse($_),@l);
+	my (%at,@in,@work);
+
+	for (my $i=0;$i<=$#node;$i++) {
+	    next if (!defined($node[$i]->{label}));
+	    $at{$node[$i]->{label}}=$i;
+	    if ($i==0 || $global->{$node[$i]->{label}}) {
+		$in[$i]={ off=>8, al=>{}, sl=>{}, sv=>{} };
+		push @work,$i;
+	    }
+	}
+	while (@work) {
+	    my $i=pop(@work);
+	    my $s=copy($in[$i]);
+	    my ($next,$target)=step($s,$node[$i]);
+	    my @succ;
+	    push @succ,$i+1 if ($next && $i<$#node);
+	    push @succ,$at{$target} if (defined($target) && exists($at{$target}));
+	    foreach my $j (@succ) {
+		my $t=defined($in[$j]) ? meet($in[$j],$s) : $s;
+		next if (defined($in[$j]) && key($t) eq key($in[$j]));
+		$in[$j]=copy($t);
+		push @work,$j;
+	    }
+	}
+
+	my @out=($node[0]->{text},"\t.cfi_startproc");
+	my ($rule,$undef,%sv)=(".cfi_def_cfa\t%rsp,8",0);
+	for (my $i=1;$i<=$#node;$i++) {
+	    my $s=$in[$i];
+	    if (defined($node[$i]->{op}) && defined($s)) {
+		my $r=rule($s,$node[$i]->{op} =~ /^call/);
+		if (!defined($r)) {
+		    push @out,"\t.cfi_undefined\t%rip" if (!$undef);
+		    $undef=1;
+		} else {
+		    push @out,"\t.cfi_restore\t%rip" if ($undef);
+		    if ($r ne $rule) {
+			my ($off)=($r =~ /^\.cfi_def_cfa\t%rsp,(.*)/);
+			if (defined($off) && $rule =~ /^\.cfi_def_cfa\t%rsp,/)
+			    { push @out,"\t.cfi_def_cfa_offset\t$off"; }
+			else
+			    { push @out,"\t$r"; }
+		    }
+		    ($rule,$undef)=($r,0);
+		}
+		foreach (sort keys %sv) {
+		    next if (exists($s->{sv}{$_}));
+		    push @out,"\t.cfi_restore\t%$_";
+		    delete $sv{$_};
+		}
+		foreach (sort keys %{$s->{sv}}) {
+		    next if ($sv{$_}==$s->{sv}{$_});
+		    push @out,"\t.cfi_offset\t%$_,-$s->{sv}{$_}";
+		    $sv{$_}=$s->{sv}{$_};
+		}
+	    }
+	    push @out,$node[$i]->{text};
+	}
+	(@out,"\t.cfi_endproc");
+    }
+    sub annotate {
+	my @l=split(/\n/,shift);
+	my (%func,%global,@out);
+
+	foreach (@l) {
+	    $func{$1}=1   if (/^\s*\.type\s+([\w\.\$]+),\@(function|abi-omnipotent)/);
+	    $global{$1}=1 if (/^\s*\.globa?l\s+([\w\.\$]+)/);
+	}
+	for (my $i=0;$i<=$#l;) {
+	    if ($l[$i] =~ /^([\w\.\$]+):/ && $func{$1}) {
+		my $name=$1;
+		my $j=$i+1;
+		$j++ while ($j<=$#l && $l[$j] !~ /^\s*\.(size\s+\Q$name\E,|type\s|text\b|data\b|section\b|previous\b)/);
+		push @out,frame(\%global,@l[$i..$j-1]);
+		$i=$j;
+	    } else {
+		push @out,$l[$i++];
+	    }
+	}
+	join("\n",@out)."\n";
+    }
+}
+
+my $cfibuf;
+if ($cfi) { open(CFIBUF,">",\$cfibuf); select(CFIBUF); }
+
 if ($nasm) {
     print <<___;
 default	rel
@@ -803,7 +1152,9 @@ while($line=<>) {
 	undef @bytes;
 	
 	if ((ref($asm) eq 'CODE') && scalar(@bytes=&$asm($line))) {
-	    print $gas?".byte\t":"DB\t",join(',',@bytes),"\n";
+	    print $gas?".byte\t":"DB\t",join(',',@bytes);
+	    print "\t# ",$opcode->mnemonic()," ",$line if ($cfi);
+	    print "\n";
 	    next;
 	}
 
@@ -854,6 +1205,8 @@ while($line=<>) {
 print "\n$current_segment\tENDS\n"	if ($current_segment && $masm);
 print "END\n"				if ($masm);
 
+if ($cfi) { close(CFIBUF); select(STDOUT); print cfi::annotate($cfibuf); }
+
 close STDOUT;
 
 #################################################
@@ -0,0 +1,391 @@
+/* crypto/poly1305/poly1305.c */
+/*
+ * Poly1305 (RFC 7539), with the accumulator in five 26-bit limbs so that
+ * all products fit in 64 bits ("poly1305-donna-32").
+ *
+ * On x86_64 with AVX2, long inputs are processed four blocks at a time:
+ * lane j of the vector accumulator collects blocks j, j+4, j+8, ... and is
+ * multiplied by r^4 after each group, and the lanes are multiplied by r^4,
+ * r^3, r^2 and r before being added up at the end of the run. This gives
+ * the same result as the serial Horner evaluation.
+ */
+
+#include <string.h>
+#include "cryptlib.h"
+#include <openssl/poly1305.h>
+
+#if !defined(OPENSSL_NO_ASM) && defined(OPENSSL_CPUID_OBJ) && \
+	(defined(__x86_64) || defined(__x86_64__)) && \
+	(defined(__clang__) || \
+	 (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+# define POLY1305_AVX2
+# include <immintrin.h>
+extern unsigned int OPENSSL_ia32cap_P[];
+#endif
+
+typedef unsigned int u32;
+typedef unsigned long long u64;
+
+#define U8TO32_LITTLE(p) \
+	(((u32)((p)[0])) | ((u32)((p)[1]) << 8) | \
+	 ((u32)((p)[2]) << 16) | ((u32)((p)[3]) << 24))
+
+#define U32TO8_LITTLE(p, v) \
+	{ (p)[0] = (unsigned char)(v); (p)[1] = (unsigned char)((v) >> 8); \
+	  (p)[2] = (unsigned char)((v) >> 16); (p)[3] = (unsigned char)((v) >> 24); }
+
+#define MASK26	0x3ffffff
+
+void CRYPTO_poly1305_init(poly1305_state *st, const unsigned char key[32])
+	{
+	/* r &= 0xffffffc0ffffffc0ffffffc0fffffff */
+	st->r[0] = (U8TO32_LITTLE(key + 0)) & 0x3ffffff;
+	st->r[1] = (U8TO32_LITTLE(key + 3) >> 2) & 0x3ffff03;
+	st->r[2] = (U8TO32_LITTLE(key + 6) >> 4) & 0x3ffc0ff;
+	st->r[3] = (U8TO32_LITTLE(key + 9) >> 6) & 0x3f03fff;
+	st->r[4] = (U8TO32_LITTLE(key + 12) >> 8) & 0x00fffff;
+
+	st->pad[0] = U8TO32_LITTLE(key + 16);
+	st->pad[1] = U8TO32_LITTLE(key + 20);
+	st->pad[2] = U8TO32_LITTLE(key + 24);
+	st->pad[3] = U8TO32_LITTLE(key + 28);
+
+	memset(st->h, 0, sizeof(st->h));
+	st->have_rpow = 0;
+	st->buf_used = 0;
+	}
+
+/* poly1305_blocks adds the len / 16 blocks at m to the accumulator, with
+ * hibit set to 1<<24 for full blocks and 0 for the padded final block. */
+static void poly1305_blocks(poly1305_state *st, const unsigned char *m,
+			    size_t len, u32 hibit)
+	{
+	const u32 r0 = st->r[0], r1 = st->r[1], r2 = st->r[2],
+		  r3 = st->r[3], r4 = st->r[4];
+	const u32 s1 = r1 * 5, s2 = r2 * 5, s3 = r3 * 5, s4 = r4 * 5;
+	u32 h0 = st->h[0], h1 = st->h[1], h2 = st->h[2],
+	    h3 = st->h[3], h4 = st->h[4];
+	u64 d0, d1, d2, d3, d4;
+	u32 c;
+
+	while (len >= 16)
+		{
+		/* h += m */
+		h0 += (U8TO32_LITTLE(m + 0)) & MASK26;
+		h1 += (U8TO32_LITTLE(m + 3) >> 2) & MASK26;
+		h2 += (U8TO32_LITTLE(m + 6) >> 4) & MASK26;
+		h3 += (U8TO32_LITTLE(m + 9) >> 6) & MASK26;
+		h4 += (U8TO32_LITTLE(m + 12) >> 8) | hibit;
+
+		/* h *= r */
+		d0 = ((u64)h0 * r0) + ((u64)h1 * s4) + ((u64)h2 * s3) +
+		     ((u64)h3 * s2) + ((u64)h4 * s1);
+		d1 = ((u64)h0 * r1) + ((u64)h1 * r0) + ((u64)h2 * s4) +
+		     ((u64)h3 * s3) + ((u64)h4 * s2);
+		d2 = ((u64)h0 * r2) + ((u64)h1 * r1) + ((u64)h2 * r0) +
+		     ((u64)h3 * s4) + ((u64)h4 * s3);
+		d3 = ((u64)h0 * r3) + ((u64)h1 * r2) + ((u64)h2 * r1) +
+		     ((u64)h3 * r0) + ((u64)h4 * s4);
+		d4 = ((u64)h0 * r4) + ((u64)h1 * r3) + ((u64)h2 * r2) +
+		     ((u64)h3 * r1) + ((u64)h4 * r0);
+
+		/* (partial) h %= p */
+		c = (u32)(d0 >> 26); h0 = (u32)d0 & MASK26;
+		d1 += c; c = (u32)(d1 >> 26); h1 = (u32)d1 & MASK26;
+		d2 += c; c = (u32)(d2 >> 26); h2 = (u32)d2 & MASK26;
+		d3 += c; c = (u32)(d3 >> 26); h3 = (u32)d3 & MASK26;
+		d4 += c; c = (u32)(d4 >> 26); h4 = (u32)d4 & MASK26;
+		h0 += c * 5; c = h0 >> 26; h0 &= MASK26;
+		h1 += c;
+
+		m += 16;
+		len -= 16;
+		}
+
+	st->h[0] = h0;
+	st->h[1] = h1;
+	st->h[2] = h2;
+	st->h[3] = h3;
+	st->h[4] = h4;
+	}
+
+#if defined(POLY1305_AVX2)
+
+/* poly1305_mul sets out to a * b mod p, partially reduced. */
+static void poly1305_mul(u32 out[5], const u32 a[5], const u32 b[5])
+	{
+	const u32 s1 = b[1] * 5, s2 = b[2] * 5, s3 = b[3] * 5, s4 = b[4] * 5;
+	u64 d0, d1, d2, d3, d4;
+	u32 c;
+
+	d0 = ((u64)a[0] * b[0]) + ((u64)a[1] * s4) + ((u64)a[2] * s3) +
+	     ((u64)a[3] * s2) + ((u64)a[4] * s1);
+	d1 = ((u64)a[0] * b[1]) + ((u64)a[1] * b[0]) + ((u64)a[2] * s4) +
+	     ((u64)a[3] * s3) + ((u64)a[4] * s2);
+	d2 = ((u64)a[0] * b[2]) + ((u64)a[1] * b[1]) + ((u64)a[2] * b[0]) +
+	     ((u64)a[3] * s4) + ((u64)a[4] * s3);
+	d3 = ((u64)a[0] * b[3]) + ((u64)a[1] * b[2]) + ((u64)a[2] * b[1]) +
+	     ((u64)a[3] * b[0]) + ((u64)a[4] * s4);
+	d4 = ((u64)a[0] * b[4]) + ((u64)a[1] * b[3]) + ((u64)a[2] * b[2]) +
+	     ((u64)a[3] * b[1]) + ((u64)a[4] * b[0]);
+
+	c = (u32)(d0 >> 26); out[0] = (u32)d0 & MASK26;
+	d1 += c; c = (u32)(d1 >> 26); out[1] = (u32)d1 & MASK26;
+	d2 += c; c = (u32)(d2 >> 26); out[2] = (u32)d2 & MASK26;
+	d3 += c; c = (u32)(d3 >> 26); out[3] = (u32)d3 & MASK26;
+	d4 += c; c = (u32)(d4 >> 26); out[4] = (u32)d4 & MASK26;
+	out[0] += c * 5; c = out[0] >> 26; out[0] &= MASK26;
+	out[1] += c;
+	}
+
+/* H = H * R mod p, partially reduced, on four independent lanes. R holds
+ * the limbs of the multiplier and S five times them. */
+#define POLY1305_MUL4(H,R,S) \
+	{ \
+	__m256i d0, d1, d2, d3, d4, c; \
+	d0 = _mm256_add_epi64( \
+		_mm256_add_epi64(_mm256_mul_epu32(H[0], R[0]), \
+				 _mm256_mul_epu32(H[1], S[4])), \
+		_mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epu32(H[2], S[3]), \
+						  _mm256_mul_epu32(H[3], S[2])), \
+				 _mm256_mul_epu32(H[4], S[1]))); \
+	d1 = _mm256_add_epi64( \
+		_mm256_add_epi64(_mm256_mul_epu32(H[0], R[1]), \
+				 _mm256_mul_epu32(H[1], R[0])), \
+		_mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epu32(H[2], S[4]), \
+						  _mm256_mul_epu32(H[3], S[3])), \
+				 _mm256_mul_epu32(H[4], S[2]))); \
+	d2 = _mm256_add_epi64( \
+		_mm256_add_epi64(_mm256_mul_epu32(H[0], R[2]), \
+				 _mm256_mul_epu32(H[1], R[1])), \
+		_mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epu32(H[2], R[0]), \
+						  _mm256_mul_epu32(H[3], S[4])), \
+				 _mm256_mul_epu32(H[4], S[3]))); \
+	d3 = _mm256_add_epi64( \
+		_mm256_add_epi64(_mm256_mul_epu32(H[0], R[3]), \
+				 _mm256_mul_epu32(H[1], R[2])), \
+		_mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epu32(H[2], R[1]), \
+						  _mm256_mul_epu32(H[3], R[0])), \
+				 _mm256_mul_epu32(H[4], S[4]))); \
+	d4 = _mm256_add_epi64( \
+		_mm256_add_epi64(_mm256_mul_epu32(H[0], R[4]), \
+				 _mm256_mul_epu32(H[1], R[3])), \
+		_mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epu32(H[2], R[2]), \
+						  _mm256_mul_epu32(H[3], R[1])), \
+				 _mm256_mul_epu32(H[4], R[0]))); \
+	c = _mm256_srli_epi64(d0, 26); H[0] = _mm256_and_si256(d0, mask); \
+	d1 = _mm256_add_epi64(d1, c); \
+	c = _mm256_srli_epi64(d1, 26); H[1] = _mm256_and_si256(d1, mask); \
+	d2 = _mm256_add_epi64(d2, c); \
+	c = _mm256_srli_epi64(d2, 26); H[2] = _mm256_and_si256(d2, mask); \
+	d3 = _mm256_add_epi64(d3, c); \
+	c = _mm256_srli_epi64(d3, 26); H[3] = _mm256_and_si256(d3, mask); \
+	d4 = _mm256_add_epi64(d4, c); \
+	c = _mm256_srli_epi64(d4, 26); H[4] = _mm256_and_si256(d4, mask); \
+	H[0] = _mm256_add_epi64(H[0], _mm256_add_epi64(c, _mm256_slli_epi64(c, 2))); \
+	c = _mm256_srli_epi64(H[0], 26); H[0] = _mm256_and_si256(H[0], mask); \
+	H[1] = _mm256_add_epi64(H[1], c); \
+	}
+
+/* H += the four blocks at m. After unpacking, the lanes hold blocks 0, 2,
+ * 1 and 3 in that order. */
+#define POLY1305_ADD4(H,m) \
+	{ \
+	__m256i a = _mm256_loadu_si256((const __m256i *)(m)); \
+	__m256i b = _mm256_loadu_si256((const __m256i *)((m) + 32)); \
+	__m256i lo = _mm256_unpacklo_epi64(a, b), hi = _mm256_unpackhi_epi64(a, b); \
+	H[0] = _mm256_add_epi64(H[0], _mm256_and_si256(lo, mask)); \
+	H[1] = _mm256_add_epi64(H[1], \
+		_mm256_and_si256(_mm256_srli_epi64(lo, 26), mask)); \
+	H[2] = _mm256_add_epi64(H[2], _mm256_and_si256(_mm256_or_si256( \
+		_mm256_srli_epi64(lo, 52), _mm256_slli_epi64(hi, 12)), mask)); \
+	H[3] = _mm256_add_epi64(H[3], \
+		_mm256_and_si256(_mm256_srli_epi64(hi, 14), mask)); \
+	H[4] = _mm256_add_epi64(H[4], \
+		_mm256_or_si256(_mm256_srli_epi64(hi, 40), hibit)); \
+	}
+
+/* poly1305_blocks_avx2 adds the len / 64 groups of four blocks at m to the
+ * accumulator and returns the number of bytes used. */
+__attribute__((target("avx2")))
+static size_t poly1305_blocks_avx2(poly1305_state *st, const unsigned char *m,
+				   size_t len)
+	{
+	const __m256i mask = _mm256_set1_epi64x(MASK26);
+	const __m256i hibit = _mm256_set1_epi64x(1 << 24);
+	const u32 *r1 = st->r, *r2 = st->rpow[0], *r3 = st->rpow[1],
+		  *r4 = st->rpow[2];
+	__m256i H[5], R[5], S[5];
+	u64 t[4];
+	size_t done;
+	int i;
+
+	if (!st->have_rpow)
+		{
+		poly1305_mul(st->rpow[0], st->r, st->r);
+		poly1305_mul(st->rpow[1], st->rpow[0], st->r);
+		poly1305_mul(st->rpow[2], st->rpow[1], st->r);
+		st->have_rpow = 1;
+		}
+
+	for (i = 0; i < 5; i++)
+		{
+		R[i] = _mm256_set1_epi64x(r4[i]);
+		S[i] = _mm256_set1_epi64x(r4[i] * 5);
+		}
+	H[0] = _mm256_setr_epi64x(st->h[0], 0, 0, 0);
+	H[1] = _mm256_setr_epi64x(st->h[1], 0, 0, 0);
+	H[2] = _mm256_setr_epi64x(st->h[2], 0, 0, 0);
+	H[3] = _mm256_setr_epi64x(st->h[3], 0, 0, 0);
+	H[4] = _mm256_setr_epi64x(st->h[4], 0, 0, 0);
+
+	len &= ~(size_t)63;
+	for (done = 64; done < len; done += 64, m += 64)
+		{
+		POLY1305_ADD4(H, m);
+		POLY1305_MUL4(H, R, S);
+		}
+	POLY1305_ADD4(H, m);
+
+	/* The last group: the lanes hold blocks 0, 2, 1 and 3 of it. */
+	for (i = 0; i < 5; i++)
+		{
+		R[i] = _mm256_setr_epi64x(r4[i], r2[i], r3[i], r1[i]);
+		S[i] = _mm256_setr_epi64x(r4[i] * 5, r2[i] * 5,
+					  r3[i] * 5, r1[i] * 5);
+		}
+	POLY1305_MUL4(H, R, S);
+
+	for (i = 0; i < 5; i++)
+		{
+		_mm256_storeu_si256((__m256i *)t, H[i]);
+		st->h[i] = (u32)(t[0] + t[1] + t[2] + t[3]);
+		}
+	/* Each limb is now below 2^28; carry so the scalar code can go on. */
+	for (i = 0; i < 4; i++)
+		{
+		st->h[i + 1] += st->h[i] >> 26;
+		st->h[i] &= MASK26;
+		}
+	st->h[0] += (st->h[4] >> 26) * 5;
+	st->h[4] &= MASK26;
+	st->h[1] += st->h[0] >> 26;
+	st->h[0] &= MASK26;
+
+	return len;
+	}
+
+#endif
+
+void CRYPTO_poly1305_update(poly1305_state *st, const unsigned char *in,
+			    size_t in_len)
+	{
+	size_t todo;
+
+	if (st->buf_used)
+		{
+		todo = 16 - st->buf_used;
+		if (todo > in_len)
+			todo = in_len;
+		memcpy(st->buf + st->buf_used, in, todo);
+		st->buf_used += todo;
+		in += todo;
+		in_len -= todo;
+		if (st->buf_used < 16)
+			return;
+		poly1305_blocks(st, st->buf, 16, 1 << 24);
+		st->buf_used = 0;
+		}
+
+#if defined(POLY1305_AVX2)
+	if (in_len >= 256 && (OPENSSL_ia32cap_P[2] & (1<<5)))	/* AVX2 */
+		{
+		todo = poly1305_blocks_avx2(st, in, in_len);
+		in += todo;
+		in_len -= todo;
+		}
+#endif
+
+	if (in_len >= 16)
+		{
+		todo = in_len & ~(size_t)15;
+		poly1305_blocks(st, in, todo, 1 << 24);
+		in += todo;
+		in_len -= todo;
+		}
+
+	if (in_len)
+		{
+		memcpy(st->buf, in, in_len);
+		st->buf_used = in_len;
+		}
+	}
+
+void CRYPTO_poly1305_finish(poly1305_state *st, unsigned char mac[16])
+	{
+	u32 h0, h1, h2, h3, h4, c;
+	u32 g0, g1, g2, g3, g4;
+	u32 mask;
+	u64 f;
+
+	if (st->buf_used)
+		{
+		st->buf[st->buf_used] = 1;
+		memset(st->buf + st->buf_used + 1, 0, 15 - st->buf_used);
+		poly1305_blocks(st, st->buf, 16, 0);
+		}
+
+	h0 = st->h[0];
+	h1 = st->h[1];
+	h2 = st->h[2];
+	h3 = st->h[3];
+	h4 = st->h[4];
+
+	/* fully carry h */
+	c = h1 >> 26; h1 &= MASK26;
+	h2 += c; c = h2 >> 26; h2 &= MASK26;
+	h3 += c; c = h3 >> 26; h3 &= MASK26;
+	h4 += c; c = h4 >> 26; h4 &= MASK26;
+	h0 += c * 5; c = h0 >> 26; h0 &= MASK26;
+	h1 += c;
+
+	/* compute h - p */
+	g0 = h0 + 5; c = g0 >> 26; g0 &= MASK26;
+	g1 = h1 + c; c = g1 >> 26; g1 &= MASK26;
+	g2 = h2 + c; c = g2 >> 26; g2 &= MASK26;
+	g3 = h3 + c; c = g3 >> 26; g3 &= MASK26;
+	g4 = h4 + c - (1 << 26);
+
+	/* select h if h < p, or h - p if h >= p */
+	mask = (g4 >> 31) - 1;
+	g0 &= mask;
+	g1 &= mask;
+	g2 &= mask;
+	g3 &= mask;
+	g4 &= mask;
+	mask = ~mask;
+	h0 = (h0 & mask) | g0;
+	h1 = (h1 & mask) | g1;
+	h2 = (h2 & mask) | g2;
+	h3 = (h3 & mask) | g3;
+	h4 = (h4 & mask) | g4;
+
+	/* h = h % (2^128) */
+	h0 = (h0) | (h1 << 26);
+	h1 = (h1 >> 6) | (h2 << 20);
+	h2 = (h2 >> 12) | (h3 << 14);
+	h3 = (h3 >> 18) | (h4 << 8);
+
+	/* mac = (h + pad) % (2^128) */
+	f = (u64)h0 + st->pad[0];		h0 = (u32)f;
+	f = (u64)h1 + st->pad[1] + (f >> 32);	h1 = (u32)f;
+	f = (u64)h2 + st->pad[2] + (f >> 32);	h2 = (u32)f;
+	f = (u64)h3 + st->pad[3] + (f >> 32);	h3 = (u32)f;
+
+	U32TO8_LITTLE(mac + 0, h0);
+	U32TO8_LITTLE(mac + 4, h1);
+	U32TO8_LITTLE(mac + 8, h2);
+	U32TO8_LITTLE(mac + 12, h3);
+
+	OPENSSL_cleanse(st, sizeof(*st));
+	}
@@ -0,0 +1,49 @@
+/* crypto/poly1305/poly1305.h */
+/*
+ * Poly1305 one-time authenticator, as specified in RFC 7539.
+ */
+
+#ifndef HEADER_POLY1305_H
+#define HEADER_POLY1305_H
+
+#include <openssl/opensslconf.h>
+
+#if defined(OPENSSL_NO_POLY1305)
+#error Poly1305 support is disabled.
+#endif
+
+#include <stddef.h>
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+typedef struct poly1305_state_st
+	{
+	unsigned int r[5];		/* clamped r, in 26-bit limbs */
+	unsigned int h[5];		/* accumulator, in 26-bit limbs */
+	unsigned int pad[4];		/* s */
+	unsigned int rpow[3][5];	/* r^2, r^3 and r^4, for the SIMD code */
+	int have_rpow;
+	unsigned char buf[16];
+	unsigned int buf_used;
+	} poly1305_state;
+
+/* CRYPTO_poly1305_init sets up |state| to authenticate a message under the
+ * given 32-byte one-time key. */
+void CRYPTO_poly1305_init(poly1305_state *state, const unsigned char key[32]);
+
+/* CRYPTO_poly1305_update adds |in_len| bytes from |in| to the message. It
+ * can be called any number of times with inputs of any length. */
+void CRYPTO_poly1305_update(poly1305_state *state, const unsigned char *in,
+			    size_t in_len);
+
+/* CRYPTO_poly1305_finish writes the 16-byte tag to |mac| and wipes
+ * |state|. */
+void CRYPTO_poly1305_finish(poly1305_state *state, unsigned char mac[16]);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif
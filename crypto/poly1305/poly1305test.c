@@ -0,0 +1,204 @@
+/* crypto/poly1305/poly1305test.c */
+/*
+ * Poly1305 and ChaCha20-Poly1305 test vectors from RFC 7539, and a long
+ * message fed in pieces of different sizes so that the buffering and the
+ * 4-way code are used together.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "../e_os.h"
+
+#if defined(OPENSSL_NO_POLY1305) || defined(OPENSSL_NO_CHACHA)
+int main(int argc, char *argv[])
+{
+    printf("No Poly1305 support\n");
+    return(0);
+}
+#else
+#include <openssl/poly1305.h>
+#include <openssl/evp.h>
+
+struct poly1305_test
+	{
+	const char *key;
+	const char *msg;
+	const char *tag;
+	};
+
+static const struct poly1305_test tests[] =
+	{
+	/* RFC 7539, 2.5.2 */
+	{ "85d6be7857556d337f4452fe42d506a80103808afb0db2fd4abff6af4149f51b",
+	  "43727970746f6772617068696320466f72756d2052657365617263682047726f7570",
+	  "a8061dc1305136c6c22b8baf0c0127a9" },
+	/* RFC 7539, A.3 #1 */
+	{ "0000000000000000000000000000000000000000000000000000000000000000",
+	  "0000000000000000000000000000000000000000000000000000000000000000"
+	  "0000000000000000000000000000000000000000000000000000000000000000",
+	  "00000000000000000000000000000000" },
+	/* RFC 7539, A.3 #5 and #6: h reaches p */
+	{ "0200000000000000000000000000000000000000000000000000000000000000",
+	  "ffffffffffffffffffffffffffffffff",
+	  "03000000000000000000000000000000" },
+	{ "02000000000000000000000000000000ffffffffffffffffffffffffffffffff",
+	  "02000000000000000000000000000000",
+	  "03000000000000000000000000000000" },
+	};
+
+static const char aead_key[] =
+	"808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9f";
+static const char aead_nonce[] = "070000004041424344454647";
+static const char aead_aad[] = "50515253c0c1c2c3c4c5c6c7";
+static const char aead_pt[] =
+	"Ladies and Gentlemen of the class of '99: If I could offer you only "
+	"one tip for the future, sunscreen would be it.";
+static const char aead_ct[] =
+	"d31a8d34648e60db7b86afbc53ef7ec2a4aded51296e08fea9e2b5a736ee62d6"
+	"3dbea45e8ca9671282fafb69da92728b1a71de0a9e060b2905d6a5b67ecd3b36"
+	"92ddbd7f2d778b8c9803aee328091b58fab324e4fad675945585808b4831d7bc"
+	"3ff4def08e4b7a9de576d26586cec64b6116";
+static const char aead_tag[] = "1ae10b594f09e26a7e902ecbd0600691";
+
+/* Tag of the 1000-byte message (i*37+1) under the key 30..4f. */
+static const char long_tag[] = "d4c28885dbf68f59159f490dab79d917";
+
+static size_t unhex(unsigned char *out, const char *in)
+	{
+	size_t n;
+
+	for (n = 0; in[2 * n] && in[2 * n + 1]; n++)
+		{
+		unsigned int b;
+
+		sscanf(in + 2 * n, "%2x", &b);
+		out[n] = (unsigned char)b;
+		}
+	return n;
+	}
+
+static int check(const char *what, const unsigned char *got,
+		 const char *hex)
+	{
+	unsigned char want[256];
+	size_t n = unhex(want, hex);
+
+	if (memcmp(got, want, n) == 0)
+		return 0;
+	fprintf(stderr, "%s mismatch\n", what);
+	return 1;
+	}
+
+static int test_aead(void)
+	{
+	EVP_CIPHER_CTX ctx;
+	unsigned char key[32], nonce[12], aad[12], ct[128], out[128], tag[16];
+	size_t pt_len = strlen(aead_pt), ct_len;
+	int err = 0;
+
+	unhex(key, aead_key);
+	unhex(nonce, aead_nonce);
+	unhex(aad, aead_aad);
+	ct_len = unhex(ct, aead_ct);
+	EVP_CIPHER_CTX_init(&ctx);
+
+	if (!EVP_EncryptInit_ex(&ctx, EVP_chacha20_poly1305(), NULL, key, nonce)
+	    || EVP_Cipher(&ctx, NULL, aad, sizeof(aad)) < 0
+	    /* the plaintext in two pieces, through the key stream buffer */
+	    || EVP_Cipher(&ctx, out, (const unsigned char *)aead_pt, 37) < 0
+	    || EVP_Cipher(&ctx, out + 37, (const unsigned char *)aead_pt + 37,
+			  pt_len - 37) < 0
+	    || EVP_Cipher(&ctx, NULL, NULL, 0) < 0
+	    || !EVP_CIPHER_CTX_ctrl(&ctx, EVP_CTRL_AEAD_GET_TAG, 16, tag))
+		{
+		fprintf(stderr, "ChaCha20-Poly1305 encryption failed\n");
+		err++;
+		}
+	else
+		{
+		err += check("ChaCha20-Poly1305 ciphertext", out, aead_ct);
+		err += check("ChaCha20-Poly1305 tag", tag, aead_tag);
+		}
+
+	if (!EVP_DecryptInit_ex(&ctx, EVP_chacha20_poly1305(), NULL, key, nonce)
+	    || !EVP_CIPHER_CTX_ctrl(&ctx, EVP_CTRL_AEAD_SET_TAG, 16, tag)
+	    || EVP_Cipher(&ctx, NULL, aad, sizeof(aad)) < 0
+	    || EVP_Cipher(&ctx, out, ct, ct_len) < 0
+	    || EVP_Cipher(&ctx, NULL, NULL, 0) < 0
+	    || memcmp(out, aead_pt, pt_len))
+		{
+		fprintf(stderr, "ChaCha20-Poly1305 decryption failed\n");
+		err++;
+		}
+
+	tag[0] ^= 1;
+	if (!EVP_DecryptInit_ex(&ctx, NULL, NULL, NULL, nonce)
+	    || !EVP_CIPHER_CTX_ctrl(&ctx, EVP_CTRL_AEAD_SET_TAG, 16, tag)
+	    || EVP_Cipher(&ctx, NULL, aad, sizeof(aad)) < 0
+	    || EVP_Cipher(&ctx, out, ct, ct_len) < 0
+	    || EVP_Cipher(&ctx, NULL, NULL, 0) >= 0)
+		{
+		fprintf(stderr, "ChaCha20-Poly1305 accepted a bad tag\n");
+		err++;
+		}
+
+	EVP_CIPHER_CTX_cleanup(&ctx);
+	return err;
+	}
+
+int main(int argc, char *argv[])
+	{
+	static const size_t chunks[] = { 1000, 1, 15, 16, 17, 63, 64, 256, 300 };
+	poly1305_state st;
+	unsigned char key[32], msg[1000], mac[16];
+	size_t i, j, n, len;
+	int err = 0;
+
+	for (i = 0; i < sizeof(tests) / sizeof(tests[0]); i++)
+		{
+		unhex(key, tests[i].key);
+		len = unhex(msg, tests[i].msg);
+		CRYPTO_poly1305_init(&st, key);
+		CRYPTO_poly1305_update(&st, msg, len);
+		CRYPTO_poly1305_finish(&st, mac);
+		if (check("Poly1305 tag", mac, tests[i].tag))
+			{
+			fprintf(stderr, "  (test %d)\n", (int)i + 1);
+			err++;
+			}
+		}
+
+	for (i = 0; i < sizeof(key); i++)
+		key[i] = (unsigned char)(0x30 + i);
+	for (i = 0; i < sizeof(msg); i++)
+		msg[i] = (unsigned char)(i * 37 + 1);
+	for (i = 0; i < sizeof(chunks) / sizeof(chunks[0]); i++)
+		{
+		CRYPTO_poly1305_init(&st, key);
+		for (j = 0; j < sizeof(msg); j += n)
+			{
+			n = chunks[i];
+			if (n > sizeof(msg) - j)
+				n = sizeof(msg) - j;
+			CRYPTO_poly1305_update(&st, msg + j, n);
+			}
+		CRYPTO_poly1305_finish(&st, mac);
+		if (check("Poly1305 long message tag", mac, long_tag))
+			{
+			fprintf(stderr, "  (pieces of %d bytes)\n", (int)chunks[i]);
+			err++;
+			}
+		}
+
+	err += test_aead();
+
+	if (err)
+		printf("%d Poly1305 tests failed\n", err);
+	else
+		printf("test Poly1305 and ChaCha20-Poly1305 ok\n");
+	EXIT(err);
+	return(err);
+	}
+#endif
@@ -98,6 +98,9 @@ const RAND_METHOD *RAND_get_rand_method(void);
 int RAND_set_rand_engine(ENGINE *engine);
 #endif
 RAND_METHOD *RAND_SSLeay(void);
+#ifndef OPENSSL_NO_AES
+RAND_METHOD *RAND_ctr_drbg(void);
+#endif
 void RAND_cleanup(void );
 int  RAND_bytes(unsigned char *buf,int num);
 int  RAND_pseudo_bytes(unsigned char *buf,int num);
@@ -133,6 +136,8 @@ void ERR_load_RAND_strings(void);
 /* Error codes for the RAND functions. */
 
 /* Function codes. */
+#define RAND_F_CTR_RAND_BYTES				 103
+#define RAND_F_CTR_RAND_SEED				 104
 #define RAND_F_RAND_GET_RAND_METHOD			 101
 #define RAND_F_RAND_INIT_FIPS				 102
 #define RAND_F_SSLEAY_RAND_BYTES			 100
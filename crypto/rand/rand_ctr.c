@@ -0,0 +1,386 @@
+/* crypto/rand/rand_ctr.c */
+/*
+ * A per-thread AES-256 CTR_DRBG (NIST SP 800-90A, without derivation
+ * function) as a RAND_METHOD.
+ *
+ * md_rand keeps one pool for the whole process and takes CRYPTO_LOCK_RAND
+ * (and CRYPTO_LOCK_RAND2) on every call, which serialises the handshakes
+ * of a threaded server on the RNG: an SPP handshake asks for random bytes
+ * for every slice key, envelope IV and session key. Here every thread
+ * gets a DRBG of its own on first use and generating takes no lock.
+ *
+ * A DRBG is seeded with CTR_SEEDLEN bytes from the operating system
+ * (DEVRANDOM) or, failing that, from RAND_SSLeay(). It is reseeded after
+ * RAND_CTR_RESEED_INTERVAL requests, in the child after a fork() and when
+ * the application adds seed material. RAND_add() input goes into the
+ * calling thread's DRBG, condensed with SHA-384 to CTR_SEEDLEN bytes, and
+ * into md_rand for the DRBGs seeded from it. Without POSIX threads there is
+ * a single DRBG under CRYPTO_LOCK_RAND.
+ *
+ * Select it with RAND_set_rand_method(RAND_ctr_drbg()).
+ *
+ * "make bench_rand" in test/ compares the two in sppbench.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "e_os.h"
+#include "cryptlib.h"
+#include <openssl/rand.h>
+#include <openssl/evp.h>
+#include <openssl/sha.h>
+
+#ifndef OPENSSL_NO_AES
+
+#if defined(OPENSSL_THREADS) && !defined(OPENSSL_SYS_WINDOWS) && !defined(OPENSSL_SYS_NETWARE) && !defined(OPENSSL_SYS_VMS)
+#define RAND_CTR_PTHREADS
+#include <pthread.h>
+#endif
+
+#if defined(DEVRANDOM) && !defined(OPENSSL_SYS_WINDOWS) && !defined(OPENSSL_SYS_VMS)
+#define RAND_CTR_DEVRANDOM
+#include <sys/types.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+#define CTR_KEYLEN	32
+#define CTR_BLOCK	16
+#define CTR_SEEDLEN	(CTR_KEYLEN+CTR_BLOCK)
+/* Counter blocks encrypted per EVP call */
+#define CTR_BATCH	32
+/* Longest output of one generate call; SP 800-90A allows 2^19 bits */
+#define CTR_MAX_REQUEST	(1<<16)
+#define RAND_CTR_RESEED_INTERVAL	(1<<16)
+
+typedef struct rand_ctr_st
+	{
+	EVP_CIPHER_CTX cipher;		/* AES-256-ECB under the key K */
+	unsigned char V[CTR_BLOCK];
+	unsigned long reseed_counter;
+	int fork_gen;
+	int instantiated;
+	} RAND_CTR;
+
+static void ctr_rand_seed(const void *buf, int num);
+static int ctr_rand_bytes(unsigned char *buf, int num);
+static void ctr_rand_cleanup(void);
+static void ctr_rand_add(const void *buf, int num, double add_entropy);
+static int ctr_rand_status(void);
+
+static RAND_METHOD rand_ctr_meth={
+	ctr_rand_seed,
+	ctr_rand_bytes,
+	ctr_rand_cleanup,
+	ctr_rand_add,
+	ctr_rand_bytes,
+	ctr_rand_status
+	};
+
+RAND_METHOD *RAND_ctr_drbg(void)
+	{
+	return(&rand_ctr_meth);
+	}
+
+/* Bumped in the child of every fork(), so that parent and child don't go
+ * on with copies of the same DRBG states. */
+static volatile int ctr_fork_gen=0;
+
+#ifdef RAND_CTR_PTHREADS
+
+static pthread_once_t ctr_once=PTHREAD_ONCE_INIT;
+static pthread_key_t ctr_key;
+static int ctr_key_ok=0;
+
+static void ctr_free(void *p)
+	{
+	RAND_CTR *ctx=p;
+
+	EVP_CIPHER_CTX_cleanup(&ctx->cipher);
+	OPENSSL_cleanse(ctx,sizeof(*ctx));
+	OPENSSL_free(ctx);
+	}
+
+static void ctr_atfork_child(void)
+	{
+	ctr_fork_gen++;
+	}
+
+static void ctr_init(void)
+	{
+	ctr_key_ok=(pthread_key_create(&ctr_key,ctr_free) == 0);
+	pthread_atfork(NULL,NULL,ctr_atfork_child);
+	}
+
+/* The calling thread's DRBG, made if there is none yet and create is set */
+static RAND_CTR *ctr_get(int create)
+	{
+	RAND_CTR *ctx;
+
+	pthread_once(&ctr_once,ctr_init);
+	if (!ctr_key_ok)
+		return NULL;
+	if ((ctx=pthread_getspecific(ctr_key)) != NULL || !create)
+		return ctx;
+	if ((ctx=OPENSSL_malloc(sizeof(*ctx))) == NULL)
+		return NULL;
+	memset(ctx,0,sizeof(*ctx));
+	EVP_CIPHER_CTX_init(&ctx->cipher);
+	if (pthread_setspecific(ctr_key,ctx) != 0)
+		{
+		ctr_free(ctx);
+		return NULL;
+		}
+	return ctx;
+	}
+
+static void ctr_put(void)
+	{
+	RAND_CTR *ctx;
+
+	if ((ctx=ctr_get(0)) != NULL)
+		{
+		pthread_setspecific(ctr_key,NULL);
+		ctr_free(ctx);
+		}
+	}
+
+#define ctr_lock()
+#define ctr_unlock()
+
+#else
+
+static RAND_CTR ctr_global;
+static int ctr_global_init=0;
+
+static RAND_CTR *ctr_get(int create)
+	{
+	if (!ctr_global_init)
+		{
+		CRYPTO_w_lock(CRYPTO_LOCK_RAND);
+		if (!ctr_global_init)
+			{
+			memset(&ctr_global,0,sizeof(ctr_global));
+			EVP_CIPHER_CTX_init(&ctr_global.cipher);
+			ctr_global_init=1;
+			}
+		CRYPTO_w_unlock(CRYPTO_LOCK_RAND);
+		}
+	return &ctr_global;
+	}
+
+static void ctr_put(void)
+	{
+	CRYPTO_w_lock(CRYPTO_LOCK_RAND);
+	if (ctr_global_init)
+		{
+		EVP_CIPHER_CTX_cleanup(&ctr_global.cipher);
+		OPENSSL_cleanse(&ctr_global,sizeof(ctr_global));
+		ctr_global_init=0;
+		}
+	CRYPTO_w_unlock(CRYPTO_LOCK_RAND);
+	}
+
+#define ctr_lock()	CRYPTO_w_lock(CRYPTO_LOCK_RAND)
+#define ctr_unlock()	CRYPTO_w_unlock(CRYPTO_LOCK_RAND)
+
+#endif
+
+static int ctr_entropy(unsigned char *buf, int num)
+	{
+#ifdef RAND_CTR_DEVRANDOM
+	static const char *randomfiles[] = { DEVRANDOM };
+	unsigned int i;
+	int fd,n,got;
+
+	for (i=0; i<sizeof(randomfiles)/sizeof(randomfiles[0]); i++)
+		{
+		if ((fd=open(randomfiles[i],O_RDONLY
+#ifdef O_NOCTTY
+			|O_NOCTTY
+#endif
+			)) < 0)
+			continue;
+		for (got=0; got<num; got+=n)
+			{
+			n=read(fd,buf+got,num-got);
+			if (n < 0 && errno == EINTR)
+				n=0;
+			else if (n <= 0)
+				break;
+			}
+		close(fd);
+		if (got == num)
+			return 1;
+		}
+#endif
+	return RAND_SSLeay()->bytes(buf,num) > 0;
+	}
+
+static void ctr_inc(unsigned char *V)
+	{
+	int i;
+
+	for (i=CTR_BLOCK-1; i>=0; i--)
+		if (++V[i] != 0)
+			break;
+	}
+
+/* out = E(K,V+1) || E(K,V+2) || ..., n blocks, V left at the last one */
+static void ctr_blocks(RAND_CTR *ctx, unsigned char *out, int n)
+	{
+	int i,outl;
+
+	for (i=0; i<n; i++)
+		{
+		ctr_inc(ctx->V);
+		memcpy(out+i*CTR_BLOCK,ctx->V,CTR_BLOCK);
+		}
+	EVP_EncryptUpdate(&ctx->cipher,out,&outl,out,n*CTR_BLOCK);
+	}
+
+/* CTR_DRBG_Update, provided_data may be NULL for all zeroes */
+static void ctr_update(RAND_CTR *ctx, const unsigned char *provided_data)
+	{
+	unsigned char temp[CTR_SEEDLEN];
+	int i;
+
+	ctr_blocks(ctx,temp,CTR_SEEDLEN/CTR_BLOCK);
+	if (provided_data != NULL)
+		for (i=0; i<CTR_SEEDLEN; i++)
+			temp[i]^=provided_data[i];
+	EVP_EncryptInit_ex(&ctx->cipher,NULL,NULL,temp,NULL);
+	memcpy(ctx->V,temp+CTR_KEYLEN,CTR_BLOCK);
+	OPENSSL_cleanse(temp,sizeof(temp));
+	}
+
+/* Instantiates or reseeds from entropy and additional input; the entropy
+ * is fetched before, so that the fallback to md_rand runs unlocked. */
+static void ctr_reseed(RAND_CTR *ctx, unsigned char *entropy,
+	const void *add, int addlen)
+	{
+	unsigned char md[SHA384_DIGEST_LENGTH];
+	int i;
+
+	if (!ctx->instantiated)
+		{
+		static const unsigned char zero[CTR_KEYLEN];
+
+		EVP_EncryptInit_ex(&ctx->cipher,EVP_aes_256_ecb(),NULL,zero,NULL);
+		EVP_CIPHER_CTX_set_padding(&ctx->cipher,0);
+		memset(ctx->V,0,CTR_BLOCK);
+		ctx->instantiated=1;
+		}
+	if (add != NULL && addlen > 0)
+		{
+		SHA384(add,addlen,md);
+		for (i=0; i<CTR_SEEDLEN; i++)
+			entropy[i]^=md[i];
+		OPENSSL_cleanse(md,sizeof(md));
+		}
+	ctr_update(ctx,entropy);
+	ctx->reseed_counter=1;
+	ctx->fork_gen=ctr_fork_gen;
+	}
+
+static int ctr_seed_thread(const void *add, int addlen)
+	{
+	unsigned char entropy[CTR_SEEDLEN];
+	RAND_CTR *ctx;
+
+	if ((ctx=ctr_get(1)) == NULL || !ctr_entropy(entropy,CTR_SEEDLEN))
+		{
+		RANDerr(RAND_F_CTR_RAND_SEED,RAND_R_ERROR_INSTANTIATING_DRBG);
+		return 0;
+		}
+	ctr_lock();
+	ctr_reseed(ctx,entropy,add,addlen);
+	ctr_unlock();
+	OPENSSL_cleanse(entropy,sizeof(entropy));
+	return 1;
+	}
+
+static int ctr_rand_bytes(unsigned char *buf, int num)
+	{
+	unsigned char last[CTR_BLOCK];
+	RAND_CTR *ctx;
+	int n;
+
+	if (num <= 0)
+		return 1;
+	if ((ctx=ctr_get(1)) == NULL)
+		{
+		RANDerr(RAND_F_CTR_RAND_BYTES,RAND_R_ERROR_INSTANTIATING_DRBG);
+		return 0;
+		}
+	if (!ctx->instantiated || ctx->fork_gen != ctr_fork_gen ||
+		ctx->reseed_counter > RAND_CTR_RESEED_INTERVAL)
+		{
+		if (!ctr_seed_thread(NULL,0))
+			return 0;
+		}
+
+	ctr_lock();
+	while (num > 0)
+		{
+		int req=num > CTR_MAX_REQUEST ? CTR_MAX_REQUEST : num;
+
+		num-=req;
+		for (; req>=CTR_BLOCK; req-=n, buf+=n)
+			{
+			n=req/CTR_BLOCK;
+			if (n > CTR_BATCH)
+				n=CTR_BATCH;
+			ctr_blocks(ctx,buf,n);
+			n*=CTR_BLOCK;
+			}
+		if (req > 0)
+			{
+			ctr_blocks(ctx,last,1);
+			memcpy(buf,last,req);
+			buf+=req;
+			}
+		ctr_update(ctx,NULL);
+		ctx->reseed_counter++;
+		}
+	ctr_unlock();
+	OPENSSL_cleanse(last,sizeof(last));
+	return 1;
+	}
+
+static void ctr_rand_add(const void *buf, int num, double add_entropy)
+	{
+	if (num <= 0)
+		return;
+	RAND_SSLeay()->add(buf,num,add_entropy);
+	ctr_seed_thread(buf,num);
+	}
+
+static void ctr_rand_seed(const void *buf, int num)
+	{
+	ctr_rand_add(buf,num,(double)num);
+	}
+
+static int ctr_rand_status(void)
+	{
+	RAND_CTR *ctx;
+
+	if ((ctx=ctr_get(1)) == NULL)
+		return 0;
+	if (!ctx->instantiated)
+		{
+		ERR_set_mark();
+		ctr_seed_thread(NULL,0);
+		ERR_pop_to_mark();
+		}
+	return ctx->instantiated;
+	}
+
+static void ctr_rand_cleanup(void)
+	{
+	ctr_put();
+	}
+
+#endif
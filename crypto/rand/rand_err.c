@@ -70,6 +70,8 @@
 
 static ERR_STRING_DATA RAND_str_functs[]=
 	{
+{ERR_FUNC(RAND_F_CTR_RAND_BYTES),	"CTR_RAND_BYTES"},
+{ERR_FUNC(RAND_F_CTR_RAND_SEED),	"CTR_RAND_SEED"},
 {ERR_FUNC(RAND_F_RAND_GET_RAND_METHOD),	"RAND_get_rand_method"},
 {ERR_FUNC(RAND_F_RAND_INIT_FIPS),	"RAND_init_fips"},
 {ERR_FUNC(RAND_F_SSLEAY_RAND_BYTES),	"SSLEAY_RAND_BYTES"},
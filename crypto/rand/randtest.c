@@ -58,6 +58,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <openssl/rand.h>
 
 #include "../e_os.h"
@@ -75,6 +76,12 @@ int main(int argc,char **argv)
 	/*double d; */
 	long d;
 
+#ifndef OPENSSL_NO_AES
+	/* "randtest -ctr" runs the tests on the per-thread CTR_DRBG */
+	if (argc > 1 && strcmp(argv[1],"-ctr") == 0)
+		RAND_set_rand_method(RAND_ctr_drbg());
+#endif
+
 	i = RAND_pseudo_bytes(buf,2500);
 	if (i < 0)
 		{
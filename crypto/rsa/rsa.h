@@ -158,6 +158,8 @@ struct rsa_st
 	char *bignum_data;
 	BN_BLINDING *blinding;
 	BN_BLINDING *mt_blinding;
+	/* blindings of the threads using the key, see rsa_eay.c */
+	struct rsa_blinding_list_st *thr_blinding;
 	};
 
 #ifndef OPENSSL_RSA_MAX_MODULUS_BITS
@@ -376,6 +378,7 @@ int RSA_verify_ASN1_OCTET_STRING(int type,
 int RSA_blinding_on(RSA *rsa, BN_CTX *ctx);
 void RSA_blinding_off(RSA *rsa);
 BN_BLINDING *RSA_setup_blinding(RSA *rsa, BN_CTX *ctx);
+int RSA_setup_mont(RSA *rsa, BN_CTX *ctx);
 
 int RSA_padding_add_PKCS1_type_1(unsigned char *to,int tlen,
 	const unsigned char *f,int fl);
@@ -448,6 +451,11 @@ RSA *RSAPrivateKey_dup(RSA *rsa);
  */
 #define RSA_FLAG_CHECKED			0x0800
 
+/* The Montgomery contexts have been set up by RSA_setup_mont(), before the
+ * key was shared: operations use them without taking CRYPTO_LOCK_RSA.
+ */
+#define RSA_FLAG_MONT_SET			0x1000
+
 /* BEGIN ERROR CODES */
 /* The following lines are auto generated by the script mkerr.pl. Any changes
  * made after this point may be overwritten when the script is next run.
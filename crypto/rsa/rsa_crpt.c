@@ -162,6 +162,64 @@ err:
 	return(ret);
 	}
 
+/* Sets up the Montgomery contexts the built-in RSA implementation caches
+ * on the key, so that operations find them ready instead of checking for
+ * them under CRYPTO_LOCK_RSA each time. Meant for when a key is loaded,
+ * before threads start to share it.
+ */
+int RSA_setup_mont(RSA *rsa, BN_CTX *in_ctx)
+	{
+	BIGNUM local_p,local_q;
+	BIGNUM *p,*q;
+	BN_CTX *ctx;
+	int ret=0;
+
+	if (rsa->n == NULL)
+		return 0;
+	if (in_ctx == NULL)
+		{
+		if ((ctx = BN_CTX_new()) == NULL) return 0;
+		}
+	else
+		ctx = in_ctx;
+
+	if (rsa->flags & RSA_FLAG_CACHE_PUBLIC)
+		if (!BN_MONT_CTX_set_locked(&rsa->_method_mod_n, CRYPTO_LOCK_RSA, rsa->n, ctx))
+			goto err;
+
+	if ((rsa->flags & RSA_FLAG_CACHE_PRIVATE) && rsa->p != NULL &&
+		rsa->q != NULL)
+		{
+		/* As in RSA_eay_mod_exp(): BN_FLG_CONSTTIME for the inversion */
+		if (!(rsa->flags & RSA_FLAG_NO_CONSTTIME))
+			{
+			BN_init(&local_p);
+			p = &local_p;
+			BN_with_flags(p, rsa->p, BN_FLG_CONSTTIME);
+
+			BN_init(&local_q);
+			q = &local_q;
+			BN_with_flags(q, rsa->q, BN_FLG_CONSTTIME);
+			}
+		else
+			{
+			p = rsa->p;
+			q = rsa->q;
+			}
+		if (!BN_MONT_CTX_set_locked(&rsa->_method_mod_p, CRYPTO_LOCK_RSA, p, ctx))
+			goto err;
+		if (!BN_MONT_CTX_set_locked(&rsa->_method_mod_q, CRYPTO_LOCK_RSA, q, ctx))
+			goto err;
+		}
+
+	rsa->flags |= RSA_FLAG_MONT_SET;
+	ret=1;
+err:
+	if (in_ctx == NULL)
+		BN_CTX_free(ctx);
+	return(ret);
+	}
+
 static BIGNUM *rsa_get_public_exp(const BIGNUM *d, const BIGNUM *p,
 	const BIGNUM *q, BN_CTX *ctx)
 {
@@ -114,6 +114,7 @@
 #include <openssl/bn.h>
 #include <openssl/rsa.h>
 #include <openssl/rand.h>
+#include "rsa_locl.h"
 
 #ifndef RSA_NULL
 
@@ -128,6 +129,8 @@ static int RSA_eay_private_decrypt(int flen, const unsigned char *from,
 static int RSA_eay_mod_exp(BIGNUM *r0, const BIGNUM *i, RSA *rsa, BN_CTX *ctx);
 static int RSA_eay_init(RSA *rsa);
 static int RSA_eay_finish(RSA *rsa);
+static BN_MONT_CTX *rsa_mont_ctx(RSA *rsa, BN_MONT_CTX **pmont,
+		const BIGNUM *mod, BN_CTX *ctx);
 static RSA_METHOD rsa_pkcs1_eay_meth={
 	"Eric Young's PKCS#1 RSA",
 	RSA_eay_public_encrypt,
@@ -224,7 +227,7 @@ static int RSA_eay_public_encrypt(int flen, const unsigned char *from,
 		}
 
 	if (rsa->flags & RSA_FLAG_CACHE_PUBLIC)
-		if (!BN_MONT_CTX_set_locked(&rsa->_method_mod_n, CRYPTO_LOCK_RSA, rsa->n, ctx))
+		if (!rsa_mont_ctx(rsa, &rsa->_method_mod_n, rsa->n, ctx))
 			goto err;
 
 	if (!rsa->meth->bn_mod_exp(ret,f,rsa->e,rsa->n,ctx,
@@ -252,12 +255,114 @@ err:
 	return(r);
 	}
 
+/* The Montgomery context *pmont for mod, made if there is none yet. After
+ * RSA_setup_mont() they are all there and none is replaced any more. */
+static BN_MONT_CTX *rsa_mont_ctx(RSA *rsa, BN_MONT_CTX **pmont,
+	const BIGNUM *mod, BN_CTX *ctx)
+	{
+	if ((rsa->flags & RSA_FLAG_MONT_SET) && *pmont != NULL)
+		return *pmont;
+	return BN_MONT_CTX_set_locked(pmont, CRYPTO_LOCK_RSA, mod, ctx);
+	}
+
+#ifdef __GNUC__
+#define RSA_THREAD_BLINDING
+
+/* Up to this many private key operations get a blinding of their own at
+ * the same time; any more share rsa->mt_blinding. */
+#define RSA_MAX_THREAD_BLINDINGS	64
+
+/* rsa_get_blinding() sets *local to this for a blinding of rsa->thr_blinding,
+ * which rsa_put_thread_blinding() must hand back. */
+#define RSA_BLINDING_HELD		2
+
+/* rsa->thr_blinding (RSA_BLINDING_LIST in rsa_locl.h): a pool of
+ * blindings, each held by one thread for the length of a private key
+ * operation. A thread takes the one it used last if it is free and else any
+ * free one, so the pool grows with the number of operations running at
+ * once, not with the number of threads that ever used the key, and those of
+ * threads that have exited are taken over. Entries are only ever added at
+ * the head, with a compare-and-swap, and freed by RSA_free(), so that the
+ * list can be read without a lock. */
+
+static BN_BLINDING *rsa_get_thread_blinding(RSA *rsa, BN_CTX *ctx)
+	{
+	RSA_BLINDING_LIST *l,*head,*own=NULL,*any=NULL;
+	CRYPTO_THREADID cur;
+	int n=0;
+
+	CRYPTO_THREADID_current(&cur);
+	head=*(RSA_BLINDING_LIST * volatile *)&rsa->thr_blinding;
+	for (l=head; l != NULL; l=l->next, n++)
+		{
+		if (*(volatile int *)&l->busy)
+			continue;
+		if (!CRYPTO_THREADID_cmp(&cur, BN_BLINDING_thread_id(l->blinding)))
+			{
+			own=l;
+			break;
+			}
+		if (any == NULL)
+			any=l;
+		}
+	if (own != NULL && __sync_bool_compare_and_swap(&own->busy, 0, 1))
+		return own->blinding;
+	for (l=any; l != NULL; l=l->next)
+		if (!*(volatile int *)&l->busy &&
+		    __sync_bool_compare_and_swap(&l->busy, 0, 1))
+			{
+			CRYPTO_THREADID_cpy(BN_BLINDING_thread_id(l->blinding), &cur);
+			return l->blinding;
+			}
+	if (n >= RSA_MAX_THREAD_BLINDINGS)
+		return NULL;
+
+	if ((l=OPENSSL_malloc(sizeof(*l))) == NULL)
+		return NULL;
+	if ((l->blinding=RSA_setup_blinding(rsa, ctx)) == NULL)
+		{
+		OPENSSL_free(l);
+		return NULL;
+		}
+	l->busy=1;
+	for (;;)
+		{
+		l->next=head;
+		if (__sync_bool_compare_and_swap(&rsa->thr_blinding, head, l))
+			break;
+		head=rsa->thr_blinding;
+		}
+	return l->blinding;
+	}
+
+static void rsa_put_thread_blinding(RSA *rsa, BN_BLINDING *b)
+	{
+	RSA_BLINDING_LIST *l;
+
+	for (l=rsa->thr_blinding; l != NULL; l=l->next)
+		if (l->blinding == b)
+			{
+			__sync_lock_release(&l->busy);
+			return;
+			}
+	}
+#endif
+
 static BN_BLINDING *rsa_get_blinding(RSA *rsa, int *local, BN_CTX *ctx)
 {
 	BN_BLINDING *ret;
 	int got_write_lock = 0;
 	CRYPTO_THREADID cur;
 
+#ifdef RSA_THREAD_BLINDING
+	/* A blinding of the pool, without taking CRYPTO_LOCK_RSA */
+	if ((ret = rsa_get_thread_blinding(rsa, ctx)) != NULL)
+		{
+		*local = RSA_BLINDING_HELD;
+		return ret;
+		}
+#endif
+
 	CRYPTO_r_lock(CRYPTO_LOCK_RSA);
 
 	if (rsa->blinding == NULL)
@@ -445,7 +550,7 @@ static int RSA_eay_private_encrypt(int flen, const unsigned char *from,
 			d= rsa->d;
 
 		if (rsa->flags & RSA_FLAG_CACHE_PUBLIC)
-			if(!BN_MONT_CTX_set_locked(&rsa->_method_mod_n, CRYPTO_LOCK_RSA, rsa->n, ctx))
+			if(!rsa_mont_ctx(rsa, &rsa->_method_mod_n, rsa->n, ctx))
 				goto err;
 
 		if (!rsa->meth->bn_mod_exp(ret,f,d,rsa->n,ctx,
@@ -476,6 +581,10 @@ static int RSA_eay_private_encrypt(int flen, const unsigned char *from,
 
 	r=num;
 err:
+#ifdef RSA_THREAD_BLINDING
+	if (local_blinding == RSA_BLINDING_HELD)
+		rsa_put_thread_blinding(rsa, blinding);
+#endif
 	if (ctx != NULL)
 		{
 		BN_CTX_end(ctx);
@@ -578,7 +687,7 @@ static int RSA_eay_private_decrypt(int flen, const unsigned char *from,
 			d = rsa->d;
 
 		if (rsa->flags & RSA_FLAG_CACHE_PUBLIC)
-			if (!BN_MONT_CTX_set_locked(&rsa->_method_mod_n, CRYPTO_LOCK_RSA, rsa->n, ctx))
+			if (!rsa_mont_ctx(rsa, &rsa->_method_mod_n, rsa->n, ctx))
 				goto err;
 		if (!rsa->meth->bn_mod_exp(ret,f,d,rsa->n,ctx,
 				rsa->_method_mod_n))
@@ -616,6 +725,10 @@ static int RSA_eay_private_decrypt(int flen, const unsigned char *from,
 		RSAerr(RSA_F_RSA_EAY_PRIVATE_DECRYPT,RSA_R_PADDING_CHECK_FAILED);
 
 err:
+#ifdef RSA_THREAD_BLINDING
+	if (local_blinding == RSA_BLINDING_HELD)
+		rsa_put_thread_blinding(rsa, blinding);
+#endif
 	if (ctx != NULL)
 		{
 		BN_CTX_end(ctx);
@@ -690,7 +803,7 @@ static int RSA_eay_public_decrypt(int flen, const unsigned char *from,
 		}
 
 	if (rsa->flags & RSA_FLAG_CACHE_PUBLIC)
-		if (!BN_MONT_CTX_set_locked(&rsa->_method_mod_n, CRYPTO_LOCK_RSA, rsa->n, ctx))
+		if (!rsa_mont_ctx(rsa, &rsa->_method_mod_n, rsa->n, ctx))
 			goto err;
 
 	if (!rsa->meth->bn_mod_exp(ret,f,rsa->e,rsa->n,ctx,
@@ -771,15 +884,15 @@ static int RSA_eay_mod_exp(BIGNUM *r0, const BIGNUM *I, RSA *rsa, BN_CTX *ctx)
 
 		if (rsa->flags & RSA_FLAG_CACHE_PRIVATE)
 			{
-			if (!BN_MONT_CTX_set_locked(&rsa->_method_mod_p, CRYPTO_LOCK_RSA, p, ctx))
+			if (!rsa_mont_ctx(rsa, &rsa->_method_mod_p, p, ctx))
 				goto err;
-			if (!BN_MONT_CTX_set_locked(&rsa->_method_mod_q, CRYPTO_LOCK_RSA, q, ctx))
+			if (!rsa_mont_ctx(rsa, &rsa->_method_mod_q, q, ctx))
 				goto err;
 			}
 	}
 
 	if (rsa->flags & RSA_FLAG_CACHE_PUBLIC)
-		if (!BN_MONT_CTX_set_locked(&rsa->_method_mod_n, CRYPTO_LOCK_RSA, rsa->n, ctx))
+		if (!rsa_mont_ctx(rsa, &rsa->_method_mod_n, rsa->n, ctx))
 			goto err;
 
 	/* compute I mod q */
@@ -63,6 +63,7 @@
 #include <openssl/bn.h>
 #include <openssl/rsa.h>
 #include <openssl/rand.h>
+#include "rsa_locl.h"
 #ifndef OPENSSL_NO_ENGINE
 #include <openssl/engine.h>
 #endif
@@ -187,6 +188,7 @@ RSA *RSA_new_method(ENGINE *engine)
 	ret->_method_mod_q=NULL;
 	ret->blinding=NULL;
 	ret->mt_blinding=NULL;
+	ret->thr_blinding=NULL;
 	ret->bignum_data=NULL;
 	ret->flags=ret->meth->flags & ~RSA_FLAG_NON_FIPS_ALLOW;
 	if (!CRYPTO_new_ex_data(CRYPTO_EX_INDEX_RSA, ret, &ret->ex_data))
@@ -250,6 +252,14 @@ void RSA_free(RSA *r)
 	if (r->iqmp != NULL) BN_clear_free(r->iqmp);
 	if (r->blinding != NULL) BN_BLINDING_free(r->blinding);
 	if (r->mt_blinding != NULL) BN_BLINDING_free(r->mt_blinding);
+	while (r->thr_blinding != NULL)
+		{
+		RSA_BLINDING_LIST *l=r->thr_blinding;
+
+		r->thr_blinding=l->next;
+		BN_BLINDING_free(l->blinding);
+		OPENSSL_free(l);
+		}
 	if (r->bignum_data != NULL) OPENSSL_free_locked(r->bignum_data);
 	OPENSSL_free(r);
 	}
@@ -2,3 +2,12 @@ extern int int_rsa_verify(int dtype, const unsigned char *m, unsigned int m_len,
 		unsigned char *rm, size_t *prm_len,
 		const unsigned char *sigbuf, size_t siglen,
 		RSA *rsa);
+
+/* An entry of rsa->thr_blinding, see rsa_eay.c; RSA_free() frees them,
+ * since methods borrowing the eay functions bring their own finish. */
+typedef struct rsa_blinding_list_st
+	{
+	BN_BLINDING *blinding;
+	int busy;
+	struct rsa_blinding_list_st *next;
+	} RSA_BLINDING_LIST;
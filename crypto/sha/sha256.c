@@ -103,10 +103,27 @@ int SHA224_Final (unsigned char *md, SHA256_CTX *c)
 	}				\
 	} while (0)
 
+/*
+ * On x86_64 the block function is picked at run time: the SHA extensions
+ * if the processor has them, else the assembler (or C) code. Clearing bit
+ * #29 (SHA) of the leaf 7 word of OPENSSL_ia32cap disables the former.
+ */
+#if !defined(OPENSSL_NO_ASM) && defined(OPENSSL_CPUID_OBJ) && \
+	(defined(__x86_64) || defined(__x86_64__)) && (defined(__clang__) || \
+	(defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+# define SHA256_SIMD
+# include <immintrin.h>
+#endif
+
 #define	HASH_UPDATE		SHA256_Update
 #define	HASH_TRANSFORM		SHA256_Transform
 #define	HASH_FINAL		SHA256_Final
+#ifdef SHA256_SIMD
+#define	HASH_BLOCK_DATA_ORDER	sha256_block_simd
+static void sha256_block_simd (SHA256_CTX *ctx, const void *in, size_t num);
+#else
 #define	HASH_BLOCK_DATA_ORDER	sha256_block_data_order
+#endif
 #ifndef SHA256_ASM
 static
 #endif
@@ -114,7 +131,7 @@ void sha256_block_data_order (SHA256_CTX *ctx, const void *in, size_t num);
 
 #include "md32_common.h"
 
-#ifndef SHA256_ASM
+#if !defined(SHA256_ASM) || defined(SHA256_SIMD)
 static const SHA_LONG K256[64] = {
 	0x428a2f98UL,0x71374491UL,0xb5c0fbcfUL,0xe9b5dba5UL,
 	0x3956c25bUL,0x59f111f1UL,0x923f82a4UL,0xab1c5ed5UL,
@@ -145,7 +162,9 @@ static const SHA_LONG K256[64] = {
 
 #define Ch(x,y,z)	(((x) & (y)) ^ ((~(x)) & (z)))
 #define Maj(x,y,z)	(((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
+#endif
 
+#ifndef SHA256_ASM
 #ifdef OPENSSL_SMALL_FOOTPRINT
 
 static void sha256_block_data_order (SHA256_CTX *ctx, const void *in, size_t num)
@@ -279,4 +298,69 @@ static void sha256_block_data_order (SHA256_CTX *ctx, const void *in, size_t num
 #endif
 #endif /* SHA256_ASM */
 
+#ifdef SHA256_SIMD
+extern unsigned int OPENSSL_ia32cap_P[];
+
+/* Four rounds with the SHA extensions, on the message words in |m|. */
+#define SHAEXT_ROUNDS(m,k)	do {					\
+	msg = _mm_add_epi32(m, _mm_loadu_si128((const __m128i *)(k)));	\
+	state1 = _mm_sha256rnds2_epu32(state1, state0, msg);		\
+	msg = _mm_shuffle_epi32(msg, 0x0e);				\
+	state0 = _mm_sha256rnds2_epu32(state0, state1, msg);	} while (0)
+
+__attribute__((target("sha,sse4.1")))
+static void sha256_block_shaext (SHA256_CTX *ctx, const void *in, size_t num)
+	{
+	const unsigned char *data=in;
+	const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+					     0x0405060700010203ULL);
+	__m128i state0, state1, save0, save1, msg, tmp, w[4];
+	int i;
+
+	/* The instructions keep the state as ABEF and CDGH. */
+	tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&ctx->h[0]), 0xb1);
+	state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&ctx->h[4]), 0x1b);
+	state0 = _mm_alignr_epi8(tmp, state1, 8);
+	state1 = _mm_blend_epi16(state1, tmp, 0xf0);
+
+	while (num--)
+		{
+		save0 = state0;
+		save1 = state1;
+
+		for (i=0;i<4;i++)
+			{
+			w[i] = _mm_shuffle_epi8(_mm_loadu_si128(
+				(const __m128i *)(data+16*i)), bswap);
+			SHAEXT_ROUNDS(w[i], &K256[4*i]);
+			}
+		for (;i<16;i++)
+			{
+			tmp = _mm_sha256msg1_epu32(w[i&3], w[(i+1)&3]);
+			tmp = _mm_add_epi32(tmp, _mm_alignr_epi8(w[(i+3)&3], w[(i+2)&3], 4));
+			w[i&3] = _mm_sha256msg2_epu32(tmp, w[(i+3)&3]);
+			SHAEXT_ROUNDS(w[i&3], &K256[4*i]);
+			}
+
+		state0 = _mm_add_epi32(state0, save0);
+		state1 = _mm_add_epi32(state1, save1);
+		data += SHA256_CBLOCK;
+		}
+
+	tmp = _mm_shuffle_epi32(state0, 0x1b);
+	state1 = _mm_shuffle_epi32(state1, 0xb1);
+	_mm_storeu_si128((__m128i *)&ctx->h[0], _mm_blend_epi16(tmp, state1, 0xf0));
+	_mm_storeu_si128((__m128i *)&ctx->h[4], _mm_alignr_epi8(state1, tmp, 8));
+	}
+
+static void sha256_block_simd (SHA256_CTX *ctx, const void *in, size_t num)
+	{
+	if ((OPENSSL_ia32cap_P[2] & (1<<29)) &&		/* SHA */
+	    (OPENSSL_ia32cap_P[1] & (1<<19)))		/* SSE4.1 */
+		sha256_block_shaext(ctx, in, num);
+	else
+		sha256_block_data_order(ctx, in, num);
+	}
+#endif /* SHA256_SIMD */
+
 #endif /* OPENSSL_NO_SHA256 */
@@ -0,0 +1,409 @@
+/* crypto/threads/lock_pthread.c */
+/*
+ * Built-in locking callbacks on POSIX threads.
+ *
+ * CRYPTO_thread_setup_pthreads() installs a locking callback with one
+ * reader/writer lock per CRYPTO_LOCK_* id, so CRYPTO_r_lock() callers (the
+ * session cache, RSA blinding, ex_data, ...) no longer exclude each other,
+ * dynamic lock callbacks with a reader/writer lock per dynamic lock, and an
+ * add_lock callback doing CRYPTO_add() with atomic instructions instead of
+ * taking the lock where the compiler has them. Every lock id of
+ * CRYPTO_get_new_lockid() gets a reader/writer lock of its own the first
+ * time it is taken, so the application may nest them like the library's.
+ *
+ * With CRYPTO_PTHREADS_LOCK_STATS, every acquisition is counted per lock id
+ * (all dynamic locks together and all application locks together), and
+ * one that finds the lock taken also
+ * adds the time it waited. CRYPTO_lock_stats() reads the counters,
+ * CRYPTO_lock_stats_print() lists the locks by the time spent waiting for
+ * them and CRYPTO_lock_stats_reset() starts over; all three may be called
+ * while other threads go on. The counters are not exact under concurrent
+ * updates without the GCC atomic builtins.
+ *
+ * Call it before starting threads that use the library and
+ * CRYPTO_thread_cleanup_pthreads(), which puts back the callbacks there
+ * were before, after they are done.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../cryptlib.h"
+#include <openssl/crypto.h>
+#include <openssl/bio.h>
+
+#if defined(OPENSSL_THREADS) && !defined(OPENSSL_SYS_WINDOWS) && !defined(OPENSSL_SYS_NETWARE) && !defined(OPENSSL_SYS_VMS)
+
+#include <pthread.h>
+#include <time.h>
+#include <sys/time.h>
+
+#ifdef __GNUC__
+#define LOCK_STAT_ADD(v,n)	__sync_fetch_and_add(&(v),(n))
+#else
+#define LOCK_STAT_ADD(v,n)	((v)+=(n))
+#endif
+
+/* Counters of one lock id, a cache line each so that threads counting
+ * different locks don't share lines. */
+typedef struct lock_stat_st
+	{
+	unsigned long read;
+	unsigned long write;
+	unsigned long contended;
+	unsigned long wait_ns;
+	unsigned long max_wait_ns;
+	unsigned char pad[64-5*sizeof(unsigned long)];
+	} LOCK_STAT;
+
+struct CRYPTO_dynlock_value
+	{
+	pthread_rwlock_t lock;
+	};
+
+/* The application's lock ids come after the library's ones and get their
+ * locks in chunks of APP_LOCK_CHUNK, made when one of the chunk is first
+ * taken. A chunk never moves once published, so taking a lock looks it up
+ * without locking. */
+#define APP_LOCK_CHUNK	64
+#define APP_LOCK_CHUNKS	256
+
+/* locks has one per library lock id; lock_stats has one more entry for
+ * the application's lock ids and another for the dynamic locks */
+static pthread_rwlock_t *locks=NULL;
+static pthread_rwlock_t *app_locks[APP_LOCK_CHUNKS];
+static pthread_mutex_t app_locks_mutex=PTHREAD_MUTEX_INITIALIZER;
+static LOCK_STAT *lock_stats=NULL;
+static int lock_num=0;
+
+static void (*old_locking_cb)(int mode,int type,const char *file,int line);
+static int (*old_add_lock_cb)(int *num,int mount,int type,const char *file,
+	int line);
+static struct CRYPTO_dynlock_value *(*old_dyn_create_cb)(const char *file,
+	int line);
+static void (*old_dyn_lock_cb)(int mode,struct CRYPTO_dynlock_value *l,
+	const char *file,int line);
+static void (*old_dyn_destroy_cb)(struct CRYPTO_dynlock_value *l,
+	const char *file,int line);
+
+static unsigned long lock_now(void)
+	{
+#ifdef CLOCK_MONOTONIC
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC,&ts);
+	return (unsigned long)ts.tv_sec*1000000000UL+ts.tv_nsec;
+#else
+	struct timeval tv;
+
+	gettimeofday(&tv,NULL);
+	return (unsigned long)tv.tv_sec*1000000000UL+tv.tv_usec*1000UL;
+#endif
+	}
+
+static void lock_rw(pthread_rwlock_t *l, int mode, LOCK_STAT *st)
+	{
+	unsigned long t;
+	int ret;
+
+	if (mode & CRYPTO_UNLOCK)
+		{
+		pthread_rwlock_unlock(l);
+		return;
+		}
+	if (st == NULL)
+		{
+		if (mode & CRYPTO_READ)
+			pthread_rwlock_rdlock(l);
+		else
+			pthread_rwlock_wrlock(l);
+		return;
+		}
+
+	if (mode & CRYPTO_READ)
+		ret=pthread_rwlock_tryrdlock(l);
+	else
+		ret=pthread_rwlock_trywrlock(l);
+	if (ret != 0)
+		{
+		t=lock_now();
+		if (mode & CRYPTO_READ)
+			pthread_rwlock_rdlock(l);
+		else
+			pthread_rwlock_wrlock(l);
+		t=lock_now()-t;
+		LOCK_STAT_ADD(st->contended,1);
+		LOCK_STAT_ADD(st->wait_ns,t);
+		if (t > st->max_wait_ns)
+			st->max_wait_ns=t;
+		}
+	if (mode & CRYPTO_READ)
+		LOCK_STAT_ADD(st->read,1);
+	else
+		LOCK_STAT_ADD(st->write,1);
+	}
+
+static pthread_rwlock_t *app_lock(int type, const char *file, int line)
+	{
+	pthread_rwlock_t *chunk;
+	int i,j,n;
+
+	/* CRYPTO_get_new_lockid() hands out lock_num+1 onwards */
+	i=type-lock_num-1;
+	if (type <= lock_num || i >= APP_LOCK_CHUNK*APP_LOCK_CHUNKS)
+		OpenSSLDie(file,line,"lock id out of range");
+	n=i/APP_LOCK_CHUNK;
+	if ((chunk=app_locks[n]) != NULL)
+		return &chunk[i%APP_LOCK_CHUNK];
+
+	pthread_mutex_lock(&app_locks_mutex);
+	if ((chunk=app_locks[n]) == NULL)
+		{
+		chunk=OPENSSL_malloc(APP_LOCK_CHUNK*sizeof(*chunk));
+		if (chunk == NULL)
+			OpenSSLDie(file,line,"out of memory for locks");
+		for (j=0; j<APP_LOCK_CHUNK; j++)
+			pthread_rwlock_init(&chunk[j],NULL);
+#ifdef __GNUC__
+		/* the locks are set up before others can see them */
+		__sync_synchronize();
+#endif
+		app_locks[n]=chunk;
+		}
+	pthread_mutex_unlock(&app_locks_mutex);
+	return &chunk[i%APP_LOCK_CHUNK];
+	}
+
+static void pthreads_locking_cb(int mode, int type, const char *file,
+	int line)
+	{
+	if (type >= 0 && type < lock_num)
+		lock_rw(&locks[type],mode,lock_stats ? &lock_stats[type] : NULL);
+	else
+		lock_rw(app_lock(type,file,line),mode,
+			lock_stats ? &lock_stats[lock_num] : NULL);
+	}
+
+#ifdef __GNUC__
+static int pthreads_add_lock_cb(int *num, int mount, int type,
+	const char *file, int line)
+	{
+	return __sync_add_and_fetch(num,mount);
+	}
+#endif
+
+static struct CRYPTO_dynlock_value *pthreads_dyn_create_cb(const char *file,
+	int line)
+	{
+	struct CRYPTO_dynlock_value *l;
+
+	if ((l=OPENSSL_malloc(sizeof(*l))) == NULL)
+		return NULL;
+	if (pthread_rwlock_init(&l->lock,NULL) != 0)
+		{
+		OPENSSL_free(l);
+		return NULL;
+		}
+	return l;
+	}
+
+static void pthreads_dyn_lock_cb(int mode, struct CRYPTO_dynlock_value *l,
+	const char *file, int line)
+	{
+	lock_rw(&l->lock,mode,lock_stats ? &lock_stats[lock_num+1] : NULL);
+	}
+
+static void pthreads_dyn_destroy_cb(struct CRYPTO_dynlock_value *l,
+	const char *file, int line)
+	{
+	pthread_rwlock_destroy(&l->lock);
+	OPENSSL_free(l);
+	}
+
+static void pthreads_threadid_cb(CRYPTO_THREADID *id)
+	{
+	CRYPTO_THREADID_set_numeric(id,(unsigned long)pthread_self());
+	}
+
+int CRYPTO_thread_setup_pthreads(int flags)
+	{
+	int i;
+
+	if (locks != NULL)
+		return 0;
+	lock_num=CRYPTO_num_locks();
+	if ((locks=OPENSSL_malloc(lock_num*sizeof(*locks))) == NULL)
+		return 0;
+	if (flags & CRYPTO_PTHREADS_LOCK_STATS)
+		{
+		lock_stats=OPENSSL_malloc((lock_num+2)*sizeof(*lock_stats));
+		if (lock_stats == NULL)
+			{
+			OPENSSL_free(locks);
+			locks=NULL;
+			return 0;
+			}
+		memset(lock_stats,0,(lock_num+2)*sizeof(*lock_stats));
+		}
+	for (i=0; i<lock_num; i++)
+		pthread_rwlock_init(&locks[i],NULL);
+
+	/* Only takes if there is none yet; the default is fine too */
+	CRYPTO_THREADID_set_callback(pthreads_threadid_cb);
+
+	old_locking_cb=CRYPTO_get_locking_callback();
+	old_add_lock_cb=CRYPTO_get_add_lock_callback();
+	old_dyn_create_cb=CRYPTO_get_dynlock_create_callback();
+	old_dyn_lock_cb=CRYPTO_get_dynlock_lock_callback();
+	old_dyn_destroy_cb=CRYPTO_get_dynlock_destroy_callback();
+	CRYPTO_set_locking_callback(pthreads_locking_cb);
+#ifdef __GNUC__
+	CRYPTO_set_add_lock_callback(pthreads_add_lock_cb);
+#endif
+	CRYPTO_set_dynlock_create_callback(pthreads_dyn_create_cb);
+	CRYPTO_set_dynlock_lock_callback(pthreads_dyn_lock_cb);
+	CRYPTO_set_dynlock_destroy_callback(pthreads_dyn_destroy_cb);
+	return 1;
+	}
+
+/* Dynamic locks made before must all be gone by now. */
+void CRYPTO_thread_cleanup_pthreads(void)
+	{
+	int i,n;
+
+	if (locks == NULL)
+		return;
+	CRYPTO_set_locking_callback(old_locking_cb);
+	CRYPTO_set_add_lock_callback(old_add_lock_cb);
+	CRYPTO_set_dynlock_create_callback(old_dyn_create_cb);
+	CRYPTO_set_dynlock_lock_callback(old_dyn_lock_cb);
+	CRYPTO_set_dynlock_destroy_callback(old_dyn_destroy_cb);
+	for (i=0; i<lock_num; i++)
+		pthread_rwlock_destroy(&locks[i]);
+	OPENSSL_free(locks);
+	locks=NULL;
+	for (n=0; n<APP_LOCK_CHUNKS; n++)
+		{
+		if (app_locks[n] == NULL)
+			continue;
+		for (i=0; i<APP_LOCK_CHUNK; i++)
+			pthread_rwlock_destroy(&app_locks[n][i]);
+		OPENSSL_free(app_locks[n]);
+		app_locks[n]=NULL;
+		}
+	if (lock_stats != NULL)
+		OPENSSL_free(lock_stats);
+	lock_stats=NULL;
+	}
+
+int CRYPTO_lock_stats(int type, CRYPTO_LOCK_STATS *st)
+	{
+	LOCK_STAT *s;
+
+	if (lock_stats == NULL)
+		return 0;
+	if (type < 0)
+		s=&lock_stats[lock_num+1];
+	else if (type >= lock_num)
+		s=&lock_stats[lock_num];
+	else
+		s=&lock_stats[type];
+	st->read=s->read;
+	st->write=s->write;
+	st->contended=s->contended;
+	st->wait=s->wait_ns/1e9;
+	st->max_wait=s->max_wait_ns/1e9;
+	return 1;
+	}
+
+void CRYPTO_lock_stats_reset(void)
+	{
+	if (lock_stats != NULL)
+		memset(lock_stats,0,(lock_num+2)*sizeof(*lock_stats));
+	}
+
+static int lock_stats_cmp(const void *a, const void *b)
+	{
+	const LOCK_STAT *x=&lock_stats[*(const int *)a];
+	const LOCK_STAT *y=&lock_stats[*(const int *)b];
+
+	if (x->wait_ns != y->wait_ns)
+		return x->wait_ns < y->wait_ns ? 1 : -1;
+	if (x->contended != y->contended)
+		return x->contended < y->contended ? 1 : -1;
+	return (int)(y->read+y->write > x->read+x->write) -
+		(int)(y->read+y->write < x->read+x->write);
+	}
+
+void CRYPTO_lock_stats_print(BIO *bio)
+	{
+	int *order,i,n=0;
+	LOCK_STAT *s;
+	const char *name;
+
+	if (lock_stats == NULL)
+		return;
+	if ((order=OPENSSL_malloc((lock_num+2)*sizeof(*order))) == NULL)
+		return;
+	for (i=0; i<lock_num+2; i++)
+		if (lock_stats[i].read+lock_stats[i].write > 0)
+			order[n++]=i;
+	qsort(order,n,sizeof(*order),lock_stats_cmp);
+
+	BIO_printf(bio,"%-22s %12s %12s %10s %7s %12s %10s\n","lock",
+		"read","write","contended","%","wait s","max ms");
+	for (i=0; i<n; i++)
+		{
+		s=&lock_stats[order[i]];
+		if (order[i] == lock_num)
+			name="application";
+		else if (order[i] == lock_num+1)
+			name="dynamic";
+		else
+			name=CRYPTO_get_lock_name(order[i]);
+		BIO_printf(bio,"%-22s %12lu %12lu %10lu %6.2f%% %12.6f %10.3f\n",
+			name,s->read,s->write,s->contended,
+			100.0*s->contended/(s->read+s->write),
+			s->wait_ns/1e9,s->max_wait_ns/1e6);
+		}
+	OPENSSL_free(order);
+	}
+
+#else /* OPENSSL_THREADS ... */
+
+int CRYPTO_thread_setup_pthreads(int flags)
+	{
+	return 0;
+	}
+
+void CRYPTO_thread_cleanup_pthreads(void)
+	{
+	}
+
+int CRYPTO_lock_stats(int type, CRYPTO_LOCK_STATS *st)
+	{
+	return 0;
+	}
+
+void CRYPTO_lock_stats_reset(void)
+	{
+	}
+
+void CRYPTO_lock_stats_print(BIO *bio)
+	{
+	}
+
+#endif
+
+#ifndef OPENSSL_NO_FP_API
+void CRYPTO_lock_stats_print_fp(FILE *fp)
+	{
+	BIO *b;
+
+	if ((b=BIO_new(BIO_s_file())) == NULL)
+		return;
+	BIO_set_fp(b,fp,BIO_NOCLOSE);
+	CRYPTO_lock_stats_print(b);
+	BIO_free(b);
+	}
+#endif
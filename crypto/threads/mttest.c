@@ -115,13 +115,11 @@ void do_threads(SSL_CTX *s_ctx,SSL_CTX *c_ctx);
 void irix_locking_callback(int mode,int type,char *file,int line);
 void solaris_locking_callback(int mode,int type,char *file,int line);
 void win32_locking_callback(int mode,int type,char *file,int line);
-void pthreads_locking_callback(int mode,int type,char *file,int line);
 void netware_locking_callback(int mode,int type,char *file,int line);
 void beos_locking_callback(int mode,int type,const char *file,int line);
 
 unsigned long irix_thread_id(void );
 unsigned long solaris_thread_id(void );
-unsigned long pthreads_thread_id(void );
 unsigned long netware_thread_id(void );
 unsigned long beos_thread_id(void );
 
@@ -347,12 +345,21 @@ end:
 		print_stats(stderr,s_ctx);
 		if (cache_stats)
 			{
-			fprintf(stderr,"-----\n");
-			lh_stats(SSL_CTX_sessions(s_ctx),stderr);
-			fprintf(stderr,"-----\n");
-		/*	lh_node_stats(SSL_CTX_sessions(s_ctx),stderr);
-			fprintf(stderr,"-----\n"); */
-			lh_node_usage_stats(SSL_CTX_sessions(s_ctx),stderr);
+			LHASH_OF(SSL_SESSION) *lh;
+			unsigned int sh;
+
+			/* a table per shard of the session cache */
+			for (sh=0; (lh=SSL_CTX_sessions_shard(s_ctx,sh)) != NULL;
+				sh++)
+				{
+				fprintf(stderr,"----- shard %u\n",sh);
+				lh_stats(CHECKED_LHASH_OF(SSL_SESSION,lh),stderr);
+				fprintf(stderr,"-----\n");
+			/*	lh_node_stats(CHECKED_LHASH_OF(SSL_SESSION,lh),stderr);
+				fprintf(stderr,"-----\n"); */
+				lh_node_usage_stats(CHECKED_LHASH_OF(SSL_SESSION,lh),
+					stderr);
+				}
 			fprintf(stderr,"-----\n");
 			}
 		SSL_CTX_free(s_ctx);
@@ -1023,69 +1030,20 @@ unsigned long irix_thread_id(void)
 
 #ifdef PTHREADS
 
-static pthread_mutex_t *lock_cs;
-static long *lock_count;
-
+/* The library's own reader/writer locks, with their contention counted */
 void thread_setup(void)
 	{
-	int i;
-
-	lock_cs=OPENSSL_malloc(CRYPTO_num_locks() * sizeof(pthread_mutex_t));
-	lock_count=OPENSSL_malloc(CRYPTO_num_locks() * sizeof(long));
-	for (i=0; i<CRYPTO_num_locks(); i++)
-		{
-		lock_count[i]=0;
-		pthread_mutex_init(&(lock_cs[i]),NULL);
-		}
-
-	CRYPTO_set_id_callback((unsigned long (*)())pthreads_thread_id);
-	CRYPTO_set_locking_callback((void (*)())pthreads_locking_callback);
+	CRYPTO_thread_setup_pthreads(CRYPTO_PTHREADS_LOCK_STATS);
 	}
 
 void thread_cleanup(void)
 	{
-	int i;
-
-	CRYPTO_set_locking_callback(NULL);
 	fprintf(stderr,"cleanup\n");
-	for (i=0; i<CRYPTO_num_locks(); i++)
-		{
-		pthread_mutex_destroy(&(lock_cs[i]));
-		fprintf(stderr,"%8ld:%s\n",lock_count[i],
-			CRYPTO_get_lock_name(i));
-		}
-	OPENSSL_free(lock_cs);
-	OPENSSL_free(lock_count);
-
+	CRYPTO_lock_stats_print_fp(stderr);
+	CRYPTO_thread_cleanup_pthreads();
 	fprintf(stderr,"done cleanup\n");
 	}
 
-void pthreads_locking_callback(int mode, int type, char *file,
-	     int line)
-      {
-#ifdef undef
-	fprintf(stderr,"thread=%4d mode=%s lock=%s %s:%d\n",
-		CRYPTO_thread_id(),
-		(mode&CRYPTO_LOCK)?"l":"u",
-		(type&CRYPTO_READ)?"r":"w",file,line);
-#endif
-/*
-	if (CRYPTO_LOCK_SSL_CERT == type)
-		fprintf(stderr,"(t,m,f,l) %ld %d %s %d\n",
-		CRYPTO_thread_id(),
-		mode,file,line);
-*/
-	if (mode & CRYPTO_LOCK)
-		{
-		pthread_mutex_lock(&(lock_cs[type]));
-		lock_count[type]++;
-		}
-	else
-		{
-		pthread_mutex_unlock(&(lock_cs[type]));
-		}
-	}
-
 void do_threads(SSL_CTX *s_ctx, SSL_CTX *c_ctx)
 	{
 	SSL_CTX *ssl_ctx[2];
@@ -1114,14 +1072,6 @@ void do_threads(SSL_CTX *s_ctx, SSL_CTX *c_ctx)
 		s_ctx->references,c_ctx->references);
 	}
 
-unsigned long pthreads_thread_id(void)
-	{
-	unsigned long ret;
-
-	ret=(unsigned long)pthread_self();
-	return(ret);
-	}
-
 #endif /* PTHREADS */
 
 
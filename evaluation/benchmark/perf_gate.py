@@ -0,0 +1,256 @@
+#! /usr/bin/env python
+
+# Performance regression gate for the SPP handshake and record paths.
+#
+# Runs a fixed set of sppbench workloads (test/sppbench, see ssl/sppbench.c)
+# a few times after a warmup round, summarises every metric with its mean
+# and 95% confidence interval and writes it all, raw samples included, to a
+# JSON file. Given a baseline file from an earlier run, it compares the two
+# with Welch's t-test and exits with status 1 if any metric got slower by
+# more than --threshold with a one-sided p below --alpha.
+#
+# The results also go out as res_* files in the format of
+# ../results/final, so that ../results/plot.py can draw them (experiment
+# types 10 and 11).
+#
+# "make bench_gate" in test/ runs it; copy the perf_gate.json it leaves to
+# perf_baseline.json there to make it the baseline of later runs.
+
+import sys
+import os
+import json
+import math
+import time
+import shlex
+import socket
+import argparse
+import subprocess
+from collections import defaultdict
+
+# name -> sppbench arguments, the metrics to keep and whether higher or lower
+# is better for each
+WORKLOADS = [
+    ('handshake', '-proxies 0,1,2 -slices 4 -conns 50 -bytes 1024',
+        {'handshake_ms': 'lower'}),
+    ('handshake_tls', '-tls -conns 50 -bytes 1024',
+        {'handshake_ms': 'lower'}),
+    ('record', '-proxies 0,1 -slices 1,4 -record 1024,16384 -conns 2 -bytes 2097152',
+        {'bytes_per_sec': 'higher', 'records_per_sec': 'higher'}),
+    ('record_tls', '-tls -record 1024,16384 -conns 2 -bytes 2097152',
+        {'bytes_per_sec': 'higher', 'records_per_sec': 'higher'}),
+]
+
+# Fields of an sppbench line that tell its configurations apart
+KEY_FIELDS = ('mode', 'proxies', 'slices', 'read_proxies', 'write_proxies',
+    'record', 'cipher')
+
+# Two-sided 95% quantiles of Student's t for 1..30 degrees of freedom
+T95 = [12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262,
+    2.228, 2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093,
+    2.086, 2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045,
+    2.042]
+
+def t95(df):
+    if df < 1:
+        return float('nan')
+    return T95[df - 1] if df <= len(T95) else 1.960
+
+def mean_stddev(xs):
+    n = len(xs)
+    mean = sum(xs) / float(n)
+    if n < 2:
+        return mean, 0.0
+    return mean, math.sqrt(sum((x - mean) ** 2 for x in xs) / (n - 1))
+
+# Regularized incomplete beta function I_x(a, b), Numerical Recipes' betacf
+def betainc(a, b, x):
+    if x <= 0:
+        return 0.0
+    if x >= 1:
+        return 1.0
+    front = math.exp(math.lgamma(a + b) - math.lgamma(a) - math.lgamma(b) +\
+        a * math.log(x) + b * math.log(1 - x))
+    if x > (a + 1) / (a + b + 2):
+        return 1 - betainc(b, a, 1 - x)
+    tiny = 1e-300
+    c, d = 1.0, 1 - (a + b) * x / (a + 1)
+    d = 1 / (d if abs(d) > tiny else tiny)
+    f = d
+    for m in range(1, 300):
+        for num in (m * (b - m) * x / ((a + 2 * m - 1) * (a + 2 * m)),\
+                -(a + m) * (a + b + m) * x / ((a + 2 * m) * (a + 2 * m + 1))):
+            d = 1 + num * d
+            d = 1 / (d if abs(d) > tiny else tiny)
+            c = 1 + num / c
+            c = c if abs(c) > tiny else tiny
+            f *= c * d
+        if abs(c * d - 1) < 1e-12:
+            break
+    return front * f / a
+
+# One-sided p-value of Welch's t-test for mean(xs) > mean(ys)
+def welch_greater(xs, ys):
+    mx, sx = mean_stddev(xs)
+    my, sy = mean_stddev(ys)
+    vx, vy = sx ** 2 / len(xs), sy ** 2 / len(ys)
+    if vx + vy == 0:
+        return 0.0 if mx > my else 1.0
+    t = (mx - my) / math.sqrt(vx + vy)
+    den = (vx ** 2 / (len(xs) - 1) if len(xs) > 1 else 0) +\
+        (vy ** 2 / (len(ys) - 1) if len(ys) > 1 else 0)
+    df = (vx + vy) ** 2 / den if den > 0 else 1.0
+    p = 0.5 * betainc(df / 2, 0.5, df / (df + t * t))
+    return p if t > 0 else 1 - p
+
+def config_name(line):
+    return '%s p=%d s=%d r=%d w=%d rec=%d' % (line['mode'], line['proxies'],\
+        line['slices'], line['read_proxies'], line['write_proxies'],\
+        line['record'])
+
+def run_workload(sppbench, args):
+    cmd = shlex.split(sppbench) + shlex.split(args)
+    out = subprocess.check_output(cmd)
+    if not isinstance(out, str):
+        out = out.decode()
+    lines = []
+    for l in out.splitlines():
+        if not l.startswith('{'):
+            continue
+        line = json.loads(l)
+        if line.get('failed'):
+            raise RuntimeError('%s: %d connections failed' %\
+                (' '.join(cmd), line['failed']))
+        lines.append(line)
+    return lines
+
+def run(args):
+    # (workload, config) -> metric -> samples
+    samples = defaultdict(lambda: defaultdict(list))
+    configs = {}
+    # Interleave the workloads so that drift affects them all alike
+    for rep in range(args.warmup + args.reps):
+        for name, bench_args, metrics in WORKLOADS:
+            if rep < args.warmup:
+                sys.stderr.write('warmup %d/%d %s\n' % (rep + 1, args.warmup, name))
+            else:
+                sys.stderr.write('rep %d/%d %s\n' % (rep + 1 - args.warmup, args.reps, name))
+            for line in run_workload(args.sppbench, bench_args):
+                if rep < args.warmup:
+                    continue
+                key = (name, config_name(line))
+                configs[key] = dict((k, line[k]) for k in KEY_FIELDS if k in line)
+                for metric in metrics:
+                    samples[key][metric].append(line[metric])
+
+    results = []
+    for name, bench_args, metrics in WORKLOADS:
+        for key in sorted(k for k in samples if k[0] == name):
+            for metric, better in sorted(metrics.items()):
+                xs = samples[key][metric]
+                mean, stddev = mean_stddev(xs)
+                results.append({
+                    'workload': name,
+                    'config': key[1],
+                    'params': configs[key],
+                    'metric': metric,
+                    'better': better,
+                    'samples': xs,
+                    'mean': mean,
+                    'stddev': stddev,
+                    'ci95': t95(len(xs) - 1) * stddev / math.sqrt(len(xs)),
+                })
+    return {
+        'host': socket.gethostname(),
+        'time': time.strftime('%Y-%m-%dT%H:%M:%SZ', time.gmtime()),
+        'warmup': args.warmup,
+        'reps': args.reps,
+        'results': results,
+    }
+
+def compare(current, baseline, alpha, threshold):
+    base = dict(((r['workload'], r['config'], r['metric']), r)\
+        for r in baseline['results'])
+    regressions = 0
+    print('%-14s %-32s %-16s %12s %12s %8s %8s' % ('workload', 'config',\
+        'metric', 'baseline', 'current', 'change', 'p'))
+    for r in current['results']:
+        b = base.get((r['workload'], r['config'], r['metric']))
+        if b is None or b['mean'] == 0:
+            continue
+        change = (r['mean'] - b['mean']) / b['mean']
+        if r['better'] == 'lower':
+            slowdown, p = change, welch_greater(r['samples'], b['samples'])
+        else:
+            slowdown, p = -change, welch_greater(b['samples'], r['samples'])
+        verdict = ''
+        if slowdown > threshold and p < alpha:
+            verdict = 'REGRESSION'
+            regressions += 1
+        print('%-14s %-32s %-16s %12.6g %12.6g %+7.1f%% %8.4f %s' %\
+            (r['workload'], r['config'], r['metric'], b['mean'], r['mean'],\
+            change * 100, p, verdict))
+    return regressions
+
+# res_<proto>_<experiment> files as ../results/plot.py reads them: x, then
+# two parameters, then mean and standard deviation
+def write_plot_files(current, directory):
+    rows = defaultdict(list)
+    for r in current['results']:
+        params = r['params']
+        proto = 'spp' if params['mode'] == 'spp' else 'fwd'
+        if r['metric'] == 'handshake_ms' and params['slices'] in (0, 4):
+            rows['res_%s_handshake_proxy' % proto].append((params['proxies'],\
+                params['slices'], 0, r['mean'], r['stddev']))
+        elif r['metric'] == 'bytes_per_sec' and params['proxies'] == 0 and\
+                params['slices'] in (0, 4):
+            rows['res_%s_throughput_record' % proto].append((params['record'],\
+                params['slices'], params['proxies'], r['mean'], r['stddev']))
+    if not os.path.isdir(directory):
+        os.makedirs(directory)
+    for name in rows:
+        with open(os.path.join(directory, name), 'w') as f:
+            for row in sorted(rows[name]):
+                f.write('%d %d %d %g %g\n' % row)
+
+def main():
+    parser = argparse.ArgumentParser(formatter_class=argparse.ArgumentDefaultsHelpFormatter,\
+        description='Run the SPP benchmark workloads and compare them to a baseline.')
+    parser.add_argument('--sppbench', default='./sppbench', help='sppbench command')
+    parser.add_argument('--reps', type=int, default=5, help='measured repetitions')
+    parser.add_argument('--warmup', type=int, default=1, help='discarded repetitions')
+    parser.add_argument('--output', default='perf_gate.json', help='results file')
+    parser.add_argument('--baseline', help='results file of an earlier run to compare to; ignored if missing')
+    parser.add_argument('--alpha', type=float, default=0.05, help='significance level')
+    parser.add_argument('--threshold', type=float, default=0.05, help='smallest relative slowdown that fails')
+    parser.add_argument('--plot-dir', help='also write res_* files for ../results/plot.py here')
+    args = parser.parse_args()
+    if args.reps < 2:
+        parser.error('--reps must be at least 2')
+
+    try:
+        current = run(args)
+    except (OSError, subprocess.CalledProcessError, RuntimeError) as e:
+        sys.stderr.write('perf_gate: %s\n' % e)
+        return 2
+    with open(args.output, 'w') as f:
+        json.dump(current, f, indent=1, sort_keys=True)
+    print('[OUT] %s' % args.output)
+    if args.plot_dir:
+        write_plot_files(current, args.plot_dir)
+
+    if not args.baseline:
+        return 0
+    if not os.path.exists(args.baseline):
+        print('no baseline %s, not comparing' % args.baseline)
+        return 0
+    with open(args.baseline) as f:
+        baseline = json.load(f)
+    regressions = compare(current, baseline, args.alpha, args.threshold)
+    if regressions:
+        print('%d significant slowdown(s) against %s' % (regressions, args.baseline))
+        return 1
+    print('no significant slowdowns against %s' % args.baseline)
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,200 @@
+#! /usr/bin/env python
+
+# Profiles the SPP handshake and record paths with perf.
+#
+# Runs sppbench workloads (test/sppbench, see ssl/sppbench.c) under
+# "perf record -g" and folds the call chains of "perf script" into one line
+# per distinct stack, frames from the root down separated by ';' and then
+# the number of samples:
+#
+#   sppbench;main;SSL_write;spp_write_bytes;do_spp_write;tls1_enc 42
+#
+# which is what flamegraph.pl and difffolded.pl of the FlameGraph tools
+# take. Given the output directory of a run of another version, it also
+# lists the functions whose share of the samples changed the most.
+#
+# Call graphs are only whole with a tree configured for profiling:
+#
+#   ./config -p && make && make -C test sppbench
+#
+# which builds with frame pointers, unwind tables and .cfi annotated
+# perlasm modules (the profile-linux-x86_64 target, "elf-cfi" perlasm
+# scheme). The x86_64 .s files are not checked in and depend on the top
+# Makefile, so they are generated again, with CFI, after every configuration.
+# Static and inlined SPP code (the IMPLEMENT_spp_meth_func methods, n2s and
+# friends) shows up under its own name with --inline, which has perf
+# resolve inlined frames from the debug information; that is slow.
+#
+# "make bench_profile" in test/ runs it.
+
+import sys
+import os
+import re
+import shlex
+import argparse
+import subprocess
+from collections import defaultdict
+
+# name -> sppbench arguments
+WORKLOADS = [
+    ('handshake', '-proxies 2 -slices 4 -conns 200 -bytes 1024'),
+    ('handshake_tls', '-tls -conns 200 -bytes 1024'),
+    ('record', '-proxies 1 -slices 4 -record 16384 -conns 2 -bytes 33554432'),
+    ('record_small', '-proxies 1 -slices 4 -record 1024 -conns 2 -bytes 8388608'),
+    ('record_tls', '-tls -record 16384 -conns 2 -bytes 33554432'),
+]
+
+# a callchain line of perf script: address, symbol+offset, (dso)
+FRAME = re.compile(r'^\s+([0-9a-f]+)\s+(.*?)(?:\s+\(([^()]*)\))?$')
+
+def check_tree(top):
+    s = os.path.join(top, 'crypto', 'sha', 'sha1-x86_64.s')
+    if not os.path.exists(s):
+        return
+    with open(s) as f:
+        if '.cfi_startproc' in f.read():
+            return
+    sys.stderr.write('perf_profile: %s has no CFI, call graphs will stop in '
+        'the assembler; see the top of %s\n' % (s, sys.argv[0]))
+
+def record(args, name, bench_args):
+    data = os.path.join(args.output_dir, name + '.data')
+    cmd = [args.perf, 'record', '-q', '-F', str(args.freq), '-g',\
+        '--call-graph', args.call_graph, '-o', data, '--'] +\
+        shlex.split(args.sppbench) + shlex.split(bench_args)
+    with open(os.path.join(args.output_dir, name + '.json'), 'w') as out:
+        subprocess.check_call(cmd, stdout=out)
+    return data
+
+def frame_name(sym, dso, args):
+    sym = re.sub(r'\+0x[0-9a-f]+$', '', sym)
+    if sym == '[unknown]' and dso:
+        sym = '[%s]' % os.path.basename(dso)
+    if args.dso and dso and dso != 'inlined' and not sym.startswith('['):
+        sym = '%s`%s' % (os.path.basename(dso), sym)
+    return sym.replace(';', ':')
+
+# perf script output -> {stack: samples}
+def fold(lines, args):
+    stacks = defaultdict(int)
+    comm, frames = None, []
+    for l in lines:
+        l = l.rstrip('\n')
+        if not l.strip():
+            if comm is not None:
+                stacks[';'.join([comm] + frames[::-1])] += 1
+            comm, frames = None, []
+        elif not l[0].isspace():
+            comm = l.split()[0]
+        elif comm is not None:
+            m = FRAME.match(l)
+            if m:
+                frames.append(frame_name(m.group(2), m.group(3), args))
+    if comm is not None:
+        stacks[';'.join([comm] + frames[::-1])] += 1
+    return stacks
+
+def script(args, data):
+    cmd = [args.perf, 'script', '-i', data, '-F', 'comm,ip,sym,dso']
+    if args.inline:
+        cmd.append('--inline')
+    p = subprocess.Popen(cmd, stdout=subprocess.PIPE, universal_newlines=True)
+    stacks = fold(p.stdout, args)
+    if p.wait():
+        raise subprocess.CalledProcessError(p.returncode, cmd)
+    return stacks
+
+def write_folded(path, stacks):
+    with open(path, 'w') as f:
+        for stack in sorted(stacks):
+            f.write('%s %d\n' % (stack, stacks[stack]))
+
+def read_folded(path):
+    stacks = {}
+    with open(path) as f:
+        for l in f:
+            stack, n = l.rsplit(' ', 1)
+            stacks[stack] = int(n)
+    return stacks
+
+# {stack: samples} -> total, {function: self samples}, {function: samples
+# with it anywhere on the stack}
+def shares(stacks):
+    total = sum(stacks.values())
+    self_, incl = defaultdict(int), defaultdict(int)
+    for stack, n in stacks.items():
+        frames = stack.split(';')[1:]
+        if frames:
+            self_[frames[-1]] += n
+        for f in set(frames):
+            incl[f] += n
+    return total, self_, incl
+
+def compare(name, old, new, top):
+    ot, oself, oincl = shares(old)
+    nt, nself, nincl = shares(new)
+    if not ot or not nt:
+        return
+    pct = lambda d, f, t: 100.0 * d.get(f, 0) / t
+    funcs = set(oself) | set(nself) | set(oincl) | set(nincl)
+    rows = sorted(funcs, key=lambda f: -max(abs(pct(nself, f, nt) - pct(oself, f, ot)),\
+        abs(pct(nincl, f, nt) - pct(oincl, f, ot))))[:top]
+    print('== %s: %d samples before, %d after' % (name, ot, nt))
+    print('%-40s %8s %8s %8s %8s %8s %8s' % ('function', 'self', 'self', 'change',\
+        'total', 'total', 'change'))
+    for f in rows:
+        print('%-40s %7.2f%% %7.2f%% %+7.2f%% %7.2f%% %7.2f%% %+7.2f%%' % (f[:40],\
+            pct(oself, f, ot), pct(nself, f, nt), pct(nself, f, nt) - pct(oself, f, ot),\
+            pct(oincl, f, ot), pct(nincl, f, nt), pct(nincl, f, nt) - pct(oincl, f, ot)))
+
+def main():
+    parser = argparse.ArgumentParser(formatter_class=argparse.ArgumentDefaultsHelpFormatter,\
+        description='Profile the SPP benchmark workloads with perf and write folded stacks.')
+    parser.add_argument('--sppbench', default='./sppbench', help='sppbench command')
+    parser.add_argument('--perf', default='perf', help='perf command')
+    parser.add_argument('--output-dir', default='perf_profile', help='where the perf data, folded stacks and sppbench output go')
+    parser.add_argument('--workload', action='append', help='run only these workloads (%s)' %\
+        ', '.join(w[0] for w in WORKLOADS))
+    parser.add_argument('--freq', type=int, default=999, help='samples per second')
+    parser.add_argument('--call-graph', default='dwarf', help='perf record --call-graph mode: dwarf, fp or lbr')
+    parser.add_argument('--inline', action='store_true', help='resolve inlined functions')
+    parser.add_argument('--dso', action='store_true', help='prefix frames with their library')
+    parser.add_argument('--fold-only', action='store_true', help='fold the perf data of an earlier run again')
+    parser.add_argument('--compare', metavar='DIR', help='output directory of a run of another version to compare to')
+    parser.add_argument('--top', type=int, default=25, help='functions listed per workload by --compare')
+    parser.add_argument('--tree', default='..', help='source tree, checked for a profiling build')
+    args = parser.parse_args()
+
+    workloads = [w for w in WORKLOADS if not args.workload or w[0] in args.workload]
+    if not workloads:
+        parser.error('no such workload')
+    if not os.path.isdir(args.output_dir):
+        os.makedirs(args.output_dir)
+    if not args.fold_only:
+        check_tree(args.tree)
+
+    try:
+        for name, bench_args in workloads:
+            data = os.path.join(args.output_dir, name + '.data')
+            if not args.fold_only:
+                sys.stderr.write('recording %s\n' % name)
+                data = record(args, name, bench_args)
+            folded = os.path.join(args.output_dir, name + '.folded')
+            write_folded(folded, script(args, data))
+            print('[OUT] %s' % folded)
+    except (OSError, subprocess.CalledProcessError) as e:
+        sys.stderr.write('perf_profile: %s\n' % e)
+        return 2
+
+    if args.compare:
+        for name, bench_args in workloads:
+            old = os.path.join(args.compare, name + '.folded')
+            if not os.path.exists(old):
+                print('no %s, not comparing %s' % (old, name))
+                continue
+            compare(name, read_folded(old),\
+                read_folded(os.path.join(args.output_dir, name + '.folded')), args.top)
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,126 @@
+/*
+ * Per-record crypto cost of an SPP record as a function of where its
+ * payload sits relative to a cache line: AES-128-CBC encryption and the
+ * three HMAC-SHA256 MACs of one record, with the payload at a 64 byte
+ * boundary (what ssl3_setup_*_buffer/spp_payload_align now produce) and at
+ * the offsets the old 5 byte header alignment left behind.
+ *
+ * usage: spp_align [record size] [iterations]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+
+#define HEADER	6
+#define IVLEN	16
+#define MACLEN	32
+
+static unsigned long long ticks(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    unsigned int lo, hi;
+    __asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+    return ((unsigned long long)hi << 32) | lo;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+#endif
+}
+
+static int cmp(const void *a, const void *b)
+{
+    unsigned long long x = *(const unsigned long long *)a;
+    unsigned long long y = *(const unsigned long long *)b;
+    return x < y ? -1 : x > y;
+}
+
+/* Seal one record whose payload starts at p: three MACs over the
+ * plaintext, then encrypt payload and MACs in place. */
+static void seal(EVP_CIPHER_CTX *c, HMAC_CTX *mac, unsigned char *p, int len)
+{
+    static const unsigned char hdr[13] = { 0 };
+    unsigned int n;
+    int i, out;
+
+    for (i = 0; i < 3; i++) {
+        HMAC_Init_ex(&mac[i], NULL, 0, NULL, NULL);
+        HMAC_Update(&mac[i], hdr, sizeof(hdr));
+        HMAC_Update(&mac[i], p, len);
+        HMAC_Final(&mac[i], p + len + i * MACLEN, &n);
+    }
+    EVP_EncryptInit_ex(c, NULL, NULL, NULL, p - IVLEN);
+    EVP_EncryptUpdate(c, p - IVLEN, &out, p - IVLEN, IVLEN + len + 3 * MACLEN);
+}
+
+static unsigned long long run(unsigned char *buf, long off, int len, int iters)
+{
+    unsigned long long *t, r;
+    unsigned char key[16], mk[3][32];
+    EVP_CIPHER_CTX c;
+    HMAC_CTX mac[3];
+    unsigned char *p = buf + off + HEADER + IVLEN;
+    int i;
+
+    memset(key, 0x11, sizeof(key));
+    memset(mk, 0x22, sizeof(mk));
+    EVP_CIPHER_CTX_init(&c);
+    EVP_EncryptInit_ex(&c, EVP_aes_128_cbc(), NULL, key, key);
+    EVP_CIPHER_CTX_set_padding(&c, 0);
+    for (i = 0; i < 3; i++) {
+        HMAC_CTX_init(&mac[i]);
+        HMAC_Init_ex(&mac[i], mk[i], 32, EVP_sha256(), NULL);
+    }
+    memset(buf + off, 'x', HEADER + IVLEN + len);
+    t = malloc(sizeof(*t) * iters);
+    for (i = 0; i < iters / 10; i++)
+        seal(&c, mac, p, len);
+    for (i = 0; i < iters; i++) {
+        unsigned long long t0 = ticks();
+        seal(&c, mac, p, len);
+        t[i] = ticks() - t0;
+    }
+    qsort(t, iters, sizeof(*t), cmp);
+    r = t[iters / 2];
+    free(t);
+    for (i = 0; i < 3; i++)
+        HMAC_CTX_cleanup(&mac[i]);
+    EVP_CIPHER_CTX_cleanup(&c);
+    return r;
+}
+
+int main(int argc, char **argv)
+{
+    static const int offs[] = { 0, 1, 5, 10, 32 };
+    int len = argc > 1 ? atoi(argv[1]) : 16384;
+    int iters = argc > 2 ? atoi(argv[2]) : 20000;
+    unsigned char *raw, *base;
+    unsigned long long aligned = 0, t;
+    unsigned int i;
+
+    /* whole record, padded to the block size with room for three MACs */
+    len &= ~15;
+    if (len <= 0 || iters <= 0) {
+        fprintf(stderr, "usage: %s [record size] [iterations]\n", argv[0]);
+        return 1;
+    }
+    raw = malloc(len + 3 * MACLEN + HEADER + IVLEN + 256);
+    /* base + HEADER + IVLEN is 64 byte aligned */
+    base = raw + ((-(long)(raw + HEADER + IVLEN)) & 63);
+
+    printf("# record %d bytes, AES-128-CBC + 3 x HMAC-SHA256, median of %d\n",
+           len, iters);
+    printf("# payload_misalign\tcycles_per_record\tcycles_per_byte\trelative\n");
+    for (i = 0; i < sizeof(offs) / sizeof(offs[0]); i++) {
+        t = run(base, offs[i], len, iters);
+        if (offs[i] == 0)
+            aligned = t;
+        printf("%d\t%llu\t%.3f\t%.3f\n", offs[i], t, (double)t / len,
+               (double)t / aligned);
+    }
+    free(raw);
+    return 0;
+}
@@ -0,0 +1,920 @@
+/*
+ * Page load replay over in-process connections.
+ *
+ * Replays the object fetches of a page load recorded in a .tab trace
+ * (../realworld_web/example has one, ../realworld_web/har_to_tab.py makes
+ * more from HAR captures) through a chain of simulated middleboxes, all in
+ * one process, so runs are reproducible without the testbed, tc or remote
+ * machines.
+ *
+ * Objects are grouped into connections the way the trace says the browser
+ * did: an object that needed a new TCP or SSL handshake, or comes from a
+ * host not seen before, opens a new connection; the others reuse the
+ * connections to their host in turn. Every connection is a client thread,
+ * one or two threads per middlebox and a server thread, talking over
+ * socket pairs. Each connection fetches its objects one after the other,
+ * HTTP/1.1 style: a request goes out at the time the trace has for it or
+ * once the previous response is complete, whichever is later. The server
+ * answers with a RESPONSE_HEADER byte header and as many body bytes as the
+ * trace has for the object.
+ *
+ * Both ends of every hop are wrapped in a delay BIO filter: the sender
+ * stamps each write with the time it arrives at the other end (the hop's
+ * one way -latency, plus the time it spends queued behind earlier writes
+ * at -bandwidth) and the receiver holds the data back until then. There is
+ * no loss and no congestion control.
+ *
+ * Modes, as in ../client_server (wclient, middlebox, wserver):
+ *   spp   mcTLS end to end, the middleboxes are SPP proxies
+ *   ssl   split TLS, every middlebox terminates TLS and opens a new one
+ *   fwd   TLS end to end, the middleboxes forward TCP
+ *   pln   plain TCP, the middleboxes forward TCP
+ *
+ * For every mode and repetition, one line of JSON per object (time to
+ * first byte from the time its request went out, and completion time from
+ * the start of the page load) and one for the page (page load time,
+ * i.e. completion of the last object) go to stdout.
+ *
+ * usage: spp_replay [-mode spp,ssl,fwd,pln] [-proxies n] [-latency ms]
+ *                   [-bandwidth kbit/s] [-slices n] [-reps n] [-q]
+ *                   [-cipher list] [-cert file] [-dhparam file] trace.tab
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <openssl/ssl.h>
+#include <openssl/err.h>
+#include <openssl/pem.h>
+#include <openssl/crypto.h>
+
+#define MAX_PROXIES         8
+#define MAX_OBJECTS         4096
+#define MAX_MODES           4
+#define REQUEST_HEADERS     300     /* typical browser headers besides Host */
+#define RESPONSE_HEADER     250
+#define IO_SIZE             16384
+
+#define MODE_SPP            0
+#define MODE_SSL            1
+#define MODE_FWD            2
+#define MODE_PLN            3
+
+static const char *mode_names[] = { "spp", "ssl", "fwd", "pln" };
+
+typedef struct object_st {
+    char *host;
+    char *path;
+    long size;
+    double offset;              /* seconds from the start of the page */
+    int new_conn;
+    int conn;
+    /* results */
+    double ttfb;
+    double done;
+    int ok;
+} OBJECT;
+
+typedef struct conn_st {
+    int id;
+    int *objects;
+    int nobjects;
+    int fds[MAX_PROXIES+1][2];  /* hop i: [0] towards the client, [1] towards the server */
+    double handshake;
+    pthread_t client;
+} CONN;
+
+/* One middlebox of one connection */
+typedef struct proxy_st {
+    CONN *conn;
+    int idx;
+    SSL *prev, *next;
+    BIO *prev_bio, *next_bio;
+} PROXY;
+
+static int mode, nproxies = 1, nslices = 1, quiet;
+static double latency = 0.010;          /* seconds, one way, per hop */
+static double bandwidth = 0;            /* bytes per second, 0: unlimited */
+static const char *cipher = "DHE-RSA-AES128-SHA256";
+static OBJECT objects[MAX_OBJECTS];
+static int nobjects;
+static CONN *conns;
+static int nconns;
+static double page_start;
+static char proxy_address[MAX_PROXIES][16];
+static char server_address[] = "server";
+static SSL_CTX *spp_client_ctx, *spp_server_ctx, *spp_proxy_ctx;
+static SSL_CTX *tls_client_ctx, *tls_server_ctx;
+static pthread_mutex_t *locks;
+
+static double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void sleep_until(double t)
+{
+    struct timespec ts;
+    double d;
+
+    while ((d = t - now()) > 0) {
+        ts.tv_sec = (time_t)d;
+        ts.tv_nsec = (long)((d - ts.tv_sec) * 1e9);
+        nanosleep(&ts, NULL);
+    }
+}
+
+/* Delay filter. Every write goes out as a frame: 8 bytes of arrival time
+ * (microseconds on the CLOCK_MONOTONIC clock all threads share), 4 bytes
+ * of length and the data. */
+
+#define FRAME_HEADER        12
+
+typedef struct delay_st {
+    double busy;                /* sender: the hop is busy until then */
+    double release;             /* receiver: current frame arrives then */
+    int left;                   /* receiver: bytes left in current frame */
+} DELAY;
+
+static int delay_write(BIO *b, const char *in, int inl);
+static int delay_read(BIO *b, char *out, int outl);
+static int delay_puts(BIO *b, const char *str);
+static long delay_ctrl(BIO *b, int cmd, long num, void *ptr);
+static int delay_new(BIO *b);
+static int delay_free(BIO *b);
+
+static BIO_METHOD methods_delay = {
+    BIO_TYPE_FILTER,
+    "replay link delay",
+    delay_write,
+    delay_read,
+    delay_puts,
+    NULL,                       /* gets */
+    delay_ctrl,
+    delay_new,
+    delay_free,
+    NULL,
+};
+
+static int delay_new(BIO *b)
+{
+    DELAY *d;
+
+    if ((d = OPENSSL_malloc(sizeof(*d))) == NULL)
+        return 0;
+    memset(d, 0, sizeof(*d));
+    b->ptr = d;
+    b->init = 1;
+    b->flags = 0;
+    return 1;
+}
+
+static int delay_free(BIO *b)
+{
+    if (b == NULL)
+        return 0;
+    if (b->ptr != NULL)
+        OPENSSL_free(b->ptr);
+    b->ptr = NULL;
+    return 1;
+}
+
+static int write_all(BIO *b, const unsigned char *p, int len)
+{
+    int n;
+
+    while (len > 0) {
+        if ((n = BIO_write(b, p, len)) <= 0)
+            return 0;
+        p += n;
+        len -= n;
+    }
+    return 1;
+}
+
+static int delay_write(BIO *b, const char *in, int inl)
+{
+    DELAY *d = b->ptr;
+    unsigned char hdr[FRAME_HEADER];
+    unsigned long long arrival;
+    double t;
+    int i;
+
+    BIO_clear_retry_flags(b);
+    if (inl <= 0 || b->next_bio == NULL)
+        return 0;
+    t = now();
+    if (d->busy > t)
+        t = d->busy;
+    if (bandwidth > 0)
+        t += inl / bandwidth;
+    d->busy = t;
+    arrival = (unsigned long long)((t + latency) * 1e6);
+    for (i = 0; i < 8; i++)
+        hdr[i] = (unsigned char)(arrival >> (56 - 8 * i));
+    for (i = 0; i < 4; i++)
+        hdr[8 + i] = (unsigned char)((unsigned int)inl >> (24 - 8 * i));
+    if (!write_all(b->next_bio, hdr, FRAME_HEADER) ||
+        !write_all(b->next_bio, (const unsigned char *)in, inl))
+        return -1;
+    return inl;
+}
+
+static int delay_read(BIO *b, char *out, int outl)
+{
+    DELAY *d = b->ptr;
+    unsigned char hdr[FRAME_HEADER];
+    unsigned long long arrival = 0;
+    int i, n, got;
+
+    BIO_clear_retry_flags(b);
+    if (outl <= 0 || b->next_bio == NULL)
+        return 0;
+    if (d->left == 0) {
+        for (got = 0; got < FRAME_HEADER; got += n)
+            if ((n = BIO_read(b->next_bio, hdr + got, FRAME_HEADER - got)) <= 0)
+                return got == 0 ? n : -1;
+        for (i = 0; i < 8; i++)
+            arrival = (arrival << 8) | hdr[i];
+        for (i = 8; i < FRAME_HEADER; i++)
+            d->left = (d->left << 8) | hdr[i];
+        d->release = arrival / 1e6;
+    }
+    sleep_until(d->release);
+    if ((n = BIO_read(b->next_bio, out, outl < d->left ? outl : d->left)) > 0)
+        d->left -= n;
+    return n;
+}
+
+static int delay_puts(BIO *b, const char *str)
+{
+    return delay_write(b, str, strlen(str));
+}
+
+static long delay_ctrl(BIO *b, int cmd, long num, void *ptr)
+{
+    if (b->next_bio == NULL)
+        return 0;
+    switch (cmd) {
+    case BIO_CTRL_PENDING:
+    case BIO_CTRL_WPENDING:
+        return 0;
+    }
+    return BIO_ctrl(b->next_bio, cmd, num, ptr);
+}
+
+/* One end of a hop of conn, with its delay filter */
+static BIO *hop_bio(CONN *conn, int hop, int side)
+{
+    BIO *f, *s;
+
+    if ((f = BIO_new(&methods_delay)) == NULL)
+        return NULL;
+    if ((s = BIO_new_socket(conn->fds[hop][side], BIO_NOCLOSE)) == NULL) {
+        BIO_free(f);
+        return NULL;
+    }
+    return BIO_push(f, s);
+}
+
+static SSL *hop_ssl(SSL_CTX *ctx, CONN *conn, int hop, int side)
+{
+    SSL *s;
+    BIO *b;
+
+    if ((s = SSL_new(ctx)) == NULL)
+        return NULL;
+    if ((b = hop_bio(conn, hop, side)) == NULL) {
+        SSL_free(s);
+        return NULL;
+    }
+    SSL_set_bio(s, b, b);
+    return s;
+}
+
+/* No more data from this end of the hop, also how a failure is passed
+ * along the chain. */
+static void hop_shutdown(CONN *conn, int hop, int side)
+{
+    shutdown(conn->fds[hop][side], SHUT_WR);
+}
+
+/* Application data over whichever of SSL, SPP or plain TCP the mode uses */
+
+static int app_read(SSL *s, BIO *b, char *buf, int len)
+{
+    SPP_SLICE *slice;
+    SPP_CTX *ctx;
+
+    if (mode == MODE_PLN)
+        return BIO_read(b, buf, len);
+    if (mode == MODE_SPP)
+        return SPP_read_record(s, buf, len, &slice, &ctx);
+    return SSL_read(s, buf, len);
+}
+
+static int app_write(SSL *s, BIO *b, const char *buf, int len, int slice)
+{
+    int n, done = 0;
+
+    while (done < len) {
+        n = len - done > IO_SIZE ? IO_SIZE : len - done;
+        if (mode == MODE_PLN)
+            n = write_all(b, (const unsigned char *)buf + done, n) ? n : -1;
+        else if (mode == MODE_SPP)
+            n = SPP_write_record(s, buf + done, n,
+                                 s->slices[slice < s->slices_len ? slice : s->slices_len - 1]);
+        else
+            n = SSL_write(s, buf + done, n);
+        if (n <= 0)
+            return 0;
+        done += n;
+    }
+    return 1;
+}
+
+/* Middleboxes */
+
+static SSL *next_hop(SSL *s, char *address)
+{
+    PROXY *px = SSL_get_app_data(s);
+    int i;
+
+    for (i = 0; i < nproxies; i++)
+        if (strcmp(address, proxy_address[i]) == 0)
+            break;
+    px->next = hop_ssl(spp_proxy_ctx, px->conn, i, 0);
+    return px->next;
+}
+
+/* Forward from src to dst until src closes, then close dst. */
+static void forward(PROXY *px, int upstream)
+{
+    SSL *src = upstream ? px->prev : px->next;
+    SSL *dst = upstream ? px->next : px->prev;
+    BIO *src_bio = upstream ? px->prev_bio : px->next_bio;
+    BIO *dst_bio = upstream ? px->next_bio : px->prev_bio;
+    SPP_SLICE *slice;
+    SPP_CTX *ctx;
+    char *buf;
+    int r;
+
+    if ((buf = OPENSSL_malloc(SPP_RT_MAX_PACKET_SIZE)) == NULL)
+        goto end;
+    for (;;) {
+        if (mode == MODE_SPP) {
+            if ((r = SPP_read_record(src, buf, SPP_RT_MAX_PACKET_SIZE,
+                                     &slice, &ctx)) <= 0 ||
+                SPP_forward_record(dst, buf, r, slice, ctx, 0) != r)
+                break;
+        } else if (mode == MODE_SSL) {
+            if ((r = SSL_read(src, buf, SSL3_RT_MAX_PLAIN_LENGTH)) <= 0 ||
+                SSL_write(dst, buf, r) != r)
+                break;
+        } else {
+            if ((r = BIO_read(src_bio, buf, IO_SIZE)) <= 0 ||
+                !write_all(dst_bio, (unsigned char *)buf, r))
+                break;
+        }
+    }
+    OPENSSL_free(buf);
+ end:
+    if (upstream)
+        hop_shutdown(px->conn, px->idx + 1, 0);
+    else
+        hop_shutdown(px->conn, px->idx, 1);
+}
+
+static void *proxy_downstream(void *arg)
+{
+    forward(arg, 0);
+    return NULL;
+}
+
+static void *proxy_main(void *arg)
+{
+    PROXY *px = arg;
+    CONN *conn = px->conn;
+    pthread_t down;
+    int ok = 0;
+
+    if (mode == MODE_SPP) {
+        if ((px->prev = hop_ssl(spp_proxy_ctx, conn, px->idx, 1)) != NULL) {
+            SSL_set_app_data(px->prev, px);
+            ok = SPP_proxy(px->prev, proxy_address[px->idx], next_hop,
+                           &px->next) > 0 && px->next != NULL;
+        }
+    } else if (mode == MODE_SSL) {
+        ok = (px->prev = hop_ssl(tls_server_ctx, conn, px->idx, 1)) != NULL &&
+            SSL_accept(px->prev) > 0 &&
+            (px->next = hop_ssl(tls_client_ctx, conn, px->idx + 1, 0)) != NULL &&
+            SSL_connect(px->next) > 0;
+    } else {
+        ok = (px->prev_bio = hop_bio(conn, px->idx, 1)) != NULL &&
+            (px->next_bio = hop_bio(conn, px->idx + 1, 0)) != NULL;
+    }
+    if (!ok) {
+        ERR_print_errors_fp(stderr);
+        hop_shutdown(conn, px->idx, 1);
+        hop_shutdown(conn, px->idx + 1, 0);
+        return NULL;
+    }
+    pthread_create(&down, NULL, proxy_downstream, px);
+    forward(px, 1);
+    pthread_join(down, NULL);
+    return NULL;
+}
+
+static void proxy_free(PROXY *px)
+{
+    if (px->next != NULL) {
+        /* An SPP proxy's two connections share one session. */
+        if (px->prev != NULL && px->next->session == px->prev->session)
+            px->next->session = NULL;
+        SSL_free(px->next);
+    }
+    if (px->prev != NULL)
+        SSL_free(px->prev);
+    if (px->prev_bio != NULL)
+        BIO_free_all(px->prev_bio);
+    if (px->next_bio != NULL)
+        BIO_free_all(px->next_bio);
+}
+
+/* Server: answer requests until the client closes */
+
+static void *server_main(void *arg)
+{
+    CONN *conn = arg;
+    SSL *s = NULL;
+    BIO *b = NULL;
+    char req[IO_SIZE + 1], *body = NULL, *p;
+    long size;
+    int r, len = 0, ok;
+
+    if (mode == MODE_PLN)
+        ok = (b = hop_bio(conn, nproxies, 1)) != NULL;
+    else
+        ok = (s = hop_ssl(mode == MODE_SPP ? spp_server_ctx : tls_server_ctx,
+                          conn, nproxies, 1)) != NULL &&
+            SSL_accept(s) > 0;
+    if (!ok) {
+        ERR_print_errors_fp(stderr);
+        goto end;
+    }
+    while ((r = app_read(s, b, req + len, IO_SIZE - len)) > 0) {
+        len += r;
+        req[len] = '\0';
+        if ((p = strstr(req, "\r\n\r\n")) == NULL) {
+            if (len == IO_SIZE)
+                break;
+            continue;
+        }
+        size = (p = strstr(req, "X-Replay-Size: ")) != NULL ? atol(p + 15) : 0;
+        if ((body = OPENSSL_realloc(body, RESPONSE_HEADER + size)) == NULL)
+            break;
+        memset(body, 'x', RESPONSE_HEADER + size);
+        memcpy(body, "HTTP/1.1 200 OK\r\n", 17);
+        memcpy(body + RESPONSE_HEADER - 4, "\r\n\r\n", 4);
+        /* header and body on slices of their own if there are enough */
+        if (!app_write(s, b, body, RESPONSE_HEADER, 0) ||
+            !app_write(s, b, body + RESPONSE_HEADER, size, nslices - 1))
+            break;
+        len = 0;
+    }
+ end:
+    hop_shutdown(conn, nproxies, 1);
+    if (body != NULL)
+        OPENSSL_free(body);
+    if (s != NULL)
+        SSL_free(s);
+    if (b != NULL)
+        BIO_free_all(b);
+    return NULL;
+}
+
+/* Client: one per connection, fetches the connection's objects in turn */
+
+static int client_handshake(SSL *c)
+{
+    SPP_SLICE *slices[MAX_SPP_SLICES];
+    SPP_PROXY *proxies[MAX_PROXIES+1];
+    int i;
+
+    if (mode != MODE_SPP)
+        return SSL_connect(c);
+    for (i = 0; i < nproxies; i++)
+        proxies[i] = SPP_generate_proxy(c, proxy_address[i]);
+    proxies[nproxies] = SPP_generate_proxy(c, server_address);
+    for (i = 0; i < nslices; i++)
+        slices[i] = SPP_generate_slice(c, "replay");
+    for (i = 0; i < nproxies; i++)
+        SPP_assign_proxy_read_slices(c, proxies[i], slices, nslices);
+    return SPP_connect(c, slices, nslices, proxies, nproxies + 1);
+}
+
+static int fetch(SSL *c, BIO *b, OBJECT *obj, char *buf)
+{
+    char req[IO_SIZE];
+    long want, got = 0;
+    double sent;
+    int n, r;
+
+    n = BIO_snprintf(req, sizeof(req) - REQUEST_HEADERS - 4,
+                     "GET %s HTTP/1.1\r\nHost: %s\r\nX-Replay-Size: %ld\r\n",
+                     obj->path, obj->host, obj->size);
+    if (n < 0)
+        n = strlen(req);
+    memset(req + n, 'x', REQUEST_HEADERS);
+    memcpy(req + n + REQUEST_HEADERS, "\r\n\r\n", 4);
+    sent = now();
+    if (!app_write(c, b, req, n + REQUEST_HEADERS + 4, 0))
+        return 0;
+    want = RESPONSE_HEADER + obj->size;
+    while (got < want) {
+        if ((r = app_read(c, b, buf, IO_SIZE)) <= 0)
+            return 0;
+        if (got == 0)
+            obj->ttfb = now() - sent;
+        got += r;
+    }
+    obj->done = now() - page_start;
+    return 1;
+}
+
+static void *client_main(void *arg)
+{
+    CONN *conn = arg;
+    pthread_t server, proxy_threads[MAX_PROXIES];
+    PROXY proxies[MAX_PROXIES];
+    SSL *c = NULL;
+    BIO *b = NULL;
+    char *buf;
+    double t;
+    int i, ok;
+
+    buf = OPENSSL_malloc(SPP_RT_MAX_PACKET_SIZE);
+    sleep_until(page_start + objects[conn->objects[0]].offset);
+    for (i = 0; i <= nproxies; i++)
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, conn->fds[i]) != 0)
+            conn->fds[i][0] = conn->fds[i][1] = -1;
+    memset(proxies, 0, sizeof(proxies));
+    for (i = 0; i < nproxies; i++) {
+        proxies[i].conn = conn;
+        proxies[i].idx = i;
+        pthread_create(&proxy_threads[i], NULL, proxy_main, &proxies[i]);
+    }
+    pthread_create(&server, NULL, server_main, conn);
+
+    t = now();
+    if (mode == MODE_PLN)
+        ok = (b = hop_bio(conn, 0, 0)) != NULL;
+    else
+        ok = (c = hop_ssl(mode == MODE_SPP ? spp_client_ctx : tls_client_ctx,
+                          conn, 0, 0)) != NULL &&
+            client_handshake(c) > 0;
+    conn->handshake = now() - t;
+    if (!ok)
+        ERR_print_errors_fp(stderr);
+    for (i = 0; ok && buf != NULL && i < conn->nobjects; i++) {
+        OBJECT *obj = &objects[conn->objects[i]];
+
+        sleep_until(page_start + obj->offset);
+        if (!(obj->ok = fetch(c, b, obj, buf)))
+            ERR_print_errors_fp(stderr);
+        ok = obj->ok;
+    }
+    hop_shutdown(conn, 0, 0);
+
+    pthread_join(server, NULL);
+    for (i = 0; i < nproxies; i++) {
+        pthread_join(proxy_threads[i], NULL);
+        proxy_free(&proxies[i]);
+    }
+    if (c != NULL)
+        SSL_free(c);
+    if (b != NULL)
+        BIO_free_all(b);
+    for (i = 0; i <= nproxies; i++) {
+        close(conn->fds[i][0]);
+        close(conn->fds[i][1]);
+    }
+    if (buf != NULL)
+        OPENSSL_free(buf);
+    return NULL;
+}
+
+/* Trace */
+
+static char *field(char **line)
+{
+    char *f = *line, *t;
+
+    if (f == NULL)
+        return "";
+    if ((t = strchr(f, '\t')) != NULL) {
+        *t = '\0';
+        *line = t + 1;
+    } else
+        *line = NULL;
+    /* the header has blanks after some tabs */
+    while (*f == ' ')
+        f++;
+    return f;
+}
+
+/* host, path, compressed size, original size, start offset, new TCP
+ * connection?, new SSL handshake?, URL; a header line and a blank one */
+static int load_trace(const char *file)
+{
+    char line[8192], *p, *host, *path, *size, *offset, *tcp, *ssl;
+    FILE *fp;
+    int i, first = 1;
+
+    if ((fp = fopen(file, "r")) == NULL) {
+        perror(file);
+        return 0;
+    }
+    while (fgets(line, sizeof(line), fp) != NULL && nobjects < MAX_OBJECTS) {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (first || line[0] == '\0') {
+            first = 0;
+            continue;
+        }
+        p = line;
+        host = field(&p);
+        path = field(&p);
+        size = field(&p);
+        field(&p);
+        offset = field(&p);
+        tcp = field(&p);
+        ssl = field(&p);
+        objects[nobjects].host = BUF_strdup(host);
+        objects[nobjects].path = BUF_strdup(path);
+        objects[nobjects].size = atol(size);
+        objects[nobjects].offset = atof(offset);
+        objects[nobjects].new_conn = strcmp(tcp, "True") == 0 ||
+            strcmp(ssl, "True") == 0;
+        nobjects++;
+    }
+    fclose(fp);
+    if (nobjects == 0) {
+        fprintf(stderr, "%s: no objects\n", file);
+        return 0;
+    }
+
+    /* Connections, and the objects of each in trace order */
+    conns = OPENSSL_malloc(nobjects * sizeof(*conns));
+    memset(conns, 0, nobjects * sizeof(*conns));
+    for (i = 0; i < nobjects; i++) {
+        OBJECT *obj = &objects[i];
+        int j, next = -1, candidates = 0;
+        static int turn;
+
+        for (j = 0; j < i; j++)
+            if (strcmp(objects[j].host, obj->host) == 0)
+                break;
+        if (!obj->new_conn && j < i) {
+            /* reuse the connections to this host in turn */
+            for (j = 0; j < nconns; j++)
+                if (strcmp(objects[conns[j].objects[0]].host, obj->host) == 0)
+                    candidates++;
+            next = turn++ % candidates;
+            for (j = 0; j < nconns; j++)
+                if (strcmp(objects[conns[j].objects[0]].host, obj->host) == 0 &&
+                    next-- == 0)
+                    break;
+            obj->conn = j;
+        } else {
+            obj->conn = nconns;
+            conns[nconns].id = nconns;
+            conns[nconns].objects = OPENSSL_malloc(nobjects * sizeof(int));
+            nconns++;
+        }
+        conns[obj->conn].objects[conns[obj->conn].nobjects++] = i;
+    }
+    return 1;
+}
+
+/* Reporting */
+
+static int cmp_double(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+
+    return x < y ? -1 : x > y;
+}
+
+static void report(const char *trace, int rep)
+{
+    double *ttfb, plt = 0, handshake = 0;
+    int i, n = 0, failed = 0;
+
+    ttfb = OPENSSL_malloc(nobjects * sizeof(double));
+    for (i = 0; i < nobjects; i++) {
+        OBJECT *obj = &objects[i];
+
+        if (!quiet)
+            printf("{\"mode\":\"%s\",\"trace\":\"%s\",\"rep\":%d,"
+                   "\"object\":%d,\"host\":\"%s\",\"conn\":%d,"
+                   "\"new_conn\":%d,\"bytes\":%ld,\"offset_ms\":%.3f,"
+                   "\"ttfb_ms\":%.3f,\"done_ms\":%.3f,\"ok\":%d}\n",
+                   mode_names[mode], trace, rep, i, obj->host, obj->conn,
+                   obj->new_conn, obj->size, obj->offset * 1000,
+                   obj->ttfb * 1000, obj->done * 1000, obj->ok);
+        if (!obj->ok) {
+            failed++;
+            continue;
+        }
+        ttfb[n++] = obj->ttfb;
+        if (obj->done > plt)
+            plt = obj->done;
+    }
+    for (i = 0; i < nconns; i++)
+        handshake += conns[i].handshake;
+    qsort(ttfb, n, sizeof(double), cmp_double);
+    printf("{\"mode\":\"%s\",\"trace\":\"%s\",\"rep\":%d,\"proxies\":%d,"
+           "\"slices\":%d,\"latency_ms\":%.3f,\"bandwidth_kbps\":%.0f,"
+           "\"objects\":%d,\"connections\":%d,\"failed\":%d,"
+           "\"plt_ms\":%.3f,\"ttfb_median_ms\":%.3f,\"ttfb_p90_ms\":%.3f,"
+           "\"handshake_ms\":%.3f}\n",
+           mode_names[mode], trace, rep, nproxies,
+           mode == MODE_SPP ? nslices : 0, latency * 1000,
+           bandwidth * 8 / 1000, nobjects, nconns, failed, plt * 1000,
+           n > 0 ? ttfb[n / 2] * 1000 : 0,
+           n > 0 ? ttfb[(n * 9) / 10 < n ? (n * 9) / 10 : n - 1] * 1000 : 0,
+           nconns > 0 ? handshake * 1000 / nconns : 0);
+    fflush(stdout);
+    OPENSSL_free(ttfb);
+}
+
+static int replay(void)
+{
+    int i;
+
+    for (i = 0; i < nobjects; i++) {
+        objects[i].ok = 0;
+        objects[i].ttfb = objects[i].done = 0;
+    }
+    page_start = now();
+    for (i = 0; i < nconns; i++)
+        pthread_create(&conns[i].client, NULL, client_main, &conns[i]);
+    for (i = 0; i < nconns; i++)
+        pthread_join(conns[i].client, NULL);
+    for (i = 0; i < nobjects; i++)
+        if (!objects[i].ok)
+            return 0;
+    return 1;
+}
+
+/* Setup */
+
+static void locking_cb(int mode, int type, const char *file, int line)
+{
+    if (mode & CRYPTO_LOCK)
+        pthread_mutex_lock(&locks[type]);
+    else
+        pthread_mutex_unlock(&locks[type]);
+}
+
+static SSL_CTX *make_ctx(const SSL_METHOD *meth, const char *cert,
+                         const char *dhparam)
+{
+    SSL_CTX *ctx;
+    BIO *in;
+    DH *dh;
+
+    if ((ctx = SSL_CTX_new(meth)) == NULL)
+        return NULL;
+    if (!SSL_CTX_set_cipher_list(ctx, cipher) ||
+        (cert != NULL &&
+         (!SSL_CTX_use_certificate_chain_file(ctx, cert) ||
+          !SSL_CTX_use_PrivateKey_file(ctx, cert, SSL_FILETYPE_PEM)))) {
+        SSL_CTX_free(ctx);
+        return NULL;
+    }
+    if (dhparam != NULL && (in = BIO_new_file(dhparam, "r")) != NULL) {
+        if ((dh = PEM_read_bio_DHparams(in, NULL, NULL, NULL)) != NULL) {
+            SSL_CTX_set_tmp_dh(ctx, dh);
+            DH_free(dh);
+        }
+        BIO_free(in);
+    }
+    return ctx;
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: spp_replay [options] trace.tab\n");
+    fprintf(stderr, " -mode m,..       - spp, ssl, fwd and/or pln (default spp)\n");
+    fprintf(stderr, " -proxies n       - middleboxes, 0-%d (default 1)\n", MAX_PROXIES);
+    fprintf(stderr, " -latency ms      - one way delay of every hop (default 10)\n");
+    fprintf(stderr, " -bandwidth kbit  - bandwidth of every hop in kbit/s (default unlimited)\n");
+    fprintf(stderr, " -slices n        - SPP slices, the middleboxes read all (default 1)\n");
+    fprintf(stderr, " -reps n          - page loads per mode (default 1)\n");
+    fprintf(stderr, " -q               - page summaries only\n");
+    fprintf(stderr, " -cipher list     - cipher list (default %s)\n", cipher);
+    fprintf(stderr, " -cert file       - certificate and key of every node\n");
+    fprintf(stderr, " -dhparam file    - DH parameters\n");
+}
+
+int main(int argc, char **argv)
+{
+    const char *cert = "../client_server/server.pem";
+    const char *dhparam = "../client_server/dh1024.pem";
+    const char *trace = NULL;
+    char *modes = "spp", *m;
+    int modelist[MAX_MODES], nmodes = 0;
+    int i, r, reps = 1, failed = 0;
+
+    for (argc--, argv++; argc > 0; argc--, argv++) {
+        if (strcmp(*argv, "-mode") == 0 && argc > 1)
+            modes = *++argv, argc--;
+        else if (strcmp(*argv, "-proxies") == 0 && argc > 1)
+            nproxies = atoi(*++argv), argc--;
+        else if (strcmp(*argv, "-latency") == 0 && argc > 1)
+            latency = atof(*++argv) / 1000, argc--;
+        else if (strcmp(*argv, "-bandwidth") == 0 && argc > 1)
+            bandwidth = atof(*++argv) * 1000 / 8, argc--;
+        else if (strcmp(*argv, "-slices") == 0 && argc > 1)
+            nslices = atoi(*++argv), argc--;
+        else if (strcmp(*argv, "-reps") == 0 && argc > 1)
+            reps = atoi(*++argv), argc--;
+        else if (strcmp(*argv, "-cipher") == 0 && argc > 1)
+            cipher = *++argv, argc--;
+        else if (strcmp(*argv, "-cert") == 0 && argc > 1)
+            cert = *++argv, argc--;
+        else if (strcmp(*argv, "-dhparam") == 0 && argc > 1)
+            dhparam = *++argv, argc--;
+        else if (strcmp(*argv, "-q") == 0)
+            quiet = 1;
+        else if (**argv != '-' && trace == NULL)
+            trace = *argv;
+        else
+            goto bad;
+    }
+    for (m = strtok(modes, ","); m != NULL && nmodes < MAX_MODES;
+         m = strtok(NULL, ",")) {
+        for (i = 0; i < MAX_MODES; i++)
+            if (strcmp(m, mode_names[i]) == 0)
+                break;
+        if (i == MAX_MODES)
+            goto bad;
+        modelist[nmodes++] = i;
+    }
+    if (trace == NULL || nmodes == 0 || nproxies < 0 || nproxies > MAX_PROXIES ||
+        nslices < 1 || nslices > MAX_SPP_SLICES || reps < 1 || latency < 0)
+        goto bad;
+    if (!load_trace(trace))
+        return 1;
+
+    SSL_library_init();
+    SSL_load_error_strings();
+    locks = OPENSSL_malloc(CRYPTO_num_locks() * sizeof(pthread_mutex_t));
+    for (i = 0; i < CRYPTO_num_locks(); i++)
+        pthread_mutex_init(&locks[i], NULL);
+    CRYPTO_set_locking_callback(locking_cb);
+
+    for (i = 0; i < MAX_PROXIES; i++)
+        BIO_snprintf(proxy_address[i], sizeof(proxy_address[i]), "proxy%d", i);
+    /* Key material for the proxies is sealed to the client's key too. */
+    spp_client_ctx = make_ctx(SPP_method(), cert, dhparam);
+    spp_server_ctx = make_ctx(SPP_method(), cert, dhparam);
+    spp_proxy_ctx = make_ctx(SPP_proxy_method(), cert, dhparam);
+    tls_client_ctx = make_ctx(SSLv23_client_method(), NULL, NULL);
+    tls_server_ctx = make_ctx(SSLv23_server_method(), cert, dhparam);
+    if (spp_client_ctx == NULL || spp_server_ctx == NULL ||
+        spp_proxy_ctx == NULL || tls_client_ctx == NULL ||
+        tls_server_ctx == NULL) {
+        ERR_print_errors_fp(stderr);
+        return 1;
+    }
+
+    for (i = 0; i < nmodes; i++) {
+        mode = modelist[i];
+        for (r = 0; r < reps; r++) {
+            if (!replay())
+                failed++;
+            report(trace, r);
+        }
+    }
+
+    SSL_CTX_free(spp_client_ctx);
+    SSL_CTX_free(spp_server_ctx);
+    SSL_CTX_free(spp_proxy_ctx);
+    SSL_CTX_free(tls_client_ctx);
+    SSL_CTX_free(tls_server_ctx);
+    CRYPTO_set_locking_callback(NULL);
+    return failed ? 1 : 0;
+
+ bad:
+    usage();
+    return 1;
+}
@@ -144,6 +144,29 @@ void check_SSL_write_error(SSL *ssl, int r, int request_len){
 
 
 
+// SPP trace, see SSL_CTX_set_spp_trace(). Started with -t, and SIGUSR1
+// switches it on or off. The callback stays installed and drops the events
+// while tracing is off, so the handler only has to flip trace_on.
+// Every connection is served by a child forked from the listening process,
+// and a signal sent to the listening process does not reach them: to switch
+// the connections already open, signal the process group (kill -USR1 -<pid>).
+static volatile sig_atomic_t trace_on = 0;
+static BIO *trace_bio = NULL;
+
+static void trace_cb(const SSL *s, const SPP_TRACE_EVENT *ev, void *arg){
+	if (trace_on)
+		SPP_trace_print(s, ev, arg);
+}
+
+void set_trace(SSL_CTX *ctx){
+	if (ctx != NULL)
+		SSL_CTX_set_spp_trace(ctx, SPP_TRACE_HANDSHAKE|SPP_TRACE_RECORDS, trace_cb, trace_bio);
+}
+
+void toggle_trace(int sig){
+	trace_on = !trace_on;
+}
+
 //this creates a new outgoing SSL connection. If method = SSL it also runs SSL_connect
 SSL* create_SSL_connection(char *address, char* method){
 	#ifdef DEBUG
@@ -163,6 +186,7 @@ SSL* create_SSL_connection(char *address, char* method){
     #endif
 
 	ctx = initialize_ctx(KEYFILE, PASSWORD, method);
+	set_trace(ctx);
 	new_ssl = SSL_new(ctx);
 	sock = tcp_connect(ipv4, port);
 	sbio = BIO_new_socket(sock, BIO_NOCLOSE);
@@ -526,6 +550,7 @@ void usage(void){
 	printf("-p:   {port number that the box will listen at (default 8423)}\n");
 	printf("-m:   {id of this proxy in ip:port format.}\n");
 	printf("-l:   duration of load estimation time (10 sec default)\n");
+	printf("-t:   print SPP handshake messages and records to stderr (SIGUSR1 to the process group toggles)\n");
 	exit(-1);  
 }
 
@@ -555,7 +580,7 @@ int main(int argc, char **argv){
 	int ret;
 
 	// Handle user input parameters
-	while((c = getopt(argc, argv, "h:c:a:p:m:l:")) != -1){
+	while((c = getopt(argc, argv, "h:c:a:p:m:l:t")) != -1){
 			
 			switch(c){
 
@@ -609,6 +634,10 @@ int main(int argc, char **argv){
 			case 'l':   loadTime = atoi(optarg);
 						break; 
 
+			// Trace SPP handshake and records
+			case 't':   trace_on = 1;
+						break;
+
 			// Default case 
 			default:	usage(); 
 						break; 
@@ -640,6 +669,10 @@ int main(int argc, char **argv){
 			ctx = initialize_ctx(KEYFILE, PASSWORD, "ssl");
 
 		load_dh_params(ctx,DHFILE);
+
+		trace_bio = BIO_new_fp(stderr, BIO_NOCLOSE);
+		set_trace(ctx);
+		signal(SIGUSR1, toggle_trace);
 	}
    
 	// Socket in listen state
@@ -865,7 +865,7 @@ static int http_request(char *filename, char *proto, bool requestingFile, struct
 			printf("[INFO] Read %d bytes\n", r);
 			#endif
 			if (ssl->read_stats.app_bytes == fSize){
-				printf("[INFO] Read %d bytes as expected (fSize=%d). Stopping timer\n", ssl->read_stats.app_bytes, fSize);
+				printf("[INFO] Read %llu bytes as expected (fSize=%d). Stopping timer\n", (unsigned long long)ssl->read_stats.app_bytes, fSize);
 				// Stop the timer here (avoid shutdown crap) 
 				gettimeofday(tvEnd, NULL); 
 				#ifdef VERBOSE
@@ -903,7 +903,7 @@ static int http_request(char *filename, char *proto, bool requestingFile, struct
 			printf("[DEBUG] Read %d bytes\n", r);
 			#endif
 			if (ssl->read_stats.app_bytes == fSize){
-				printf("[INFO] Read %d bytes as expected (fSize=%d). Stopping timer\n", ssl->read_stats.app_bytes, fSize);
+				printf("[INFO] Read %llu bytes as expected (fSize=%d). Stopping timer\n", (unsigned long long)ssl->read_stats.app_bytes, fSize);
 				gettimeofday(tvEnd, NULL);
 				// Write buf to stdout
 				#ifdef VERBOSE
@@ -993,7 +993,7 @@ static int http_request(char *filename, char *proto, bool requestingFile, struct
 
 // report "BYTE STATISITICS"
 void print_stats(SSL *s) {
-	int total_read, total_write, app_read, app_write;
+	unsigned long long total_read, total_write, app_read, app_write;
 	if (strcmp(proto, "pln") == 0) {
 		total_read = app_read = experiment_info->app_bytes_read;
 		total_write = app_write = experiment_info->app_bytes_written;
@@ -1005,34 +1005,34 @@ void print_stats(SSL *s) {
 	}
 
     printf("[RESULTS] BYTE STATISITICS:\n");
-    printf("[RESULTS] Bytes read: %d\n", total_read);
-    printf("[RESULTS] Application bytes read: %d [Expected %d]\n", app_read, sizeCheck); 
-    printf("[RESULTS] Block padding bytes read: %d\n", s->read_stats.pad_bytes);
-    printf("[RESULTS] Header bytes read: %d\n", s->read_stats.header_bytes);
-    printf("[RESULTS] Handshake bytes read: %d\n", s->read_stats.handshake_bytes);
-    printf("[RESULTS] MAC bytes read: %d\n", s->read_stats.mac_bytes);
-    printf("[RESULTS] Alert bytes read: %d\n", s->read_stats.alert_bytes);
-    printf("[RESULTS] Bytes write: %d\n", total_write);
-    printf("[RESULTS] Application bytes write: %d\n", app_write);
-    printf("[RESULTS] Block padding bytes write: %d\n", s->write_stats.pad_bytes);
-    printf("[RESULTS] Header bytes write: %d\n", s->write_stats.header_bytes);
-    printf("[RESULTS] Handshake bytes write: %d\n", s->write_stats.handshake_bytes);
-    printf("[RESULTS] MAC bytes write: %d\n", s->write_stats.mac_bytes);
-    printf("[RESULTS] Alert bytes write: %d\n", s->write_stats.alert_bytes);
+    printf("[RESULTS] Bytes read: %llu\n", total_read);
+    printf("[RESULTS] Application bytes read: %llu [Expected %d]\n", app_read, sizeCheck); 
+    printf("[RESULTS] Block padding bytes read: %llu\n", (unsigned long long)s->read_stats.pad_bytes);
+    printf("[RESULTS] Header bytes read: %llu\n", (unsigned long long)s->read_stats.header_bytes);
+    printf("[RESULTS] Handshake bytes read: %llu\n", (unsigned long long)s->read_stats.handshake_bytes);
+    printf("[RESULTS] MAC bytes read: %llu\n", (unsigned long long)s->read_stats.mac_bytes);
+    printf("[RESULTS] Alert bytes read: %llu\n", (unsigned long long)s->read_stats.alert_bytes);
+    printf("[RESULTS] Bytes write: %llu\n", total_write);
+    printf("[RESULTS] Application bytes write: %llu\n", app_write);
+    printf("[RESULTS] Block padding bytes write: %llu\n", (unsigned long long)s->write_stats.pad_bytes);
+    printf("[RESULTS] Header bytes write: %llu\n", (unsigned long long)s->write_stats.header_bytes);
+    printf("[RESULTS] Handshake bytes write: %llu\n", (unsigned long long)s->write_stats.handshake_bytes);
+    printf("[RESULTS] MAC bytes write: %llu\n", (unsigned long long)s->write_stats.mac_bytes);
+    printf("[RESULTS] Alert bytes write: %llu\n", (unsigned long long)s->write_stats.alert_bytes);
 
 	// In one line (so it's easy for plotting script).
 	// num_slices num_mboxes file_size total app_total padding_total header_total handshake_total MAC_total alert_bytes
-	printf("[RESULTS] ByteStatsSummary %d %d %d %d %d %d %d %d %d %d\n",
+	printf("[RESULTS] ByteStatsSummary %d %d %d %llu %llu %llu %llu %llu %llu %llu\n",
 		experiment_info->num_slices,
 		experiment_info->num_proxies,
 		experiment_info->file_size,
 		total_read + total_write,
 		app_read + app_write,
-		s->read_stats.pad_bytes + s->write_stats.pad_bytes,
-		s->read_stats.header_bytes + s->write_stats.header_bytes,
-		s->read_stats.handshake_bytes + s->write_stats.handshake_bytes,
-		s->read_stats.mac_bytes + s->write_stats.mac_bytes,
-		s->read_stats.alert_bytes + s->write_stats.alert_bytes);
+		(unsigned long long)(s->read_stats.pad_bytes + s->write_stats.pad_bytes),
+		(unsigned long long)(s->read_stats.header_bytes + s->write_stats.header_bytes),
+		(unsigned long long)(s->read_stats.handshake_bytes + s->write_stats.handshake_bytes),
+		(unsigned long long)(s->read_stats.mac_bytes + s->write_stats.mac_bytes),
+		(unsigned long long)(s->read_stats.alert_bytes + s->write_stats.alert_bytes));
 }
 
 
@@ -0,0 +1,87 @@
+#! /usr/bin/env python
+
+# Turns HAR files into the .tab object lists ../benchmark/spp_replay replays
+# (the format of the .tab files in example/). Needs nothing but the standard
+# library, unlike har_to_object_times.py.
+
+import sys
+import re
+import json
+import argparse
+import calendar
+import datetime
+try:
+    from urlparse import urlparse
+except ImportError:
+    from urllib.parse import urlparse
+
+TAB_HEADER = 'host\t path\tcompressed size (bytes)\toriginal size (bytes)\t'\
+    'request start offset (sec)\t new TCP connection?\t new SSL handshake?\t'\
+    'original URL'
+
+# HAR timestamps are ISO 8601: 2015-01-09T02:00:19.274Z, or with an offset
+def parse_time(stamp):
+    m = re.match(r'(\d+-\d+-\d+T\d+:\d+:\d+)(\.\d+)?(Z|[+-]\d\d:?\d\d)?$',\
+        stamp)
+    if not m:
+        raise ValueError('bad timestamp %s' % stamp)
+    t = datetime.datetime.strptime(m.group(1), '%Y-%m-%dT%H:%M:%S')
+    secs = calendar.timegm(t.timetuple()) + float(m.group(2) or 0)
+    zone = m.group(3)
+    if zone and zone != 'Z':
+        sign = -1 if zone[0] == '-' else 1
+        zone = zone[1:].replace(':', '')
+        secs -= sign * (int(zone[:2]) * 3600 + int(zone[2:]) * 60)
+    return secs
+
+def split_url(url):
+    u = urlparse(url)
+    return u.netloc, u.path or '/'
+
+def har_to_tab(har_file, tab_file):
+    with open(har_file) as f:
+        log = json.load(f)['log']
+
+    entries = [e for e in log['entries'] if e['request']['url'].startswith('http')]
+    if not entries:
+        raise ValueError('no entries')
+    if log.get('pages'):
+        start = min(parse_time(p['startedDateTime']) for p in log['pages'])
+    else:
+        start = min(parse_time(e['startedDateTime']) for e in entries)
+
+    with open(tab_file, 'w') as f:
+        f.write(TAB_HEADER + '\n\n')
+        for e in sorted(entries, key=lambda e: parse_time(e['startedDateTime'])):
+            host, path = split_url(e['request']['url'])
+            response = e['response']
+            original = max(response.get('content', {}).get('size', 0), 0)
+            compressed = response.get('bodySize', -1)
+            if compressed < 0:
+                compressed = original
+            timings = e.get('timings', {})
+            f.write('\t'.join([host, path, str(compressed), str(original),\
+                '%f' % (parse_time(e['startedDateTime']) - start),\
+                str(timings.get('connect', -1) > 0),\
+                str(timings.get('ssl', -1) > 0),\
+                e['request']['url']]) + '\n')
+    return len(entries)
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert HAR files to .tab object lists.')
+    parser.add_argument('hars', nargs='+', help='HAR files; foo.har becomes foo.tab')
+    args = parser.parse_args()
+
+    status = 0
+    for har in args.hars:
+        tab = re.sub(r'\.har$', '', har) + '.tab'
+        try:
+            n = har_to_tab(har, tab)
+            print('%s: %d objects' % (tab, n))
+        except (IOError, ValueError, KeyError) as e:
+            sys.stderr.write('%s: %s\n' % (har, e))
+            status = 1
+    return status
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -28,6 +28,8 @@ PROTOCOLS = {
     7: ('spp', 'ssl', 'fwd', 'spp_mod', 'spp_2', 'spp_4'),
     8: ('spp', 'ssl', 'fwd', 'pln'),
     9: ('spp', 'ssl', 'fwd', 'pln', 'spp_mod'),
+    10: ('spp', 'fwd'),
+    11: ('spp', 'fwd'),
 }
 LEGEND_STRINGS = {
     'pln': 'NoEncrypt',
@@ -50,6 +52,8 @@ EXPERIMENT_NAMES = {
     7: 'connections_slice',
     8: 'byteOverhead_scenarios',
     9: 'timeFirstByte_scenarios',
+    10: 'handshake_proxy',
+    11: 'throughput_record',
     60: 'byteOverhead_browser',
 }
 X_AXIS = {
@@ -59,6 +63,8 @@ X_AXIS = {
     5: 'File Size (kB)',
     6: 'Load Time (s)',
     7: 'Number of Contexts',
+    10: 'Number of Middleboxes',
+    11: 'Record Size (bytes)',
 }
 Y_AXIS = {
     2: 'Time to First Byte (ms)',
@@ -69,6 +75,8 @@ Y_AXIS = {
     7: 'Connections per Second',
     8: 'Size (kB)',
     9: 'Download Time (s)',
+    10: 'Handshake Time (ms)',
+    11: 'Throughput (MB/s)',
 }
 DATA_TRANSFORMS = {
     2: lambda x: x*1000,
@@ -79,6 +87,8 @@ DATA_TRANSFORMS = {
     7: lambda x: x,
     8: lambda x: float(x)/1024.,
     9: lambda x: float(x),
+    10: lambda x: x,
+    11: lambda x: x/1e6,
     60: lambda x: float(x)/1024.,
 }
 SHOW_RTTS = {
@@ -90,6 +100,8 @@ SHOW_RTTS = {
     7: 0,
     8: 0,
     9: 4,
+    10: 0,
+    11: 0,
 }
 
 ##
@@ -176,6 +188,10 @@ def get_params(opt, remote, data):
         else:
             rtts = 2*numpy.multiply(data[:, 1], data[:, 2]+1)
 
+    elif opt in (10, 11):
+        # in-process runs of ../benchmark/perf_gate.py, no links
+        rtts = [0]*data.shape[0]
+
     return rtts, num_mboxes, num_slices
 
 
@@ -224,7 +240,7 @@ def outfile(opt, remote, machine, extra_tag=''):
     remote_str = 'remote' if remote else 'local'
     machine_str = machine if machine else 'local'
     filename = '%s_%s_%s%s.pdf' % (EXPERIMENT_NAMES[opt], remote_str, machine_str, extra_tag)
-    filepath = os.path.join(FIG_DIR, filename)
+    filepath = os.path.join(args.fig_dir, filename)
     return filename, filepath
 
 
@@ -471,7 +487,7 @@ def main():
     # machine name -> protocol -> result file path
     remote_files = defaultdict(lambda:defaultdict(list))  
     local_files = defaultdict(lambda:defaultdict(list))
-    for result_file in glob.glob(RESULT_DIR + '/*%s*' % EXPERIMENT_NAMES[args.opt]):
+    for result_file in glob.glob(args.result_dir + '/*%s*' % EXPERIMENT_NAMES[args.opt]):
         m = re.match(r'.*res_((.{3}(_mod)?)(_one-slice|_four-slices|_slice-per-header|_[0-9])?)_(remote_)?%s(_(.*))?' %\
             EXPERIMENT_NAMES[args.opt], result_file)
         if m:
@@ -501,7 +517,7 @@ def main():
             print 'WARNING: unexpected file name: %s' % result_file
             continue
 
-    if args.opt in (1, 2, 3, 4, 5, 7):
+    if args.opt in (1, 2, 3, 4, 5, 7, 10, 11):
         for machine, result_files in remote_files.iteritems():
             plot_series(machine, True, result_files)
 
@@ -546,6 +562,8 @@ if __name__ == '__main__':
     parser = argparse.ArgumentParser(formatter_class=argparse.ArgumentDefaultsHelpFormatter,\
                                      description='Plot mcTLS experiment results.')
     parser.add_argument('opt', type=int, help='Experiment type')
+    parser.add_argument('--result-dir', default=RESULT_DIR, help='Directory of res_* files')
+    parser.add_argument('--fig-dir', default=FIG_DIR, help='Directory for the plots')
     args = parser.parse_args()
 
     main()
@@ -785,7 +785,7 @@ int dtls1_read_bytes(SSL *s, int type, unsigned char *buf, int len, int peek)
 #endif
 		{
 		/* type == SSL3_RT_APPLICATION_DATA */
-		i=s->handshake_func(s);
+		i=ssl_run_handshake(s,s->handshake_func);
 		if (i < 0) return(i);
 		if (i == 0)
 			{
@@ -1063,7 +1063,7 @@ start:
 			ssl3_renegotiate(s);
 			if (ssl3_renegotiate_check(s))
 				{
-				i=s->handshake_func(s);
+				i=ssl_run_handshake(s,s->handshake_func);
 				if (i < 0) return(i);
 				if (i == 0)
 					{
@@ -1296,7 +1296,7 @@ start:
 			s->renegotiate=1;
 			s->new_session=1;
 			}
-		i=s->handshake_func(s);
+		i=ssl_run_handshake(s,s->handshake_func);
 		if (i < 0) return(i);
 		if (i == 0)
 			{
@@ -1401,7 +1401,7 @@ dtls1_write_app_data_bytes(SSL *s, int type, const void *buf_, int len)
 		if (SSL_in_init(s) && !s->in_handshake)
 #endif
 		{
-		i=s->handshake_func(s);
+		i=ssl_run_handshake(s,s->handshake_func);
 		if (i < 0) return(i);
 		if (i == 0)
 			{
@@ -131,7 +131,7 @@ int ssl23_read(SSL *s, void *buf, int len)
 	clear_sys_error();
 	if (SSL_in_init(s) && (!s->in_handshake))
 		{
-		n=s->handshake_func(s);
+		n=ssl_run_handshake(s,s->handshake_func);
 		if (n < 0) return(n);
 		if (n == 0)
 			{
@@ -154,7 +154,7 @@ int ssl23_peek(SSL *s, void *buf, int len)
 	clear_sys_error();
 	if (SSL_in_init(s) && (!s->in_handshake))
 		{
-		n=s->handshake_func(s);
+		n=ssl_run_handshake(s,s->handshake_func);
 		if (n < 0) return(n);
 		if (n == 0)
 			{
@@ -177,7 +177,7 @@ int ssl23_write(SSL *s, const void *buf, int len)
 	clear_sys_error();
 	if (SSL_in_init(s) && (!s->in_handshake))
 		{
-		n=s->handshake_func(s);
+		n=ssl_run_handshake(s,s->handshake_func);
 		if (n < 0) return(n);
 		if (n == 0)
 			{
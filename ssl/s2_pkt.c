@@ -135,7 +135,7 @@ static int ssl2_read_internal(SSL *s, void *buf, int len, int peek)
  ssl2_read_again:
 	if (SSL_in_init(s) && !s->in_handshake)
 		{
-		n=s->handshake_func(s);
+		n=ssl_run_handshake(s,s->handshake_func);
 		if (n < 0) return(n);
 		if (n == 0)
 			{
@@ -422,7 +422,7 @@ int ssl2_write(SSL *s, const void *_buf, int len)
 
 	if (SSL_in_init(s) && !s->in_handshake)
 		{
-		i=s->handshake_func(s);
+		i=ssl_run_handshake(s,s->handshake_func);
 		if (i < 0) return(i);
 		if (i == 0)
 			{
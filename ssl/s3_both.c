@@ -143,6 +143,8 @@ int ssl3_do_write(SSL *s, int type)
 		{
 		if (s->msg_callback)
 			s->msg_callback(1, s->version, type, s->init_buf->data, (size_t)(s->init_off + s->init_num), s, s->msg_callback_arg);
+		if (SPP_TRACE_FLAGS(s) & SPP_TRACE_HANDSHAKE)
+			spp_trace_message(s, 1, type, (unsigned char *)s->init_buf->data, (size_t)(s->init_off + s->init_num));
 		return(1);
 		}
 	s->init_off+=ret;
@@ -567,6 +569,8 @@ long ssl3_get_message(SSL *s, int st1, int stn, int mt, long max, int *ok)
 	ssl3_finish_mac(s, (unsigned char *)s->init_buf->data, s->init_num + 4);
 	if (s->msg_callback)
 		s->msg_callback(0, s->version, SSL3_RT_HANDSHAKE, s->init_buf->data, (size_t)s->init_num + 4, s, s->msg_callback_arg);
+	if (SPP_TRACE_FLAGS(s) & SPP_TRACE_HANDSHAKE)
+		spp_trace_message(s, 0, SSL3_RT_HANDSHAKE, (unsigned char *)s->init_buf->data, (size_t)s->init_num + 4);
 	*ok=1;
 	return s->init_num;
 f_err:
@@ -678,11 +682,12 @@ int ssl_verify_alarm_type(long type)
 #ifndef OPENSSL_NO_BUF_FREELISTS
 /* On some platforms, malloc() performance is bad enough that you can't just
  * free() and malloc() buffers all the time, so we need to use freelists from
- * unused buffers.  Currently, each freelist holds memory chunks of only a
- * given size (list->chunklen); other sized chunks are freed and malloced.
- * This doesn't help much if you're using many different SSL option settings
- * with a given context.  (The options affecting buffer size are
- * max_send_fragment, read buffer vs write buffer,
+ * unused buffers.  Each direction has SSL3_BUF_FREELIST_CLASSES freelists,
+ * each holding memory chunks of only a given size (list->chunklen), so that
+ * the SSL3/TLS and the (larger) SPP buffers of a context, or the batches of
+ * SSL_MODE_SPP_LARGE_WRITE, do not keep evicting each other; chunks of any
+ * further size are freed and malloced.  (The options affecting buffer size
+ * are max_send_fragment, read buffer vs write buffer,
  * SSL_OP_MICROSOFT_BIG_WRITE_BUFFER, SSL_OP_NO_COMPRESSION, and
  * SSL_OP_DONT_INSERT_EMPTY_FRAGMENTS.)  Using a separate freelist for every
  * possible size is not an option, since max_send_fragment can take on many
@@ -694,7 +699,173 @@ int ssl_verify_alarm_type(long type)
  *    - Link against a faster malloc implementation.
  *    - Use a separate SSL_CTX for each option set.
  *    - Improve this code.
+ *
+ * With SSL_MODE_SPP_BUFFER_SLABS an empty freelist is refilled from a
+ * slab of SSL3_BUF_SLAB_SIZE bytes (huge page backed where possible) cut
+ * into cache line aligned chunks. Such freelists keep every chunk returned
+ * to them; the slabs are released with the SSL_CTX.
  */
+
+#if defined(OPENSSL_SYS_UNIX)
+#include <sys/mman.h>
+#if defined(MAP_ANONYMOUS) || defined(MAP_ANON)
+#define SSL3_BUF_SLAB_MMAP
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+#endif
+#endif
+
+int
+ssl3_new_buf_freelists(SSL_CTX *ctx)
+	{
+	size_t sz = sizeof(SSL3_BUF_FREELIST)*SSL3_BUF_FREELIST_CLASSES;
+
+	ctx->rbuf_freelist = OPENSSL_malloc(sz);
+	ctx->wbuf_freelist = OPENSSL_malloc(sz);
+	ctx->buf_slabs = NULL;
+	if (ctx->rbuf_freelist == NULL || ctx->wbuf_freelist == NULL)
+		{
+		if (ctx->rbuf_freelist) OPENSSL_free(ctx->rbuf_freelist);
+		if (ctx->wbuf_freelist) OPENSSL_free(ctx->wbuf_freelist);
+		ctx->rbuf_freelist = ctx->wbuf_freelist = NULL;
+		return 0;
+		}
+	memset(ctx->rbuf_freelist, 0, sz);
+	memset(ctx->wbuf_freelist, 0, sz);
+	return 1;
+	}
+
+static int
+buf_in_slab(SSL_CTX *ctx, const void *mem)
+	{
+	SSL3_BUF_SLAB *slab;
+	const unsigned char *p = mem;
+
+	for (slab = ctx->buf_slabs; slab != NULL; slab = slab->next)
+		if (p >= slab->base && p < slab->base + slab->size)
+			return 1;
+	return 0;
+	}
+
+static void
+buf_freelists_free(SSL_CTX *ctx, SSL3_BUF_FREELIST *lists)
+	{
+	SSL3_BUF_FREELIST_ENTRY *ent, *next;
+	int i;
+
+	for (i = 0; i < SSL3_BUF_FREELIST_CLASSES; i++)
+		{
+		for (ent = lists[i].head; ent; ent = next)
+			{
+			next = ent->next;
+			if (!lists[i].slab || !buf_in_slab(ctx, ent))
+				OPENSSL_free(ent);
+			}
+		}
+	OPENSSL_free(lists);
+	}
+
+void
+ssl3_free_buf_freelists(SSL_CTX *ctx)
+	{
+	SSL3_BUF_SLAB *slab, *next;
+
+	if (ctx->wbuf_freelist)
+		buf_freelists_free(ctx, ctx->wbuf_freelist);
+	if (ctx->rbuf_freelist)
+		buf_freelists_free(ctx, ctx->rbuf_freelist);
+	ctx->wbuf_freelist = ctx->rbuf_freelist = NULL;
+	for (slab = ctx->buf_slabs; slab != NULL; slab = next)
+		{
+		next = slab->next;
+#ifdef SSL3_BUF_SLAB_MMAP
+		if (slab->mapped)
+			munmap(slab->base, slab->size);
+		else
+#endif
+			OPENSSL_free(slab->base);
+		OPENSSL_free(slab);
+		}
+	ctx->buf_slabs = NULL;
+	}
+
+/* Refill an empty freelist with chunks of list->chunklen bytes from a new
+ * slab. Called with the SSL_CTX lock held. */
+static int
+freelist_grow_slab(SSL_CTX *ctx, SSL3_BUF_FREELIST *list)
+	{
+	SSL3_BUF_SLAB *slab;
+	SSL3_BUF_FREELIST_ENTRY *ent;
+	size_t chunk, off;
+	void *p = NULL;
+
+	chunk = (list->chunklen + SPP_ALIGN_PAYLOAD-1) & ~(size_t)(SPP_ALIGN_PAYLOAD-1);
+	if (chunk > SSL3_BUF_SLAB_SIZE/2)
+		return 0;
+	if ((slab = OPENSSL_malloc(sizeof(SSL3_BUF_SLAB))) == NULL)
+		return 0;
+	slab->size = SSL3_BUF_SLAB_SIZE;
+	slab->mapped = 0;
+#ifdef SSL3_BUF_SLAB_MMAP
+# ifdef MAP_HUGETLB
+	p = mmap(NULL, slab->size, PROT_READ|PROT_WRITE,
+		MAP_PRIVATE|MAP_ANONYMOUS|MAP_HUGETLB, -1, 0);
+	if (p == MAP_FAILED)
+# endif
+		{
+		p = mmap(NULL, slab->size, PROT_READ|PROT_WRITE,
+			MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+# ifdef MADV_HUGEPAGE
+		if (p != MAP_FAILED)
+			madvise(p, slab->size, MADV_HUGEPAGE);
+# endif
+		}
+	if (p == MAP_FAILED)
+		p = NULL;
+	else
+		slab->mapped = 1;
+#endif
+	if (p == NULL && (p = OPENSSL_malloc(slab->size)) == NULL)
+		{
+		OPENSSL_free(slab);
+		return 0;
+		}
+	slab->base = p;
+	slab->next = ctx->buf_slabs;
+	ctx->buf_slabs = slab;
+
+	off = (0-(size_t)slab->base) & (SPP_ALIGN_PAYLOAD-1);
+	for (; off + chunk <= slab->size; off += chunk)
+		{
+		ent = (SSL3_BUF_FREELIST_ENTRY *)(slab->base + off);
+		ent->next = list->head;
+		list->head = ent;
+		++list->len;
+		}
+	list->slab = 1;
+	return 1;
+	}
+
+/* The freelist for chunks of sz bytes, or a free one to use for them. */
+static SSL3_BUF_FREELIST *
+freelist_find(SSL3_BUF_FREELIST *lists, size_t sz)
+	{
+	SSL3_BUF_FREELIST *unused = NULL;
+	int i;
+
+	if (lists == NULL)
+		return NULL;
+	for (i = 0; i < SSL3_BUF_FREELIST_CLASSES; i++)
+		{
+		if (lists[i].chunklen == sz)
+			return &lists[i];
+		if (unused == NULL && lists[i].chunklen == 0)
+			unused = &lists[i];
+		}
+	return unused;
+	}
+
 static void *
 freelist_extract(SSL_CTX *ctx, int for_read, int sz)
 	{
@@ -703,14 +874,21 @@ freelist_extract(SSL_CTX *ctx, int for_read, int sz)
 	void *result = NULL;
 
 	CRYPTO_w_lock(CRYPTO_LOCK_SSL_CTX);
-	list = for_read ? ctx->rbuf_freelist : ctx->wbuf_freelist;
+	list = freelist_find(for_read ? ctx->rbuf_freelist : ctx->wbuf_freelist, sz);
+	if (list != NULL && list->head == NULL &&
+	    (ctx->mode & SSL_MODE_SPP_BUFFER_SLABS))
+		{
+		list->chunklen = sz;
+		if (!freelist_grow_slab(ctx, list) && !list->slab)
+			list->chunklen = 0;
+		}
 	if (list != NULL && sz == (int)list->chunklen)
 		ent = list->head;
 	if (ent != NULL)
 		{
 		list->head = ent->next;
 		result = ent;
-		if (--list->len == 0)
+		if (--list->len == 0 && !list->slab)
 			list->chunklen = 0;
 		}
 	CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CTX);
@@ -726,10 +904,9 @@ freelist_insert(SSL_CTX *ctx, int for_read, size_t sz, void *mem)
 	SSL3_BUF_FREELIST_ENTRY *ent;
 
 	CRYPTO_w_lock(CRYPTO_LOCK_SSL_CTX);
-	list = for_read ? ctx->rbuf_freelist : ctx->wbuf_freelist;
+	list = freelist_find(for_read ? ctx->rbuf_freelist : ctx->wbuf_freelist, sz);
 	if (list != NULL &&
-	    (sz == list->chunklen || list->chunklen == 0) &&
-	    list->len < ctx->freelist_max_len &&
+	    (list->slab || list->len < ctx->freelist_max_len) &&
 	    sz >= sizeof(*ent))
 		{
 		list->chunklen = sz;
@@ -752,21 +929,30 @@ freelist_insert(SSL_CTX *ctx, int for_read, size_t sz, void *mem)
 int ssl3_setup_read_buffer(SSL *s)
 	{
 	unsigned char *p;
-	size_t len,align=0,headerlen;
+	size_t len,align=0,headerlen,overhead=SSL3_RT_MAX_ENCRYPTED_OVERHEAD;
 	
 	if (SSL_version(s) == DTLS1_VERSION || SSL_version(s) == DTLS1_BAD_VER)
 		headerlen = DTLS1_RT_HEADER_LENGTH;
+	else if (SSL_version(s) == SPP_VERSION)
+		{
+		headerlen = SPP_RT_HEADER_LENGTH;
+		overhead = SPP_RT_MAX_ENCRYPTED_OVERHEAD;
+		}
 	else
 		headerlen = SSL3_RT_HEADER_LENGTH;
 
 #if defined(SSL3_ALIGN_PAYLOAD) && SSL3_ALIGN_PAYLOAD!=0
-	align = (-SSL3_RT_HEADER_LENGTH)&(SSL3_ALIGN_PAYLOAD-1);
+	/* room to move the payload of any record onto an alignment boundary */
+	if (SSL_version(s) == SPP_VERSION)
+		align = SPP_ALIGN_PAYLOAD-1;
+	else
+		align = (-SSL3_RT_HEADER_LENGTH)&(SSL3_ALIGN_PAYLOAD-1);
 #endif
 
 	if (s->s3->rbuf.buf == NULL)
 		{
 		len = SSL3_RT_MAX_PLAIN_LENGTH
-			+ SSL3_RT_MAX_ENCRYPTED_OVERHEAD
+			+ overhead
 			+ headerlen + align;
 		if (s->options & SSL_OP_MICROSOFT_BIG_SSLV3_BUFFER)
 			{
@@ -794,23 +980,29 @@ err:
 int ssl3_setup_write_buffer(SSL *s)
 	{
 	unsigned char *p;
-	size_t len,align=0,headerlen;
+	size_t len,align=0,headerlen,overhead=SSL3_RT_SEND_MAX_ENCRYPTED_OVERHEAD;
 
 	if (SSL_version(s) == DTLS1_VERSION || SSL_version(s) == DTLS1_BAD_VER)
 		headerlen = DTLS1_RT_HEADER_LENGTH + 1;
         else if (SSL_version(s) == SPP_VERSION)
+                {
                 headerlen = SPP_RT_HEADER_LENGTH;
+                overhead = SPP_RT_SEND_MAX_ENCRYPTED_OVERHEAD;
+                }
 	else
 		headerlen = SSL3_RT_HEADER_LENGTH;
 
 #if defined(SSL3_ALIGN_PAYLOAD) && SSL3_ALIGN_PAYLOAD!=0
-	align = (-SSL3_RT_HEADER_LENGTH)&(SSL3_ALIGN_PAYLOAD-1);
+	if (SSL_version(s) == SPP_VERSION)
+		align = SPP_ALIGN_PAYLOAD-1;
+	else
+		align = (-SSL3_RT_HEADER_LENGTH)&(SSL3_ALIGN_PAYLOAD-1);
 #endif
 
 	if (s->s3->wbuf.buf == NULL)
 		{
 		len = s->max_send_fragment
-			+ SSL3_RT_SEND_MAX_ENCRYPTED_OVERHEAD
+			+ overhead
 			+ headerlen + align;
 #ifndef OPENSSL_NO_COMP
 		if (!(s->options & SSL_OP_NO_COMPRESSION))
@@ -818,7 +1010,7 @@ int ssl3_setup_write_buffer(SSL *s)
 #endif
 		if (!(s->options & SSL_OP_DONT_INSERT_EMPTY_FRAGMENTS))
 			len += headerlen + align
-				+ SSL3_RT_SEND_MAX_ENCRYPTED_OVERHEAD;
+				+ overhead;
 
 		if ((p=freelist_extract(s->ctx, 0, len)) == NULL)
 			goto err;
@@ -833,6 +1025,34 @@ err:
 	return 0;
 	}
 
+/* Make the (empty) write buffer hold len bytes plus the same alignment
+ * slack as ssl3_setup_write_buffer(), swapping it through the freelists. */
+int ssl3_grow_write_buffer(SSL *s, size_t len)
+	{
+	unsigned char *p;
+	size_t align=0;
+
+#if defined(SSL3_ALIGN_PAYLOAD) && SSL3_ALIGN_PAYLOAD!=0
+	if (SSL_version(s) == SPP_VERSION)
+		align = SPP_ALIGN_PAYLOAD-1;
+	else
+		align = (-SSL3_RT_HEADER_LENGTH)&(SSL3_ALIGN_PAYLOAD-1);
+#endif
+	len += align;
+	if (s->s3->wbuf.buf != NULL && s->s3->wbuf.len >= len)
+		return 1;
+
+	ssl3_release_write_buffer(s);
+	if ((p=freelist_extract(s->ctx, 0, len)) == NULL)
+		{
+		SSLerr(SSL_F_SSL3_SETUP_WRITE_BUFFER,ERR_R_MALLOC_FAILURE);
+		return 0;
+		}
+	s->s3->wbuf.buf = p;
+	s->s3->wbuf.len = len;
+	return 1;
+	}
+
 
 int ssl3_setup_buffers(SSL *s)
 	{
@@ -1095,6 +1095,8 @@ int ssl3_get_server_certificate(SSL *s)
 	SESS_CERT *sc;
 	EVP_PKEY *pkey=NULL;
 	int need_cert = 1; /* VRS: 0=> will allow null cert if auth == KRB5 */
+	CRYPTO_MEM_ARENA *arena;
+	SPP_TIMER(pk_t);
 
 	n=s->method->ssl_get_message(s,
 		SSL3_ST_CR_CERT_A,
@@ -1113,6 +1115,8 @@ int ssl3_get_server_certificate(SSL *s)
 		return(1);
 		}
 
+	/* the certificates stay with the session */
+	arena=ssl_arena_leave(s);
 	if (s->s3->tmp.message_type != SSL3_MT_CERTIFICATE)
 		{
 		al=SSL_AD_UNEXPECTED_MESSAGE;
@@ -1168,7 +1172,9 @@ int ssl3_get_server_certificate(SSL *s)
 		p=q;
 		}
 
+	SPP_PK_START(pk_t);
 	i=ssl_verify_cert_chain(s,sk);
+	SPP_PK_END(s, SPP_PK_CHAIN_VERIFY, 0, pk_t);
 	if ((s->verify_mode != SSL_VERIFY_NONE) && (i <= 0)
 #ifndef OPENSSL_NO_KRB5
 	    && !((s->s3->tmp.new_cipher->algorithm_mkey & SSL_kKRB5) &&
@@ -1267,6 +1273,7 @@ err:
 	EVP_PKEY_free(pkey);
 	X509_free(x);
 	sk_X509_pop_free(sk,X509_free);
+	ssl_arena_enter(s,arena);
 	return(ret);
 	}
 
@@ -1294,6 +1301,8 @@ int ssl3_get_key_exchange(SSL *s)
 	int curve_nid = 0;
 	int encoded_pt_len = 0;
 #endif
+	CRYPTO_MEM_ARENA *arena;
+	SPP_TIMER(pk_t);
 
 	/* use same message size as in ssl3_get_certificate_request()
 	 * as ServerKeyExchange message may be skipped */
@@ -1324,6 +1333,8 @@ int ssl3_get_key_exchange(SSL *s)
 		return(1);
 		}
 
+	/* the server's keys stay with the session */
+	arena=ssl_arena_leave(s);
 	param=p=(unsigned char *)s->init_msg;
 	if (s->session->sess_cert != NULL)
 		{
@@ -1917,8 +1928,10 @@ fprintf(stderr, "USING TLSv1.2 HASH %s\n", EVP_MD_name(md));
 				q+=size;
 				j+=size;
 				}
+			SPP_PK_START(pk_t);
 			i=RSA_verify(NID_md5_sha1, md_buf, j, p, n,
 								pkey->pkey.rsa);
+			SPP_PK_END(s, SPP_PK_RSA_VERIFY, 0, pk_t);
 			if (i < 0)
 				{
 				al=SSL_AD_DECRYPT_ERROR;
@@ -1940,6 +1953,7 @@ fprintf(stderr, "USING TLSv1.2 HASH %s\n", EVP_MD_name(md));
 			EVP_VerifyUpdate(&md_ctx,&(s->s3->client_random[0]),SSL3_RANDOM_SIZE);
 			EVP_VerifyUpdate(&md_ctx,&(s->s3->server_random[0]),SSL3_RANDOM_SIZE);
 			EVP_VerifyUpdate(&md_ctx,param,param_len);
+			SPP_PK_START(pk_t);
 			if (EVP_VerifyFinal(&md_ctx,p,(int)n,pkey) <= 0)
 				{
 				/* bad signature */
@@ -1947,6 +1961,7 @@ fprintf(stderr, "USING TLSv1.2 HASH %s\n", EVP_MD_name(md));
 				SSLerr(SSL_F_SSL3_GET_KEY_EXCHANGE,SSL_R_BAD_SIGNATURE);
 				goto f_err;
 				}
+			SPP_PK_END(s, spp_pk_sign_op(pkey, 1), 0, pk_t);
 			}
 		}
 	else
@@ -1966,6 +1981,7 @@ fprintf(stderr, "USING TLSv1.2 HASH %s\n", EVP_MD_name(md));
 		}
 	EVP_PKEY_free(pkey);
 	EVP_MD_CTX_cleanup(&md_ctx);
+	ssl_arena_enter(s,arena);
 	return(1);
 f_err:
 	ssl3_send_alert(s,SSL3_AL_FATAL,al);
@@ -1986,6 +2002,7 @@ err:
 		EC_KEY_free(ecdh);
 #endif
 	EVP_MD_CTX_cleanup(&md_ctx);
+	ssl_arena_enter(s,arena);
 	return(-1);
 	}
 
@@ -2170,6 +2187,7 @@ int ssl3_get_new_session_ticket(SSL *s)
 	long n;
 	const unsigned char *p;
 	unsigned char *d;
+	CRYPTO_MEM_ARENA *arena;
 
 	n=s->method->ssl_get_message(s,
 		SSL3_ST_CR_SESSION_TICKET_A,
@@ -2215,7 +2233,10 @@ int ssl3_get_new_session_ticket(SSL *s)
 		OPENSSL_free(s->session->tlsext_tick);
 		s->session->tlsext_ticklen = 0;
 		}
+	/* the ticket stays with the session */
+	arena=ssl_arena_leave(s);
 	s->session->tlsext_tick = OPENSSL_malloc(ticklen);
+	ssl_arena_enter(s,arena);
 	if (!s->session->tlsext_tick)
 		{
 		SSLerr(SSL_F_SSL3_GET_NEW_SESSION_TICKET,ERR_R_MALLOC_FAILURE);
@@ -2367,6 +2388,7 @@ int ssl3_send_client_key_exchange(SSL *s)
 	int encoded_pt_len = 0;
 	BN_CTX * bn_ctx = NULL;
 #endif
+	SPP_TIMER(pk_t);
 
 	if (s->state == SSL3_ST_CW_KEY_EXCH_A)
 		{
@@ -2417,8 +2439,10 @@ int ssl3_send_client_key_exchange(SSL *s)
 			/* Fix buf for TLS and beyond */
 			if (s->version > SSL3_VERSION)
 				p+=2;
+			SPP_PK_START(pk_t);
 			n=RSA_public_encrypt(sizeof tmp_buf,
 				tmp_buf,p,rsa,RSA_PKCS1_PADDING);
+			SPP_PK_END(s, SPP_PK_RSA_ENCRYPT, 0, pk_t);
 #ifdef PKCS1_CHECK
 			if (s->options & SSL_OP_PKCS1_CHECK_1) p[1]++;
 			if (s->options & SSL_OP_PKCS1_CHECK_2) tmp_buf[0]=0x70;
@@ -2605,17 +2629,21 @@ int ssl3_send_client_key_exchange(SSL *s)
 				SSLerr(SSL_F_SSL3_SEND_CLIENT_KEY_EXCHANGE,ERR_R_DH_LIB);
 				goto err;
 				}
+			SPP_PK_START(pk_t);
 			if (!DH_generate_key(dh_clnt))
 				{
 				SSLerr(SSL_F_SSL3_SEND_CLIENT_KEY_EXCHANGE,ERR_R_DH_LIB);
 				DH_free(dh_clnt);
 				goto err;
 				}
+			SPP_PK_END(s, SPP_PK_DH_KEYGEN, 0, pk_t);
 
 			/* use the 'p' output buffer for the DH key, but
 			 * make sure to clear it out afterwards */
 
+			SPP_PK_START(pk_t);
 			n=DH_compute_key(p,dh_srvr->pub_key,dh_clnt);
+			SPP_PK_END(s, SPP_PK_DH_DERIVE, 0, pk_t);
 
 			if (n <= 0)
 				{
@@ -2751,11 +2779,13 @@ int ssl3_send_client_key_exchange(SSL *s)
 			else 
 				{
 				/* Generate a new ECDH key pair */
+				SPP_PK_START(pk_t);
 				if (!(EC_KEY_generate_key(clnt_ecdh)))
 					{
 					SSLerr(SSL_F_SSL3_SEND_CLIENT_KEY_EXCHANGE, ERR_R_ECDH_LIB);
 					goto err;
 					}
+				SPP_PK_END(s, SPP_PK_ECDH_KEYGEN, 0, pk_t);
 				}
 
 			/* use the 'p' output buffer for the ECDH key, but
@@ -2769,7 +2799,9 @@ int ssl3_send_client_key_exchange(SSL *s)
 				       ERR_R_ECDH_LIB);
 				goto err;
 				}
+			SPP_PK_START(pk_t);
 			n=ECDH_compute_key(p, (field_size+7)/8, srvr_ecpoint, clnt_ecdh, NULL);
+			SPP_PK_END(s, SPP_PK_ECDH_DERIVE, 0, pk_t);
 			if (n <= 0)
 				{
 				SSLerr(SSL_F_SSL3_SEND_CLIENT_KEY_EXCHANGE, 
@@ -2895,11 +2927,13 @@ int ssl3_send_client_key_exchange(SSL *s)
 			/*Encapsulate it into sequence */
 			*(p++)=V_ASN1_SEQUENCE | V_ASN1_CONSTRUCTED;
 			msglen=255;
+			SPP_PK_START(pk_t);
 			if (EVP_PKEY_encrypt(pkey_ctx,tmp,&msglen,premaster_secret,32)<0) {
 			SSLerr(SSL_F_SSL3_SEND_CLIENT_KEY_EXCHANGE,
 					SSL_R_LIBRARY_BUG);
 				goto err;
 			}
+			SPP_PK_END(s, SPP_PK_OTHER, 0, pk_t);
 			if (msglen >= 0x80)
 				{
 				*(p++)=0x81;
@@ -3092,6 +3126,7 @@ int ssl3_send_client_verify(SSL *s)
 	unsigned u=0;
 	unsigned long n;
 	int j;
+	SPP_TIMER(pk_t);
 
 	EVP_MD_CTX_init(&mctx);
 
@@ -3100,6 +3135,7 @@ int ssl3_send_client_verify(SSL *s)
 		d=(unsigned char *)s->init_buf->data;
 		p= &(d[4]);
 		pkey=s->cert->key->privatekey;
+		SPP_PK_START(pk_t);
 /* Create context from key and test if sha1 is allowed as digest */
 		pctx = EVP_PKEY_CTX_new(pkey,NULL);
 		EVP_PKEY_sign_init(pctx);
@@ -3224,6 +3260,7 @@ int ssl3_send_client_verify(SSL *s)
 			SSLerr(SSL_F_SSL3_SEND_CLIENT_VERIFY,ERR_R_INTERNAL_ERROR);
 			goto err;
 		}
+		SPP_PK_END(s, spp_pk_sign_op(pkey, 0), 0, pk_t);
 		*(d++)=SSL3_MT_CERTIFICATE_VERIFY;
 		l2n3(n,d);
 
@@ -228,7 +228,10 @@ int ssl3_change_cipher_state(SSL *s, int which)
 	EVP_MD_CTX md;
 	int is_exp,n,i,j,k,cl;
 	int reuse_dd = 0;
+	CRYPTO_MEM_ARENA *arena;
 
+	/* the cipher state outlives the handshake */
+	arena=ssl_arena_leave(s);
 	is_exp=SSL_C_IS_EXPORT(s->s3->tmp.new_cipher);
 	c=s->s3->tmp.new_sym_enc;
 	m=s->s3->tmp.new_hash;
@@ -378,10 +381,12 @@ int ssl3_change_cipher_state(SSL *s, int which)
 	OPENSSL_cleanse(&(exp_key[0]),sizeof(exp_key));
 	OPENSSL_cleanse(&(exp_iv[0]),sizeof(exp_iv));
 	EVP_MD_CTX_cleanup(&md);
+	ssl_arena_enter(s,arena);
 	return(1);
 err:
 	SSLerr(SSL_F_SSL3_CHANGE_CIPHER_STATE,ERR_R_MALLOC_FAILURE);
 err2:
+	ssl_arena_enter(s,arena);
 	return(0);
 	}
 
@@ -599,7 +604,10 @@ int ssl3_digest_cached_records(SSL *s)
 	const EVP_MD *md;
 	long hdatalen;
 	void *hdata;
+	CRYPTO_MEM_ARENA *arena;
 
+	/* the digests are kept until the next handshake */
+	arena=ssl_arena_leave(s);
 	/* Allocate handshake_dgst array */
 	ssl3_free_digest_list(s);
 	s->s3->handshake_dgst = OPENSSL_malloc(SSL_MAX_DIGEST * sizeof(EVP_MD_CTX *));
@@ -608,6 +616,7 @@ int ssl3_digest_cached_records(SSL *s)
 	if (hdatalen <= 0)
 		{
 		SSLerr(SSL_F_SSL3_DIGEST_CACHED_RECORDS, SSL_R_BAD_HANDSHAKE_LENGTH);
+		ssl_arena_enter(s,arena);
 		return 0;
 		}
 
@@ -639,6 +648,7 @@ int ssl3_digest_cached_records(SSL *s)
 		s->s3->handshake_buffer = NULL;
 		}
 
+	ssl_arena_enter(s,arena);
 	return 1;
 	}
 
@@ -145,8 +145,13 @@ int ssl3_read_n(SSL *s, int n, int max, int extend)
 
 	left  = rb->left;
 #if defined(SSL3_ALIGN_PAYLOAD) && SSL3_ALIGN_PAYLOAD!=0
-	align = (long)rb->buf + SSL3_RT_HEADER_LENGTH;
-	align = (-align)&(SSL3_ALIGN_PAYLOAD-1);
+	if (SSL_version(s) == SPP_VERSION)
+		align = spp_payload_align(s, rb->buf, 0);
+	else
+		{
+		align = (long)rb->buf + SSL3_RT_HEADER_LENGTH;
+		align = (-align)&(SSL3_ALIGN_PAYLOAD-1);
+		}
 #endif
 
 	if (!extend)
@@ -339,6 +344,7 @@ again:
                 else
                     s->read_stats.header_bytes += SSL3_RT_HEADER_LENGTH;
                 s->read_stats.bytes += rr->length + SSL3_RT_HEADER_LENGTH;
+                s->read_stats.records++;
 #if 0
 fprintf(stderr, "Record type=%d, Length=%d\n", rr->type, rr->length);
 #endif
@@ -620,7 +626,7 @@ int ssl3_write_bytes(SSL *s, int type, const void *buf_, int len)
 
 	if (SSL_in_init(s) && !s->in_handshake)
 		{
-		i=s->handshake_func(s);
+		i=ssl_run_handshake(s,s->handshake_func);
 		if (i < 0) return(i);
 		if (i == 0)
 			{
@@ -890,6 +896,7 @@ static int do_ssl3_write(SSL *s, int type, const unsigned char *buf,
 	s2n(wr->length,plen);
         
         s->write_stats.bytes += wr->length + SSL3_RT_HEADER_LENGTH;
+        s->write_stats.records++;
 
 	/* we should now have
 	 * wr->data pointing to the encrypted data, which is
@@ -1047,7 +1054,7 @@ int ssl3_read_bytes(SSL *s, int type, unsigned char *buf, int len, int peek)
 	if (!s->in_handshake && SSL_in_init(s))
 		{
 		/* type == SSL3_RT_APPLICATION_DATA */
-		i=s->handshake_func(s);
+		i=ssl_run_handshake(s,s->handshake_func);
 		if (i < 0) return(i);
 		if (i == 0)
 			{
@@ -1214,7 +1221,7 @@ start:
 			ssl3_renegotiate(s);
 			if (ssl3_renegotiate_check(s))
 				{
-				i=s->handshake_func(s);
+				i=ssl_run_handshake(s,s->handshake_func);
 				if (i < 0) return(i);
 				if (i == 0)
 					{
@@ -1401,7 +1408,7 @@ start:
 			s->renegotiate=1;
 			s->new_session=1;
 			}
-		i=s->handshake_func(s);
+		i=ssl_run_handshake(s,s->handshake_func);
 		if (i < 0) return(i);
 		if (i == 0)
 			{
@@ -932,6 +932,7 @@ int ssl3_get_client_hello(SSL *s)
 	SSL_COMP *comp=NULL;
 #endif
 	STACK_OF(SSL_CIPHER) *ciphers=NULL;
+	CRYPTO_MEM_ARENA *arena;
 
 	/* We do this so that we will respond with our native type.
 	 * If we are TLSv1 and we get SSLv3, we will respond with TLSv1,
@@ -1098,11 +1099,15 @@ int ssl3_get_client_hello(SSL *s)
 		SSLerr(SSL_F_SSL3_GET_CLIENT_HELLO,SSL_R_LENGTH_MISMATCH);
 		goto f_err;
 		}
+	/* the list goes into the session */
+	arena=ssl_arena_leave(s);
 	if ((i > 0) && (ssl_bytes_to_cipher_list(s,p,i,&(ciphers))
 		== NULL))
 		{
+		ssl_arena_enter(s,arena);
 		goto err;
 		}
+	ssl_arena_enter(s,arena);
 	p+=i;
 
 	/* If it is a hit, check that the cipher is in the list */
@@ -1583,6 +1588,7 @@ int ssl3_send_server_key_exchange(SSL *s)
 	int nr[4],kn;
 	BUF_MEM *buf;
 	EVP_MD_CTX md_ctx;
+	SPP_TIMER(pk_t);
 
 	EVP_MD_CTX_init(&md_ctx);
 	if (s->state == SSL3_ST_SW_KEY_EXCH_A)
@@ -1656,12 +1662,14 @@ int ssl3_send_server_key_exchange(SSL *s)
 			     dhp->priv_key == NULL ||
 			     (s->options & SSL_OP_SINGLE_DH_USE)))
 				{
+				SPP_PK_START(pk_t);
 				if(!DH_generate_key(dh))
 				    {
 				    SSLerr(SSL_F_SSL3_SEND_SERVER_KEY_EXCHANGE,
 					   ERR_R_DH_LIB);
 				    goto err;
 				    }
+				SPP_PK_END(s, SPP_PK_DH_KEYGEN, 0, pk_t);
 				}
 			else
 				{
@@ -1722,11 +1730,13 @@ int ssl3_send_server_key_exchange(SSL *s)
 			    (EC_KEY_get0_private_key(ecdh) == NULL) ||
 			    (s->options & SSL_OP_SINGLE_ECDH_USE))
 				{
+				SPP_PK_START(pk_t);
 				if(!EC_KEY_generate_key(ecdh))
 				    {
 				    SSLerr(SSL_F_SSL3_SEND_SERVER_KEY_EXCHANGE,ERR_R_ECDH_LIB);
 				    goto err;
 				    }
+				SPP_PK_END(s, SPP_PK_ECDH_KEYGEN, 0, pk_t);
 				}
 
 			if (((group = EC_KEY_get0_group(ecdh)) == NULL) ||
@@ -1927,6 +1937,7 @@ int ssl3_send_server_key_exchange(SSL *s)
 		/* not anonymous */
 		if (pkey != NULL)
 			{
+			SPP_PK_START(pk_t);
 			/* n is the length of the params, they start at &(d[4])
 			 * and p points to the space at the end. */
 #ifndef OPENSSL_NO_RSA
@@ -2001,6 +2012,7 @@ int ssl3_send_server_key_exchange(SSL *s)
 				SSLerr(SSL_F_SSL3_SEND_SERVER_KEY_EXCHANGE,SSL_R_UNKNOWN_PKEY_TYPE);
 				goto f_err;
 				}
+			SPP_PK_END(s, spp_pk_sign_op(pkey, 0), 0, pk_t);
 			}
 
 		*(d++)=SSL3_MT_SERVER_KEY_EXCHANGE;
@@ -2152,6 +2164,7 @@ int ssl3_get_client_key_exchange(SSL *s)
 	EC_POINT *clnt_ecpoint = NULL;
 	BN_CTX *bn_ctx = NULL; 
 #endif
+	SPP_TIMER(pk_t);
 
 	n=s->method->ssl_get_message(s,
 		SSL3_ST_SR_KEY_EXCH_A,
@@ -2230,7 +2243,9 @@ int ssl3_get_client_key_exchange(SSL *s)
 		if (RAND_pseudo_bytes(rand_premaster_secret,
 				      sizeof(rand_premaster_secret)) <= 0)
 			goto err;
+		SPP_PK_START(pk_t);
 		decrypt_len = RSA_private_decrypt((int)n,p,p,rsa,RSA_PKCS1_PADDING);
+		SPP_PK_END(s, SPP_PK_RSA_DECRYPT, 0, pk_t);
 		ERR_clear_error();
 
 		/* decrypt_len should be SSL_MAX_MASTER_KEY_LENGTH.
@@ -2325,7 +2340,9 @@ int ssl3_get_client_key_exchange(SSL *s)
 			goto err;
 			}
 
+		SPP_PK_START(pk_t);
 		i=DH_compute_key(p,pub,dh_srvr);
+		SPP_PK_END(s, SPP_PK_DH_DERIVE, 0, pk_t);
 
 		if (i <= 0)
 			{
@@ -2671,7 +2688,9 @@ int ssl3_get_client_key_exchange(SSL *s)
 			       ERR_R_ECDH_LIB);
 			goto err;
 			}
+		SPP_PK_START(pk_t);
 		i = ECDH_compute_key(p, (field_size+7)/8, clnt_ecpoint, srvr_ecdh, NULL);
+		SPP_PK_END(s, SPP_PK_ECDH_DERIVE, 0, pk_t);
 		if (i <= 0)
 			{
 			SSLerr(SSL_F_SSL3_GET_CLIENT_KEY_EXCHANGE,
@@ -2875,12 +2894,14 @@ int ssl3_get_client_key_exchange(SSL *s)
 				}
 			start = p;
 			inlen = Tlen;
+			SPP_PK_START(pk_t);
 			if (EVP_PKEY_decrypt(pkey_ctx,premaster_secret,&outlen,start,inlen) <=0) 
 
 				{
 				SSLerr(SSL_F_SSL3_GET_CLIENT_KEY_EXCHANGE,SSL_R_DECRYPTION_FAILED);
 				goto gerr;
 				}
+			SPP_PK_END(s, SPP_PK_OTHER, 0, pk_t);
 			/* Generate master secret */
 			s->session->master_key_length=
 				s->method->ssl3_enc->generate_master_secret(s,
@@ -2932,6 +2953,7 @@ int ssl3_get_cert_verify(SSL *s)
 	X509 *peer;
 	const EVP_MD *md = NULL;
 	EVP_MD_CTX mctx;
+	SPP_TIMER(pk_t);
 	EVP_MD_CTX_init(&mctx);
 
 	n=s->method->ssl_get_message(s,
@@ -3047,6 +3069,7 @@ fprintf(stderr, "USING TLSv1.2 HASH %s\n", EVP_MD_name(md));
 		al=SSL_AD_DECODE_ERROR;
 		goto f_err;
 		}
+	SPP_PK_START(pk_t);
 
 	if (TLS1_get_version(s) >= TLS1_2_VERSION)
 		{
@@ -3160,6 +3183,7 @@ fprintf(stderr, "USING TLSv1.2 HASH %s\n", EVP_MD_name(md));
 		al=SSL_AD_UNSUPPORTED_CERTIFICATE;
 		goto f_err;
 		}
+	SPP_PK_END(s, spp_pk_sign_op(pkey, 1), 0, pk_t);
 
 
 	ret=1;
@@ -3188,6 +3212,7 @@ int ssl3_get_client_certificate(SSL *s)
 	const unsigned char *p,*q;
 	unsigned char *d;
 	STACK_OF(X509) *sk=NULL;
+	SPP_TIMER(pk_t);
 
 	n=s->method->ssl_get_message(s,
 		SSL3_ST_SR_CERT_A,
@@ -3297,7 +3322,9 @@ int ssl3_get_client_certificate(SSL *s)
 		}
 	else
 		{
+		SPP_PK_START(pk_t);
 		i=ssl_verify_cert_chain(s,sk);
+		SPP_PK_END(s, SPP_PK_CHAIN_VERIFY, 0, pk_t);
 		if (i <= 0)
 			{
 			al=ssl_verify_alarm_type(s->verify_result);
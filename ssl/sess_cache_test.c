@@ -0,0 +1,381 @@
+/* ssl/sess_cache_test.c */
+/*
+ * Unit test for the sharded internal session cache.
+ *
+ * Fills the cache of a server SSL_CTX with sessions made up here, some of
+ * them expired, and checks that SSL_CTX_sessions_doall() and
+ * SSL_CTX_sessions_shard() see every shard, that SSL_CTX_flush_sessions()
+ * and the flush every 255 connections remove every expired session however
+ * recently it was used, and in the order of their timeouts also when those
+ * change in the cache, that a full cache drops sessions, and that threads
+ * adding, finding and removing sessions concurrently keep the count right.
+ *
+ * The program returns zero on success and prints the failing test cases
+ * otherwise.
+ */
+
+#include "../ssl/ssl_locl.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(OPENSSL_THREADS) && !defined(OPENSSL_SYS_WINDOWS) && !defined(OPENSSL_SYS_NETWARE) && !defined(OPENSSL_SYS_VMS)
+#define SESS_TEST_PTHREADS
+#include <pthread.h>
+#endif
+
+#define TEST_SESSIONS	200
+#define TEST_THREADS	4
+#define TEST_PER_THREAD	2000
+
+static int removed;
+
+static void count_removed(SSL_CTX *ctx, SSL_SESSION *sess)
+	{
+	removed++;
+	}
+
+static void count_session(SSL_SESSION *sess, void *arg)
+	{
+	(*(int *)arg)++;
+	}
+
+/* A session with ID n, expired if timeout is negative */
+static SSL_SESSION *make_session(unsigned long n, long timeout)
+	{
+	SSL_SESSION *sess;
+	unsigned int i;
+
+	if ((sess=SSL_SESSION_new()) == NULL)
+		return NULL;
+	sess->ssl_version=TLS1_2_VERSION;
+	sess->session_id_length=SSL3_SSL_SESSION_ID_LENGTH;
+	memset(sess->session_id,0,sizeof(sess->session_id));
+	for (i=0; i<sizeof(n); i++)
+		sess->session_id[i]=(unsigned char)(n>>(8*i));
+	if (timeout < 0)
+		{
+		SSL_SESSION_set_time(sess,(long)time(NULL)-1000);
+		SSL_SESSION_set_timeout(sess,-timeout);
+		}
+	else
+		SSL_SESSION_set_timeout(sess,timeout);
+	return sess;
+	}
+
+/* Adds sessions first to last, every other one expired; the cache keeps
+ * its reference. */
+static int add_sessions(SSL_CTX *ctx, unsigned long first, unsigned long last)
+	{
+	SSL_SESSION *sess;
+	unsigned long n;
+
+	for (n=first; n<last; n++)
+		{
+		if ((sess=make_session(n,n&1 ? -10 : 1000)) == NULL)
+			return 0;
+		if (!SSL_CTX_add_session(ctx,sess))
+			return 0;
+		SSL_SESSION_free(sess);
+		}
+	return 1;
+	}
+
+static int cache_count(SSL_CTX *ctx)
+	{
+	LHASH_OF(SSL_SESSION) *lh;
+	unsigned int i;
+	int n=0,walked=0;
+
+	for (i=0; (lh=SSL_CTX_sessions_shard(ctx,i)) != NULL; i++)
+		n+=lh_SSL_SESSION_num_items(lh);
+	if (i != SSL_CTX_sess_get_cache_shards(ctx))
+		return -1;
+	SSL_CTX_sessions_doall(ctx,count_session,&walked);
+	if (walked != n || n != SSL_CTX_sess_number(ctx))
+		return -1;
+	return n;
+	}
+
+static SSL_CTX *set_up(long mode)
+	{
+	SSL_CTX *ctx;
+
+	if ((ctx=SSL_CTX_new(TLSv1_2_server_method())) == NULL)
+		return NULL;
+	SSL_CTX_set_session_cache_mode(ctx,mode);
+	SSL_CTX_sess_set_remove_cb(ctx,count_removed);
+	removed=0;
+	return ctx;
+	}
+
+static int test_shards(void)
+	{
+	SSL_CTX *ctx;
+	int ret=1;
+
+	if ((ctx=set_up(SSL_SESS_CACHE_SERVER)) == NULL)
+		return 1;
+	if (SSL_CTX_sess_get_cache_shards(ctx) != SSL_SESSION_CACHE_SHARDS_DEFAULT)
+		goto err;
+	if (!SSL_CTX_sess_set_cache_shards(ctx,5) ||
+		SSL_CTX_sess_set_cache_shards(ctx,0) ||
+		SSL_CTX_sess_set_cache_shards(ctx,SSL_SESSION_CACHE_MAX_SHARDS+1))
+		goto err;
+	if (!add_sessions(ctx,0,TEST_SESSIONS) ||
+		cache_count(ctx) != TEST_SESSIONS)
+		goto err;
+	/* not while there are sessions */
+	if (SSL_CTX_sess_set_cache_shards(ctx,3) ||
+		SSL_CTX_sess_get_cache_shards(ctx) != 5)
+		goto err;
+	if (SSL_CTX_sessions_shard(ctx,5) != NULL ||
+		SSL_CTX_sessions(ctx) != SSL_CTX_sessions_shard(ctx,0))
+		goto err;
+	ret=0;
+err:
+	SSL_CTX_free(ctx);
+	if (ret)
+		fprintf(stderr,"test_shards failed\n");
+	return ret;
+	}
+
+/* Every other session has expired, so the unexpired ones are mixed in
+ * with them in the lists of every shard. */
+static int test_flush(void)
+	{
+	SSL_CTX *ctx;
+	SSL_SESSION *key,*sess;
+	int ret=1;
+
+	if ((ctx=set_up(SSL_SESS_CACHE_SERVER)) == NULL)
+		return 1;
+	if (!add_sessions(ctx,0,TEST_SESSIONS))
+		goto err;
+	/* an unexpired session used last */
+	if ((key=make_session(0,1000)) == NULL)
+		goto err;
+	sess=ssl_sess_cache_get(ctx,key,1);
+	SSL_SESSION_free(key);
+	if (sess == NULL)
+		goto err;
+	SSL_SESSION_free(sess);
+
+	SSL_CTX_flush_sessions(ctx,(long)time(NULL));
+	if (cache_count(ctx) != TEST_SESSIONS/2 || removed != TEST_SESSIONS/2)
+		goto err;
+	SSL_CTX_flush_sessions(ctx,0);
+	if (cache_count(ctx) != 0 || removed != TEST_SESSIONS)
+		goto err;
+	ret=0;
+err:
+	SSL_CTX_free(ctx);
+	if (ret)
+		fprintf(stderr,"test_flush failed\n");
+	return ret;
+	}
+
+/* Sessions with timeouts of their own, given in an order other than that
+ * of expiry, are flushed as they expire; one whose timeout is raised in the
+ * cache is kept. */
+static int test_expiry_order(void)
+	{
+	SSL_CTX *ctx;
+	SSL_SESSION *sess,*longer=NULL;
+	long now=(long)time(NULL);
+	unsigned long n;
+	int ret=1;
+
+	if ((ctx=set_up(SSL_SESS_CACHE_SERVER)) == NULL)
+		return 1;
+	/* timeouts 100 to 100*TEST_SESSIONS, each once, in a mixed order */
+	for (n=0; n<TEST_SESSIONS; n++)
+		{
+		if ((sess=make_session(n,100*((n*7)%TEST_SESSIONS+1))) == NULL)
+			goto err;
+		SSL_SESSION_set_time(sess,now);
+		if (!SSL_CTX_add_session(ctx,sess))
+			goto err;
+		if (n == 0)
+			longer=sess;
+		else
+			SSL_SESSION_free(sess);
+		}
+	/* session 0 has timeout 100, make it outlive everything */
+	SSL_SESSION_set_timeout(longer,1000*TEST_SESSIONS);
+	for (n=1; n<=TEST_SESSIONS; n++)
+		{
+		SSL_CTX_flush_sessions(ctx,now+100*n+1);
+		/* all with timeouts up to 100*n but session 0 */
+		if (removed != (int)n-1 ||
+			cache_count(ctx) != TEST_SESSIONS-removed)
+			goto err;
+		}
+	if (cache_count(ctx) != 1 ||
+		ssl_sess_cache_get(ctx,longer,0) != longer)
+		goto err;
+	ret=0;
+err:
+	if (longer != NULL)
+		SSL_SESSION_free(longer);
+	SSL_CTX_free(ctx);
+	if (ret)
+		fprintf(stderr,"test_expiry_order failed\n");
+	return ret;
+	}
+
+/* The 255th accepted connection flushes the cache unless
+ * SSL_SESS_CACHE_NO_AUTO_CLEAR */
+static int auto_flush(long mode, int expect)
+	{
+	SSL_CTX *ctx;
+	SSL *s=NULL;
+	SSL_SESSION *sess;
+	int ret=1;
+
+	if ((ctx=set_up(mode)) == NULL)
+		return 1;
+	if (!add_sessions(ctx,0,TEST_SESSIONS))
+		goto err;
+	if ((s=SSL_new(ctx)) == NULL ||
+		(sess=make_session(TEST_SESSIONS,1000)) == NULL)
+		goto err;
+	SSL_set_session(s,sess);
+	SSL_SESSION_free(sess);
+	s->hit=0;
+	ctx->stats.sess_accept_good=0xff;
+	ssl_update_cache(s,SSL_SESS_CACHE_SERVER);
+	if (cache_count(ctx) != expect)
+		goto err;
+	ret=0;
+err:
+	if (s != NULL)
+		SSL_free(s);
+	SSL_CTX_free(ctx);
+	return ret;
+	}
+
+static int test_auto_flush(void)
+	{
+	int ret;
+
+	ret=auto_flush(SSL_SESS_CACHE_SERVER,TEST_SESSIONS/2+1) |
+		auto_flush(SSL_SESS_CACHE_SERVER|SSL_SESS_CACHE_NO_AUTO_CLEAR,
+			TEST_SESSIONS+1);
+	if (ret)
+		fprintf(stderr,"test_auto_flush failed\n");
+	return ret;
+	}
+
+static int test_cache_full(void)
+	{
+	SSL_CTX *ctx;
+	int n,ret=1;
+
+	if ((ctx=set_up(SSL_SESS_CACHE_SERVER)) == NULL)
+		return 1;
+	SSL_CTX_sess_set_cache_shards(ctx,4);
+	SSL_CTX_sess_set_cache_size(ctx,64);
+	if (!add_sessions(ctx,0,TEST_SESSIONS))
+		goto err;
+	/* every shard holds its share, 16 */
+	n=cache_count(ctx);
+	if (n <= 0 || n > 64 ||
+		SSL_CTX_sess_cache_full(ctx) != TEST_SESSIONS-n)
+		goto err;
+	ret=0;
+err:
+	SSL_CTX_free(ctx);
+	if (ret)
+		fprintf(stderr,"test_cache_full failed\n");
+	return ret;
+	}
+
+#ifdef SESS_TEST_PTHREADS
+static SSL_CTX *thread_ctx;
+
+static void *run_thread(void *arg)
+	{
+	unsigned long n,first=(unsigned long)arg*TEST_PER_THREAD;
+	SSL_SESSION *sess,*found;
+	long bad=0;
+
+	for (n=first; n<first+TEST_PER_THREAD; n++)
+		{
+		if ((sess=make_session(n,1000)) == NULL)
+			return (void *)1;
+		SSL_CTX_add_session(thread_ctx,sess);
+		found=ssl_sess_cache_get(thread_ctx,sess,1);
+		if (found != sess)
+			bad++;
+		if (found != NULL)
+			SSL_SESSION_free(found);
+		/* keep every other one */
+		if ((n & 1) && !SSL_CTX_remove_session(thread_ctx,sess))
+			bad++;
+		SSL_SESSION_free(sess);
+		}
+	return (void *)bad;
+	}
+
+static int test_threads(void)
+	{
+	pthread_t threads[TEST_THREADS];
+	void *bad;
+	long i;
+	int ret=1;
+
+	/* the shards get dynamic locks of their own */
+	if (!CRYPTO_thread_setup_pthreads(0))
+		return 1;
+	if ((thread_ctx=set_up(SSL_SESS_CACHE_SERVER)) == NULL)
+		goto done;
+	SSL_CTX_sess_set_cache_size(thread_ctx,0);
+	for (i=0; i<TEST_THREADS; i++)
+		pthread_create(&threads[i],NULL,run_thread,(void *)i);
+	ret=0;
+	for (i=0; i<TEST_THREADS; i++)
+		{
+		pthread_join(threads[i],&bad);
+		if (bad != NULL)
+			ret=1;
+		}
+	if (cache_count(thread_ctx) != TEST_THREADS*TEST_PER_THREAD/2)
+		ret=1;
+	SSL_CTX_free(thread_ctx);
+done:
+	CRYPTO_thread_cleanup_pthreads();
+	if (ret)
+		fprintf(stderr,"test_threads failed\n");
+	return ret;
+	}
+#endif
+
+int main(int argc, char *argv[])
+	{
+	int num_failed;
+
+	SSL_library_init();
+	SSL_load_error_strings();
+
+	num_failed = test_shards() +
+	    test_flush() +
+	    test_expiry_order() +
+	    test_auto_flush() +
+	    test_cache_full() +
+#ifdef SESS_TEST_PTHREADS
+	    test_threads() +
+#endif
+	    0;
+
+	ERR_print_errors_fp(stderr);
+
+	if (num_failed != 0)
+		{
+		printf("%d test%s failed\n", num_failed, num_failed != 1 ? "s" : "");
+		return EXIT_FAILURE;
+		}
+	printf("session cache ok\n");
+	return EXIT_SUCCESS;
+	}
@@ -62,6 +62,7 @@ void log_time(char *message, struct timeval *currTime, struct timeval *prevTime,
 
 void spp_init_slice(SPP_SLICE *slice) {
     slice->read_ciph = slice->read_mac = slice->write_mac = NULL;
+    slice->write_ciph = NULL;
     slice->read_mat_len = slice->other_read_mat_len = slice->write_mat_len = slice->other_write_mat_len = 0;
     slice->purpose = NULL;
     slice->read_access = slice->write_access = 0;
@@ -69,6 +70,8 @@ void spp_init_slice(SPP_SLICE *slice) {
     memset(&(slice->other_read_mat[0]), 0, sizeof(slice->other_read_mat));
     memset(&(slice->write_mat[0]), 0, sizeof(slice->write_mat));
     memset(&(slice->other_write_mat[0]), 0, sizeof(slice->other_write_mat));
+    memset(slice->stats, 0, sizeof(slice->stats));
+    memset(slice->stats_folded, 0, sizeof(slice->stats_folded));
 }
 
 void spp_init_proxy(SPP_PROXY *proxy) {
@@ -94,10 +97,12 @@ int spp_copy_mac_state(SSL *s, SPP_MAC *mac, int send) {
     if (send) {
         if (mac == NULL) {
             s->write_hash = NULL;
+            s->write_hmac = NULL;
             memset(s->s3->write_mac_secret, 0, EVP_MAX_MD_SIZE);
             memset(s->s3->write_sequence, 0, 8);
         } else {
             s->write_hash = mac->write_hash;
+            s->write_hmac = SPP_HMAC_KEY(&mac->write_hmac_key);
             memcpy(s->s3->write_mac_secret, mac->write_mac_secret, EVP_MAX_MD_SIZE);
             s->s3->write_mac_secret_size = mac->write_mac_secret_size;
             memcpy(s->s3->write_sequence, mac->write_sequence, 8);
@@ -105,10 +110,12 @@ int spp_copy_mac_state(SSL *s, SPP_MAC *mac, int send) {
     } else {
         if (mac == NULL) {
             s->read_hash = NULL;
+            s->read_hmac = NULL;
             memset(s->s3->read_mac_secret, 0, EVP_MAX_MD_SIZE);
             memset(s->s3->read_sequence, 0, 8);
         } else {
             s->read_hash = mac->read_hash;
+            s->read_hmac = SPP_HMAC_KEY(&mac->read_hmac_key);
             memcpy(s->s3->read_mac_secret, mac->read_mac_secret, EVP_MAX_MD_SIZE);
             s->s3->read_mac_secret_size = mac->read_mac_secret_size;
             memcpy(s->s3->read_sequence, mac->read_sequence, 8);
@@ -180,7 +187,9 @@ int spp_get_proxy_certificate(SSL *s, SPP_PROXY* proxy) {
     SESS_CERT *sc;
     EVP_PKEY *pkey=NULL;
     int need_cert = 1; /* VRS: 0=> will allow null cert if auth == KRB5 */
+    SPP_TIMER(pk_t);
 
+    s->spp_trace_proxy_id = proxy->proxy_id;
     n=s->method->ssl_get_message(s,
         SPP_ST_CR_PRXY_CERT_A,
         SPP_ST_CR_PRXY_CERT_B,
@@ -244,7 +253,9 @@ int spp_get_proxy_certificate(SSL *s, SPP_PROXY* proxy) {
         p=q;
     }
 
+    SPP_PK_START(pk_t);
     i=ssl_verify_cert_chain(s,sk);
+    SPP_PK_END(s, SPP_PK_CHAIN_VERIFY, proxy->proxy_id, pk_t);
     if ((s->verify_mode != SSL_VERIFY_NONE) && (i <= 0) ) {
         al=ssl_verify_alarm_type(s->verify_result);
         SSLerr(SSL_F_SSL3_GET_SERVER_CERTIFICATE,SSL_R_CERTIFICATE_VERIFY_FAILED);
@@ -344,9 +355,11 @@ int spp_get_proxy_key_exchange(SSL *s, SPP_PROXY* proxy)
 	int curve_nid = 0;
 	int encoded_pt_len = 0;
 #endif
+	SPP_TIMER(pk_t);
 
 	/* use same message size as in ssl3_get_certificate_request()
 	 * as ServerKeyExchange message may be skipped */
+	s->spp_trace_proxy_id = proxy->proxy_id;
 	n=s->method->ssl_get_message(s,
             SPP_ST_CR_PRXY_KEY_EXCH_A,
             SPP_ST_CR_PRXY_KEY_EXCH_B,
@@ -696,8 +709,10 @@ fprintf(stderr, "USING TLSv1.2 HASH %s\n", EVP_MD_name(md));
 				q+=size;
 				j+=size;
 				}
+			SPP_PK_START(pk_t);
 			i=RSA_verify(NID_md5_sha1, md_buf, j, p, n,
 								pkey->pkey.rsa);
+			SPP_PK_END(s, SPP_PK_RSA_VERIFY, proxy->proxy_id, pk_t);
 			if (i < 0)
 				{
 				al=SSL_AD_DECRYPT_ERROR;
@@ -719,6 +734,7 @@ fprintf(stderr, "USING TLSv1.2 HASH %s\n", EVP_MD_name(md));
 			EVP_VerifyUpdate(&md_ctx,&(s->s3->client_random[0]),SSL3_RANDOM_SIZE);
 			EVP_VerifyUpdate(&md_ctx,&(s->s3->server_random[0]),SSL3_RANDOM_SIZE);
 			EVP_VerifyUpdate(&md_ctx,param,param_len);
+			SPP_PK_START(pk_t);
 			if (EVP_VerifyFinal(&md_ctx,p,(int)n,pkey) <= 0)
 				{
 				/* bad signature */
@@ -726,6 +742,7 @@ fprintf(stderr, "USING TLSv1.2 HASH %s\n", EVP_MD_name(md));
 				SSLerr(SSL_F_SSL3_GET_KEY_EXCHANGE,SSL_R_BAD_SIGNATURE);
 				goto f_err;
 				}
+			SPP_PK_END(s, spp_pk_sign_op(pkey, 1), proxy->proxy_id, pk_t);
 			}
 		}
 	else
@@ -772,6 +789,7 @@ int spp_get_proxy_done(SSL *s, SPP_PROXY* proxy) {
     int ok,ret=0;
     long n;
 
+    s->spp_trace_proxy_id = proxy->proxy_id;
     n=s->method->ssl_get_message(s,
         SPP_ST_CR_PRXY_DONE_A,
         SPP_ST_CR_PRXY_DONE_B,
@@ -836,6 +854,7 @@ int spp_send_proxy_key_material(SSL *s, SPP_PROXY* proxy) {
     It is dangerous right now and we risk overflowing later on...
     */
     char temp_buff[21848] = {0};
+    SPP_TIMER(pk_t);
     
     if (s->state == SPP_ST_CW_PRXY_MAT_A) {
 
@@ -893,6 +912,7 @@ int spp_send_proxy_key_material(SSL *s, SPP_PROXY* proxy) {
         memset(envelope_iv, 0, sizeof envelope_iv);  /* per RFC 1510 */
 
         /* seal the envelope */
+        SPP_PK_START(pk_t);
         encrypted_key_mat_len = envelope_seal(
             pub_keys,
             temp_buff,
@@ -903,6 +923,7 @@ int spp_send_proxy_key_material(SSL *s, SPP_PROXY* proxy) {
             encrypted_key_mat,
             &shared_secret,
             &shared_secret_len);
+        SPP_PK_END(s, SPP_PK_RSA_ENCRYPT, proxy->proxy_id, pk_t);
 
         /* store the shared secret */
         //memcpy(s->proxy_key_mat_shared_secret, shared_secret, sizeof(shared_secret));
@@ -1019,6 +1040,7 @@ int spp_send_end_key_material_client(SSL *s) {
     It is dangerous right now and we risk overflowing later on...
     */
     char temp_buff[21848] = {0};
+    SPP_TIMER(pk_t);
 
     
     if (s->state == SPP_ST_CW_PRXY_MAT_A) {
@@ -1046,6 +1068,7 @@ int spp_send_end_key_material_client(SSL *s) {
         memset(envelope_iv, 0, sizeof envelope_iv);  /* per RFC 1510 */
 
         /* seal the envelope */
+        SPP_PK_START(pk_t);
         encrypted_key_mat_len = envelope_seal(
             pub_keys,
             temp_buff,
@@ -1056,6 +1079,7 @@ int spp_send_end_key_material_client(SSL *s) {
             encrypted_key_mat,
             &s->proxy_key_mat_shared_secret,
             &s->proxy_key_mat_shared_secret_len);
+        SPP_PK_END(s, SPP_PK_RSA_ENCRYPT, 0, pk_t);
 
         /* store the shared secret */ // Already stored
         //memcpy(s->proxy_key_mat_shared_secret, shared_secret, sizeof(shared_secret));
@@ -1383,6 +1407,7 @@ int spp_get_end_key_material_server(SSL *s) {
     unsigned char *encrypted_key_mat;//[2048]; /* HACK size... */
     int ok,id;
     long n;
+    SPP_TIMER(pk_t);
 
     n=s->method->ssl_get_message(s,
         SPP_ST_CR_PRXY_MAT_A,
@@ -1450,6 +1475,7 @@ int spp_get_end_key_material_server(SSL *s) {
     printf("opening envelope!\n");
 	#endif 
 
+    SPP_PK_START(pk_t);
     key_mat_len = envelope_open(
         private_key,
         encrypted_key_mat,
@@ -1460,6 +1486,7 @@ int spp_get_end_key_material_server(SSL *s) {
         key_mat,
         &s->proxy_key_mat_shared_secret,
         &s->proxy_key_mat_shared_secret_len);
+    SPP_PK_END(s, SPP_PK_RSA_DECRYPT, 0, pk_t);
 
     // printf("key mat len: %d\n", key_mat_len);
     // spp_print_buffer(key_mat, key_mat_len);
@@ -0,0 +1,588 @@
+#include <stdio.h>
+#include <string.h>
+#include "ssl_locl.h"
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+
+/* Datagram transport for SPP application data.
+ *
+ * Latency sensitive flows (voice, video) cannot afford head-of-line blocking
+ * on a TCP connection through a chain of middleboxes. Once the SPP handshake
+ * has completed, application records can therefore also be sent as
+ * datagrams, one record per datagram, on a BIO given to SPP_set_dgram_bio().
+ * The handshake itself stays on the stream connections: every hop has its
+ * own transport connection, so lost handshake messages are retransmitted
+ * between neighbours only and never end to end.
+ *
+ * A datagram record carries the epoch and sequence number explicitly, like
+ * DTLS, followed by the slice id:
+ *
+ *   type(1) version(2) epoch(2) sequence(6) slice_id(1) length(2)
+ *
+ * The payload is protected exactly like a stream record (explicit IV, data,
+ * read MAC, write MAC, integrity MAC, CBC padding), except that the MACs
+ * cover the explicit epoch and sequence number instead of an implicit
+ * counter, so records may be lost or reordered. Only the endpoints assign
+ * sequence numbers. Proxies forward every datagram on its own, without
+ * reassembly, and keep its sequence number so the MACs they cannot
+ * regenerate stay valid. Records that fail the read or write MAC are
+ * silently dropped, replays are caught with a sliding window as in DTLS.
+ * As on the stream, a failed integrity MAC at an endpoint is only counted
+ * (it also fails when a proxy with write access changed the data).
+ *
+ * Only CBC cipher suites are supported: every record starts with an
+ * explicit IV, so the cipher contexts shared with the stream records carry
+ * no state from one record to the next. */
+
+#define SPP_DGRAM_EPOCH 1
+
+SPP_DGRAM *spp_dgram_new(void) {
+    SPP_DGRAM *d;
+
+    if ((d = OPENSSL_malloc(sizeof(SPP_DGRAM))) == NULL)
+        return NULL;
+    memset(d, 0, sizeof(SPP_DGRAM));
+    if ((d->buf = OPENSSL_malloc(SPP_DGRAM_MAX_PACKET_SIZE)) == NULL) {
+        OPENSSL_free(d);
+        return NULL;
+    }
+    d->w_epoch = d->r_epoch = SPP_DGRAM_EPOCH;
+    return d;
+}
+
+static void spp_dgram_ctx_free(SPP_CTX *ctx) {
+    if (ctx == NULL)
+        return;
+    if (ctx->read_mac != NULL)
+        OPENSSL_free(ctx->read_mac);
+    OPENSSL_free(ctx);
+}
+
+void spp_dgram_free(SPP_DGRAM *d) {
+    if (d == NULL)
+        return;
+    spp_dgram_ctx_free(d->pend_ctx);
+    if (d->bio != NULL)
+        BIO_free_all(d->bio);
+    OPENSSL_free(d->buf);
+    OPENSSL_free(d);
+}
+
+/* Same as in d1_pkt.c: v1 - v2 for two 64-bit big-endian numbers, saturated
+ * to +-128. */
+static int spp_satsub64be(const unsigned char *v1, const unsigned char *v2) {
+    int ret, sat, brw, i;
+
+    ret = (int)v1[7]-(int)v2[7];
+    sat = 0;
+    brw = ret>>8;
+    if (ret & 0x80) {
+        for (i = 6; i >= 0; i--) {
+            brw += (int)v1[i]-(int)v2[i];
+            sat |= ~brw;
+            brw >>= 8;
+        }
+    } else {
+        for (i = 6; i >= 0; i--) {
+            brw += (int)v1[i]-(int)v2[i];
+            sat |= brw;
+            brw >>= 8;
+        }
+    }
+    brw <<= 8;
+
+    if (sat & 0xff)
+        return brw | 0x80;
+    return brw + (ret & 0xff);
+}
+
+static int spp_dgram_replay_check(DTLS1_BITMAP *bitmap, const unsigned char *seq) {
+    int cmp;
+    unsigned int shift;
+
+    cmp = spp_satsub64be(seq, bitmap->max_seq_num);
+    if (cmp > 0)
+        return 1;
+    shift = -cmp;
+    if (shift >= sizeof(bitmap->map)*8)
+        return 0;
+    return (bitmap->map & (1UL<<shift)) == 0;
+}
+
+static void spp_dgram_bitmap_update(DTLS1_BITMAP *bitmap, const unsigned char *seq) {
+    int cmp;
+    unsigned int shift;
+
+    cmp = spp_satsub64be(seq, bitmap->max_seq_num);
+    if (cmp > 0) {
+        shift = cmp;
+        if (shift < sizeof(bitmap->map)*8)
+            bitmap->map = (bitmap->map << shift) | 1UL;
+        else
+            bitmap->map = 1UL;
+        memcpy(bitmap->max_seq_num, seq, 8);
+    } else {
+        shift = -cmp;
+        if (shift < sizeof(bitmap->map)*8)
+            bitmap->map |= 1UL<<shift;
+    }
+}
+
+/* The 13 byte MAC header of a record: epoch and sequence number, type,
+ * version and the length of the data. */
+static void spp_dgram_mac_header(SSL *s, unsigned char *header,
+                                 const unsigned char *seq, int type, unsigned int len) {
+    memcpy(header, seq, 8);
+    header[8] = type;
+    header[9] = (unsigned char)(s->version>>8);
+    header[10] = (unsigned char)(s->version);
+    header[11] = (unsigned char)(len>>8);
+    header[12] = (unsigned char)(len);
+}
+
+/* MAC a record under |key| if the MAC has a precomputed key, else by way
+ * of a copy of |hash|. */
+static int spp_dgram_mac(EVP_MD_CTX *hash, const HMAC_PRECOMP *key,
+                         const unsigned char *header, const unsigned char *data,
+                         unsigned int len, unsigned char *md) {
+    EVP_MD_CTX hmac;
+    HMAC_PRECOMP_CTX hctx;
+    size_t md_size;
+    int ret;
+
+    if (key != NULL) {
+        HMAC_precomp_Init(&hctx, key);
+        HMAC_precomp_Update(&hctx, header, 13);
+        HMAC_precomp_Update(&hctx, data, len);
+        HMAC_precomp_Final(&hctx, md);
+        return key->md_size;
+    }
+    if (!EVP_MD_CTX_copy(&hmac, hash))
+        return -1;
+    EVP_DigestSignUpdate(&hmac, header, 13);
+    EVP_DigestSignUpdate(&hmac, data, len);
+    ret = EVP_DigestSignFinal(&hmac, md, &md_size);
+    EVP_MD_CTX_cleanup(&hmac);
+    return ret > 0 ? (int)md_size : -1;
+}
+
+/* Check one of the MACs of a decrypted record in constant time. rec->length
+ * is the length of the data, orig_len the length of data, MAC and padding. */
+static int spp_dgram_check_mac(SPP_MAC *mac, const unsigned char *header,
+                               SSL3_RECORD *rec, unsigned int orig_len,
+                               const unsigned char *expected, int mac_size) {
+    unsigned char md[EVP_MAX_MD_SIZE];
+    size_t md_size = mac_size;
+
+    if (mac == NULL || mac->read_hash == NULL || EVP_MD_CTX_md(mac->read_hash) == NULL)
+        return 0;
+    if (ssl3_cbc_record_digest_supported(mac->read_hash)) {
+        ssl3_cbc_digest_record(mac->read_hash, md, &md_size, header,
+            rec->data, rec->length + mac_size, orig_len,
+            mac->read_mac_secret, mac->read_mac_secret_size, 0);
+    } else if (spp_dgram_mac(mac->read_hash, SPP_HMAC_KEY(&mac->read_hmac_key),
+                             header, rec->data, rec->length, md) < 0) {
+        return 0;
+    }
+    return CRYPTO_memcmp(md, expected, mac_size) == 0;
+}
+
+/* Build the datagram record for len bytes of buf in d->buf and return its
+ * length. ctx is the state of the record being forwarded (NULL when we
+ * originate the record) and supplies the sequence number and the MACs we
+ * cannot compute ourselves. */
+static int spp_dgram_seal(SSL *s, SPP_DGRAM *d, SPP_SLICE *slice,
+                          const unsigned char *seq, const unsigned char *buf,
+                          unsigned int len, SPP_CTX *ctx) {
+    EVP_CIPHER_CTX *enc = slice->read_ciph == NULL ? NULL : slice->read_ciph->enc_write_ctx;
+    unsigned char *p = d->buf, *data;
+    unsigned char header[13];
+    unsigned int bs, padl, tot, i;
+    int mac_size;
+
+    *(p++) = SSL3_RT_APPLICATION_DATA;
+    *(p++) = s->version>>8;
+    *(p++) = s->version&0xff;
+    memcpy(p, seq, 8);
+    p += 8;
+    *(p++) = slice->slice_id;
+
+    /* No key for this slice: pass the record on as it came in. */
+    if (enc == NULL) {
+        if (ctx == NULL || ctx->mac_length != 0 || len > SPP_RT_MAX_ENCRYPTED_LENGTH)
+            return -1;
+        s2n(len, p);
+        memcpy(p, buf, len);
+        s->write_stats.bytes += SPP_DGRAM_HEADER_LENGTH + len;
+        spp_stats_record(s, slice, SPP_STATS_WRITE, SPP_DGRAM_HEADER_LENGTH + len,
+                         len, 0, 1);
+        if (SPP_TRACE_FLAGS(s) & SPP_TRACE_RECORDS)
+            spp_trace_record(s, 1, SSL3_RT_APPLICATION_DATA, slice, len,
+                             SPP_DGRAM_HEADER_LENGTH + len, 0, 1);
+        return SPP_DGRAM_HEADER_LENGTH + len;
+    }
+
+    if (EVP_CIPHER_CTX_mode(enc) != EVP_CIPH_CBC_MODE) {
+        SSLerr(SSL_F_SPP_DGRAM_WRITE, SPP_R_UNSUPPORTED_DGRAM_CIPHER);
+        return -1;
+    }
+    if (len > SSL3_RT_MAX_PLAIN_LENGTH) {
+        SSLerr(SSL_F_SPP_DGRAM_WRITE, SSL_R_DATA_LENGTH_TOO_LONG);
+        return -1;
+    }
+    bs = EVP_CIPHER_CTX_block_size(enc);
+    mac_size = EVP_MD_CTX_size(slice->read_mac->write_hash);
+    if (mac_size < 0 || (ctx != NULL && ctx->mac_length != (size_t)mac_size))
+        return -1;
+
+    data = p + 2 + bs;
+    if (RAND_bytes(p + 2, bs) <= 0)
+        return -1;
+    memcpy(data, buf, len);
+    spp_dgram_mac_header(s, header, seq, SSL3_RT_APPLICATION_DATA, len);
+
+    /* Read MAC: we hold the slice key, so always ours. */
+    if (spp_dgram_mac(slice->read_mac->write_hash,
+                      SPP_HMAC_KEY(&slice->read_mac->write_hmac_key),
+                      header, data, len, data + len) < 0)
+        return -1;
+    /* Write MAC: ours if we may write the slice, else the original one. */
+    if (slice->write_mac != NULL) {
+        if (spp_dgram_mac(slice->write_mac->write_hash,
+                          SPP_HMAC_KEY(&slice->write_mac->write_hmac_key),
+                          header, data, len, data + len + mac_size) < 0)
+            return -1;
+    } else if (ctx != NULL) {
+        memcpy(data + len + mac_size, ctx->write_mac, mac_size);
+    } else {
+        return -1;
+    }
+    /* Integrity MAC: only the endpoints can compute it. */
+    if (s->def_ctx->read_access) {
+        if (spp_dgram_mac(s->def_ctx->read_mac->write_hash,
+                          SPP_HMAC_KEY(&s->def_ctx->read_mac->write_hmac_key),
+                          header, data, len, data + len + 2*mac_size) < 0)
+            return -1;
+    } else if (ctx != NULL) {
+        memcpy(data + len + 2*mac_size, ctx->integrity_mac, mac_size);
+    } else {
+        return -1;
+    }
+
+    tot = len + 3*mac_size + 1;
+    padl = (bs - tot % bs) % bs;
+    for (i = 0; i <= padl; i++)
+        data[len + 3*mac_size + i] = padl;
+    tot += padl + bs;
+
+    if (EVP_Cipher(enc, p + 2, p + 2, tot) < 1)
+        return -1;
+    s2n(tot, p);
+
+    s->write_stats.app_bytes += len;
+    s->write_stats.mac_bytes += mac_size*3;
+    s->write_stats.header_bytes += SPP_DGRAM_HEADER_LENGTH;
+    s->write_stats.bytes += SPP_DGRAM_HEADER_LENGTH + tot;
+    spp_stats_record(s, slice, SPP_STATS_WRITE, SPP_DGRAM_HEADER_LENGTH + tot,
+                     len, mac_size*3, 0);
+    if (SPP_TRACE_FLAGS(s) & SPP_TRACE_RECORDS)
+        spp_trace_record(s, 1, SSL3_RT_APPLICATION_DATA, slice, len,
+                         SPP_DGRAM_HEADER_LENGTH + tot, SPP_TRACE_MAC_READ |
+                         (slice->write_mac != NULL ? SPP_TRACE_MAC_WRITE : 0) |
+                         (s->def_ctx->read_access ? SPP_TRACE_MAC_INTEGRITY : 0), 0);
+    return SPP_DGRAM_HEADER_LENGTH + tot;
+}
+
+static int spp_dgram_send(SSL *s, SPP_DGRAM *d, int len) {
+    int i;
+
+    s->rwstate = SSL_WRITING;
+    i = BIO_write(d->bio, d->buf, len);
+    if (i != len) {
+        if (i <= 0 && BIO_should_retry(d->bio))
+            return -1;
+        /* A datagram is sent whole or not at all. */
+        s->rwstate = SSL_NOTHING;
+        return -1;
+    }
+    s->rwstate = SSL_NOTHING;
+    return len;
+}
+
+/* Open the record of n bytes in d->buf. Returns the length of the data
+ * (left at *data), 0 if the record has to be dropped. */
+static int spp_dgram_open(SSL *s, SPP_DGRAM *d, int n, SPP_SLICE **slice_out,
+                          unsigned char **data, SPP_CTX **ctx_out) {
+    unsigned char *p = d->buf, *seq;
+    unsigned char header[13];
+    unsigned char macs[EVP_MAX_MD_SIZE*3];
+    unsigned int len, epoch, bs, orig_len;
+    int type, version, mac_size, good, trace;
+    EVP_CIPHER_CTX *enc;
+    SPP_SLICE *slice;
+    SPP_CTX *ctx;
+    SSL3_RECORD rec;
+
+    if (n < SPP_DGRAM_HEADER_LENGTH)
+        return 0;
+    type = *(p++);
+    n2s(p, version);
+    seq = p;
+    n2s(p, epoch);
+    p += 6;
+    slice = SPP_get_slice_by_id(s, *(p++));
+    n2s(p, len);
+
+    if (type != SSL3_RT_APPLICATION_DATA || version != s->version ||
+        epoch != d->r_epoch || slice == NULL ||
+        len != (unsigned int)(n - SPP_DGRAM_HEADER_LENGTH) ||
+        len > SPP_RT_MAX_ENCRYPTED_LENGTH)
+        return 0;
+
+    enc = slice->read_ciph == NULL ? NULL : slice->read_ciph->enc_read_ctx;
+    if (enc == NULL) {
+        /* Only proxies handle records they cannot read. There is nothing
+         * to check: hand them out as they are, for forwarding. */
+        if (!s->proxy)
+            return 0;
+        if ((ctx = OPENSSL_malloc(sizeof(SPP_CTX))) == NULL)
+            return -1;
+        ctx->mac_length = 0;
+        ctx->integrity_mac = ctx->read_mac = ctx->write_mac = NULL;
+        memcpy(ctx->seq_num, seq, 8);
+        *slice_out = slice;
+        *data = p;
+        *ctx_out = ctx;
+        s->read_stats.bytes += n;
+        spp_stats_record(s, slice, SPP_STATS_READ, n, len, 0, 1);
+        if (SPP_TRACE_FLAGS(s) & SPP_TRACE_RECORDS)
+            spp_trace_record(s, 0, type, slice, len, n, 0, 1);
+        return len;
+    }
+
+    if (EVP_CIPHER_CTX_mode(enc) != EVP_CIPH_CBC_MODE)
+        return 0;
+    if (!spp_dgram_replay_check(&d->bitmap, seq))
+        return 0;
+    bs = EVP_CIPHER_CTX_block_size(enc);
+    mac_size = EVP_MD_CTX_size(slice->read_mac->read_hash);
+    if (mac_size < 0 || len % bs != 0 || len < bs + 3*mac_size + 1)
+        return 0;
+    if (EVP_Cipher(enc, p, p, len) < 1) {
+        spp_stats_failure(s, slice, 0);
+        return 0;
+    }
+
+    memset(&rec, 0, sizeof(rec));
+    rec.type = type;
+    rec.input = rec.data = p;
+    rec.length = len;
+    /* tls1_cbc_remove_padding() looks at the cipher in s->enc_read_ctx */
+    s->enc_read_ctx = enc;
+    good = tls1_cbc_remove_padding(s, &rec, bs, 3*mac_size);
+    if (good == 0) {
+        spp_stats_failure(s, slice, 0);
+        return 0;
+    }
+    orig_len = rec.length + ((unsigned int)rec.type>>8);
+    rec.type &= 0xff;
+    spp_cbc_copy_mac(macs, &rec, 3*mac_size, orig_len);
+    rec.length -= 3*mac_size;
+    spp_dgram_mac_header(s, header, seq, type, rec.length);
+
+    /* The read MAC proves the data comes from someone holding the slice
+     * key, the write MAC that it was written by someone allowed to. Both
+     * are checked whatever the padding looked like. */
+    orig_len -= 2*mac_size;
+    if (!spp_dgram_check_mac(slice->read_mac, header, &rec, orig_len,
+                             macs, mac_size))
+        good = -1;
+    if (slice->write_mac != NULL &&
+        !spp_dgram_check_mac(slice->write_mac, header, &rec, orig_len,
+                             macs + mac_size, mac_size))
+        good = -1;
+    trace = SPP_TRACE_MAC_READ |
+        (slice->write_mac != NULL ? SPP_TRACE_MAC_WRITE : 0);
+    if (good < 0) {
+        spp_stats_failure(s, slice, 1);
+        if (SPP_TRACE_FLAGS(s) & SPP_TRACE_RECORDS)
+            spp_trace_record(s, 0, type, slice, rec.length, n,
+                             trace | SPP_TRACE_MAC_READ_FAILED, 0);
+        return 0;
+    }
+    /* The endpoints also hold the integrity key: any change made on the
+     * way shows, legitimate or not. */
+    if (!s->proxy && s->def_ctx->read_access &&
+        s->def_ctx->read_mac != NULL &&
+        EVP_MD_CTX_md(s->def_ctx->read_mac->read_hash) != NULL) {
+        trace |= SPP_TRACE_MAC_INTEGRITY;
+        if (!spp_dgram_check_mac(s->def_ctx->read_mac, header, &rec, orig_len,
+                                 macs + 2*mac_size, mac_size)) {
+            spp_stats_failure(s, slice, 1);
+            trace |= SPP_TRACE_MAC_INTEGRITY_FAILED;
+        }
+    }
+
+    spp_dgram_bitmap_update(&d->bitmap, seq);
+    if (s->proxy) {
+        if ((ctx = OPENSSL_malloc(sizeof(SPP_CTX))) == NULL)
+            return -1;
+        if ((ctx->read_mac = OPENSSL_malloc(3*mac_size)) == NULL) {
+            OPENSSL_free(ctx);
+            return -1;
+        }
+        memcpy(ctx->read_mac, macs, 3*mac_size);
+        ctx->mac_length = mac_size;
+        ctx->write_mac = &(ctx->read_mac[mac_size]);
+        ctx->integrity_mac = &(ctx->read_mac[2*mac_size]);
+        memcpy(ctx->seq_num, seq, 8);
+        *ctx_out = ctx;
+    }
+
+    s->read_stats.bytes += n;
+    s->read_stats.app_bytes += rec.length;
+    s->read_stats.mac_bytes += 3*mac_size;
+    s->read_stats.header_bytes += SPP_DGRAM_HEADER_LENGTH;
+    spp_stats_record(s, slice, SPP_STATS_READ, n, rec.length, 3*mac_size, 0);
+    if (SPP_TRACE_FLAGS(s) & SPP_TRACE_RECORDS)
+        spp_trace_record(s, 0, type, slice, rec.length, n, trace, 0);
+    *slice_out = slice;
+    *data = rec.data;
+    return rec.length;
+}
+
+/* Send application data over datagrams from now on (or in addition to the
+ * stream). The SSL takes ownership of bio. Only valid once the handshake is
+ * complete, on endpoints and proxies alike. */
+int SPP_set_dgram_bio(SSL *s, BIO *bio) {
+    if (s->version != SPP_VERSION || !SSL_is_init_finished(s)) {
+        SSLerr(SSL_F_SPP_SET_DGRAM_BIO, SSL_R_UNINITIALIZED);
+        return 0;
+    }
+    if (s->spp_dgram == NULL && (s->spp_dgram = spp_dgram_new()) == NULL) {
+        SSLerr(SSL_F_SPP_SET_DGRAM_BIO, ERR_R_MALLOC_FAILURE);
+        return 0;
+    }
+    if (s->spp_dgram->bio != NULL && s->spp_dgram->bio != bio)
+        BIO_free_all(s->spp_dgram->bio);
+    s->spp_dgram->bio = bio;
+    return 1;
+}
+
+/* Send num bytes as one datagram record of slice. Endpoints only: proxies
+ * pass on what they received with SPP_dgram_forward(). */
+int SPP_dgram_write(SSL *s, const void *buf, int num, SPP_SLICE *slice) {
+    SPP_DGRAM *d = s->spp_dgram;
+    unsigned char *seq;
+    int i;
+
+    if (d == NULL || d->bio == NULL) {
+        SSLerr(SSL_F_SPP_DGRAM_WRITE, SPP_R_DGRAM_BIO_NOT_SET);
+        return -1;
+    }
+    if (s->proxy || slice == NULL ||
+        (slice = SPP_get_slice_by_id(s, slice->slice_id)) == NULL) {
+        SSLerr(SSL_F_SPP_DGRAM_WRITE, SPP_R_MISSING_SLICE);
+        return -1;
+    }
+    if (num < 0) {
+        SSLerr(SSL_F_SPP_DGRAM_WRITE, SSL_R_BAD_LENGTH);
+        return -1;
+    }
+
+    /* Next sequence number; the epoch has to change before it wraps. */
+    seq = &(d->w_seq[2]);
+    for (i = 5; i >= 0; i--) {
+        if (++seq[i] != 0)
+            break;
+    }
+    if (i < 0) {
+        SSLerr(SSL_F_SPP_DGRAM_WRITE, SPP_R_DGRAM_SEQUENCE_EXHAUSTED);
+        return -1;
+    }
+    d->w_seq[0] = (unsigned char)(d->w_epoch>>8);
+    d->w_seq[1] = (unsigned char)(d->w_epoch);
+
+    if ((i = spp_dgram_seal(s, d, slice, d->w_seq, buf, num, NULL)) < 0)
+        return -1;
+    if (spp_dgram_send(s, d, i) < 0)
+        return -1;
+    return num;
+}
+
+/* Read the next valid datagram record. Records that fail to authenticate,
+ * replays and records for unknown slices are skipped. On proxies *ctx
+ * receives the state needed to forward the record with SPP_dgram_forward(),
+ * which also frees it; endpoints get NULL.
+ *
+ * A record is never returned in part, a proxy could not forward it. If it
+ * does not fit in num bytes this fails with SPP_R_DGRAM_BUFFER_TOO_SMALL
+ * and keeps the record for the next call. */
+int SPP_dgram_read(SSL *s, void *buf, int num, SPP_SLICE **slice, SPP_CTX **ctx) {
+    SPP_DGRAM *d = s->spp_dgram;
+    int n;
+
+    *slice = NULL;
+    *ctx = NULL;
+    if (d == NULL || d->bio == NULL) {
+        SSLerr(SSL_F_SPP_DGRAM_READ, SPP_R_DGRAM_BIO_NOT_SET);
+        return -1;
+    }
+    while (d->pend_slice == NULL) {
+        s->rwstate = SSL_READING;
+        n = BIO_read(d->bio, d->buf, SPP_DGRAM_MAX_PACKET_SIZE);
+        if (n <= 0) {
+            if (!BIO_should_retry(d->bio))
+                s->rwstate = SSL_NOTHING;
+            return n;
+        }
+        s->rwstate = SSL_NOTHING;
+        d->pend_len = spp_dgram_open(s, d, n, &d->pend_slice, &d->pend_data,
+                                     &d->pend_ctx);
+        if (d->pend_len < 0) {
+            d->pend_slice = NULL;
+            return -1;
+        }
+    }
+    if (d->pend_len > num) {
+        SSLerr(SSL_F_SPP_DGRAM_READ, SPP_R_DGRAM_BUFFER_TOO_SMALL);
+        return -1;
+    }
+    memcpy(buf, d->pend_data, d->pend_len);
+    *slice = d->pend_slice;
+    *ctx = d->pend_ctx;
+    d->pend_slice = NULL;
+    d->pend_ctx = NULL;
+    return d->pend_len;
+}
+
+/* Forward a record read with SPP_dgram_read() on the other side of a proxy,
+ * keeping its sequence number. If the proxy holds the slice key the data
+ * (possibly modified) is sealed again, with the write and integrity MACs
+ * taken from ctx where the proxy cannot compute them. Frees ctx. */
+int SPP_dgram_forward(SSL *s, const void *buf, int num, SPP_SLICE *slice, SPP_CTX *ctx) {
+    SPP_DGRAM *d = s->spp_dgram;
+    int ret = -1, i;
+
+    if (d == NULL || d->bio == NULL) {
+        SSLerr(SSL_F_SPP_DGRAM_FORWARD, SPP_R_DGRAM_BIO_NOT_SET);
+        goto end;
+    }
+    if (ctx == NULL || slice == NULL ||
+        (slice = SPP_get_slice_by_id(s, slice->slice_id)) == NULL) {
+        SSLerr(SSL_F_SPP_DGRAM_FORWARD, SPP_R_MISSING_SLICE);
+        goto end;
+    }
+    if (num < 0) {
+        SSLerr(SSL_F_SPP_DGRAM_FORWARD, SSL_R_BAD_LENGTH);
+        goto end;
+    }
+    if ((i = spp_dgram_seal(s, d, slice, ctx->seq_num, buf, num, ctx)) < 0)
+        goto end;
+    if (spp_dgram_send(s, d, i) < 0)
+        goto end;
+    ret = num;
+end:
+    spp_dgram_ctx_free(ctx);
+    return ret;
+}
@@ -46,6 +46,188 @@ int spp_enc(SSL *s, int send) {
     return tls1_enc(s, send);
 }
 
+/* Records of an AEAD (AES-GCM, ChaCha20-Poly1305) cipher suite on a slice
+ * look like
+ *
+ *   header | nonce | ciphertext | reader tag | writer tag | integrity tag
+ *
+ * The 8 byte explicit nonce, prefixed with four zero bytes, is the AEAD
+ * nonce of all three tags. The reader tag is the AEAD tag of the record
+ * under the slice read key, which also encrypts it. The writer and integrity
+ * tags authenticate the header fields and the ciphertext under the slice
+ * write key and the endpoint key respectively, with nothing encrypted, so
+ * all of them can be checked before anything is decrypted. The sequence
+ * numbers of the slice MACs never advance, hence the explicit nonce. The
+ * handshake and def_ctx records use the plain TLS construction. */
+#define SPP_AEAD_AAD_LEN 6
+
+int spp_aead_slice(SSL *s, SPP_SLICE *slice) {
+    return slice != NULL && slice != s->def_ctx &&
+        s->s3->tmp.new_cipher != NULL &&
+        (s->s3->tmp.new_cipher->algorithm_mac & SSL_AEAD);
+}
+
+static void spp_aead_aad(unsigned char *aad, SSL *s, int type, int slice_id,
+                         unsigned int len) {
+    *(aad++) = type&0xff;
+    *(aad++) = s->version>>8;
+    *(aad++) = s->version&0xff;
+    *(aad++) = slice_id;
+    s2n(len, aad);
+}
+
+/* Runs the AEAD in |ctx| under |nonce| over |aad| and the |len| bytes at
+ * |in|, which are en- or decrypted to |out|, or only authenticated if |out|
+ * is NULL. A sealing context writes its tag to |tag|, an opening one checks
+ * |tag|. Returns 1 on success, 0 on error or if the tag does not match. */
+static int spp_aead_run(EVP_CIPHER_CTX *ctx, const unsigned char *nonce,
+                        const unsigned char *aad, unsigned char *out,
+                        const unsigned char *in, unsigned int len,
+                        unsigned char *tag) {
+    unsigned char iv[12];
+
+    memset(iv, 0, sizeof(iv) - SPP_AEAD_NONCE_LEN);
+    memcpy(&iv[sizeof(iv) - SPP_AEAD_NONCE_LEN], nonce, SPP_AEAD_NONCE_LEN);
+    if (!EVP_CipherInit_ex(ctx, NULL, NULL, NULL, iv, -1))
+        return 0;
+    if (!ctx->encrypt &&
+        EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_AEAD_SET_TAG, SPP_AEAD_TAG_LEN, tag) <= 0)
+        return 0;
+    if (EVP_Cipher(ctx, NULL, aad, SPP_AEAD_AAD_LEN) < 0)
+        return 0;
+    if (len > 0 && EVP_Cipher(ctx, out, in, len) < 0)
+        return 0;
+    if (EVP_Cipher(ctx, NULL, NULL, 0) < 0)
+        return 0;
+    if (ctx->encrypt &&
+        EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_AEAD_GET_TAG, SPP_AEAD_TAG_LEN, tag) <= 0)
+        return 0;
+    return 1;
+}
+
+static int spp_aead_next_nonce(SSL *s, unsigned char *nonce) {
+    int i;
+
+    if (!s->spp_aead_nonce_set) {
+        if (RAND_bytes(s->spp_aead_nonce, SPP_AEAD_NONCE_LEN) <= 0)
+            return 0;
+        s->spp_aead_nonce_set = 1;
+    }
+    memcpy(nonce, s->spp_aead_nonce, SPP_AEAD_NONCE_LEN);
+    for (i = SPP_AEAD_NONCE_LEN - 1; i >= 0; i--) {
+        if (++s->spp_aead_nonce[i] != 0)
+            break;
+    }
+    return 1;
+}
+
+/* Seals a slice record in place. |rec| holds room for the nonce, then the
+ * |len| bytes of plaintext and room for the three tags. A record forwarded
+ * unmodified keeps its nonce, and the tags we have no key for are taken
+ * over from |ctx|. Returns 1 on success, -1 on error. */
+int spp_aead_seal(SSL *s, SPP_SLICE *slice, int type, unsigned char *rec,
+                  unsigned int len, SPP_CTX *ctx, int *macs) {
+    unsigned char aad[SPP_AEAD_AAD_LEN];
+    unsigned char *nonce = rec;
+    unsigned char *data = rec + SPP_AEAD_NONCE_LEN;
+    unsigned char *tags = data + len;
+    SPP_CIPH *ciph;
+
+    if (ctx != NULL && ctx->mac_length == SPP_AEAD_TAG_LEN && !s->spp_write_modified) {
+        memcpy(nonce, ctx->nonce, SPP_AEAD_NONCE_LEN);
+    } else if (!spp_aead_next_nonce(s, nonce)) {
+        return -1;
+    }
+    spp_aead_aad(aad, s, type, slice->slice_id, len);
+
+    if (!spp_aead_run(slice->read_ciph->enc_write_ctx, nonce, aad, data, data, len, tags))
+        return -1;
+    *macs |= SPP_TRACE_MAC_READ;
+    tags += SPP_AEAD_TAG_LEN;
+
+    ciph = slice->write_ciph;
+    if (ciph != NULL && ciph->enc_write_ctx != NULL) {
+        if (!spp_aead_run(ciph->enc_write_ctx, nonce, aad, NULL, data, len, tags))
+            return -1;
+        *macs |= SPP_TRACE_MAC_WRITE;
+    } else if (ctx != NULL && ctx->write_mac != NULL) {
+        memcpy(tags, ctx->write_mac, SPP_AEAD_TAG_LEN);
+    } else {
+        memset(tags, 0, SPP_AEAD_TAG_LEN);
+    }
+    tags += SPP_AEAD_TAG_LEN;
+
+    ciph = s->def_ctx->write_ciph;
+    if (s->def_ctx->read_access && ciph != NULL && ciph->enc_write_ctx != NULL) {
+        if (!spp_aead_run(ciph->enc_write_ctx, nonce, aad, NULL, data, len, tags))
+            return -1;
+        *macs |= SPP_TRACE_MAC_INTEGRITY;
+    } else if (ctx != NULL && ctx->integrity_mac != NULL) {
+        memcpy(tags, ctx->integrity_mac, SPP_AEAD_TAG_LEN);
+    } else {
+        memset(tags, 0, SPP_AEAD_TAG_LEN);
+    }
+    return 1;
+}
+
+/* Opens the slice record in s->s3->rrec in place and leaves the tags and
+ * nonce in |ctx| for forwarding. Returns 1 if the reader tag matches, -1 if
+ * it does not and 0 if the record is too short to hold the tags. A bad
+ * writer or integrity tag is only noted in |macs| and the statistics. */
+int spp_aead_open(SSL *s, SPP_SLICE *slice, SPP_CTX *ctx, int *macs) {
+    SSL3_RECORD *rr = &(s->s3->rrec);
+    unsigned char aad[SPP_AEAD_AAD_LEN];
+    unsigned char *nonce, *data;
+    unsigned int len;
+    SPP_CIPH *ciph;
+
+    if (rr->length < SPP_AEAD_NONCE_LEN + 3*SPP_AEAD_TAG_LEN)
+        return 0;
+    len = rr->length - SPP_AEAD_NONCE_LEN - 3*SPP_AEAD_TAG_LEN;
+    nonce = rr->data;
+    data = nonce + SPP_AEAD_NONCE_LEN;
+
+    /* As with the MACs, a proxy keeps its own copy of the tags. */
+    ctx->mac_length = SPP_AEAD_TAG_LEN;
+    memcpy(ctx->nonce, nonce, SPP_AEAD_NONCE_LEN);
+    if (s->proxy == 1) {
+        if ((ctx->read_mac = OPENSSL_malloc(3*SPP_AEAD_TAG_LEN)) == NULL)
+            return -1;
+        memcpy(ctx->read_mac, data + len, 3*SPP_AEAD_TAG_LEN);
+    } else {
+        ctx->read_mac = data + len;
+    }
+    ctx->write_mac = ctx->read_mac + SPP_AEAD_TAG_LEN;
+    ctx->integrity_mac = ctx->write_mac + SPP_AEAD_TAG_LEN;
+    spp_aead_aad(aad, s, rr->type, slice->slice_id, len);
+
+    ciph = slice->write_ciph;
+    if (ciph != NULL && ciph->enc_read_ctx != NULL) {
+        *macs |= SPP_TRACE_MAC_WRITE;
+        if (!spp_aead_run(ciph->enc_read_ctx, nonce, aad, NULL, data, len, ctx->write_mac)) {
+            spp_stats_failure(s, slice, 1);
+            *macs |= SPP_TRACE_MAC_WRITE_FAILED;
+        }
+    }
+    ciph = s->def_ctx->write_ciph;
+    if (s->def_ctx->read_access && ciph != NULL && ciph->enc_read_ctx != NULL) {
+        *macs |= SPP_TRACE_MAC_INTEGRITY;
+        if (!spp_aead_run(ciph->enc_read_ctx, nonce, aad, NULL, data, len, ctx->integrity_mac)) {
+            spp_stats_failure(s, slice, 1);
+            *macs |= SPP_TRACE_MAC_INTEGRITY_FAILED;
+        }
+    }
+
+    rr->data = rr->input = data;
+    rr->length = len;
+    *macs |= SPP_TRACE_MAC_READ;
+    if (!spp_aead_run(slice->read_ciph->enc_read_ctx, nonce, aad, data, data, len, ctx->read_mac)) {
+        *macs |= SPP_TRACE_MAC_READ_FAILED;
+        return -1;
+    }
+    return 1;
+}
+
 int xor_array(unsigned char* dst, unsigned char* src1, unsigned char* src2, size_t len) {
     size_t i;
     for (i = 0; i < len; i++) {
@@ -54,6 +236,23 @@ int xor_array(unsigned char* dst, unsigned char* src1, unsigned char* src2, size
     return 1;
 }
 
+/* Sets up |ctx| (allocating it if NULL) to seal or open with the AEAD |c|
+ * under |key|. The nonce is set for each record. */
+static EVP_CIPHER_CTX *spp_init_aead_ctx(EVP_CIPHER_CTX *ctx, const EVP_CIPHER *c,
+                                         const unsigned char *key, int enc) {
+    if (ctx == NULL) {
+        if ((ctx=OPENSSL_malloc(sizeof(EVP_CIPHER_CTX))) == NULL)
+            return NULL;
+        EVP_CIPHER_CTX_init(ctx);
+    }
+    if (!EVP_CipherInit_ex(ctx,c,NULL,key,NULL,enc)) {
+        EVP_CIPHER_CTX_cleanup(ctx);
+        OPENSSL_free(ctx);
+        return NULL;
+    }
+    return ctx;
+}
+
 int spp_init_slice_st(SSL *s, SPP_SLICE *slice, int which) {
     const EVP_CIPHER *c;
     const EVP_MD *m;    
@@ -114,6 +313,16 @@ int spp_init_slice_st(SSL *s, SPP_SLICE *slice, int which) {
             if ((slice->write_mac=spp_init_mac_st(s, slice->write_mac, key, which)) == NULL) {
                 goto err;
             }
+            // With an AEAD the writer tag takes the place of the write mac
+            if (EVP_CIPHER_flags(c) & EVP_CIPH_FLAG_AEAD_CIPHER) {
+                if (slice->write_ciph == NULL) {
+                    if ((slice->write_ciph=OPENSSL_malloc(sizeof(SPP_CIPH))) == NULL)
+                        goto err;
+                    slice->write_ciph->enc_read_ctx = slice->write_ciph->enc_write_ctx = NULL;
+                }
+                if ((slice->write_ciph->enc_read_ctx=spp_init_aead_ctx(slice->write_ciph->enc_read_ctx, c, key, 0)) == NULL)
+                    goto err;
+            }
         }
     } else {
         //printf("which=write\n");
@@ -156,6 +365,16 @@ int spp_init_slice_st(SSL *s, SPP_SLICE *slice, int which) {
             if ((slice->write_mac=spp_init_mac_st(s, slice->write_mac, key, which)) == NULL) {
                 goto err;
             }
+            // With an AEAD the writer tag takes the place of the write mac
+            if (EVP_CIPHER_flags(c) & EVP_CIPH_FLAG_AEAD_CIPHER) {
+                if (slice->write_ciph == NULL) {
+                    if ((slice->write_ciph=OPENSSL_malloc(sizeof(SPP_CIPH))) == NULL)
+                        goto err;
+                    slice->write_ciph->enc_read_ctx = slice->write_ciph->enc_write_ctx = NULL;
+                }
+                if ((slice->write_ciph->enc_write_ctx=spp_init_aead_ctx(slice->write_ciph->enc_write_ctx, c, key, 1)) == NULL)
+                    goto err;
+            }
         }
     }
     return 1;
@@ -177,6 +396,7 @@ SPP_MAC* spp_init_mac_st(SSL* s, SPP_MAC* mac, unsigned char* key, int which) {
         if ((mac=OPENSSL_malloc(sizeof(SPP_MAC))) == NULL) {
             return NULL;
         }
+        memset(mac, 0, sizeof(SPP_MAC));
     }
     if (which & SSL3_CC_READ) {
         mac->read_hash = EVP_MD_CTX_create();
@@ -185,9 +405,14 @@ SPP_MAC* spp_init_mac_st(SSL* s, SPP_MAC* mac, unsigned char* key, int which) {
         mac->read_mac_secret_size = s->s3->tmp.new_mac_secret_size;
         OPENSSL_assert(mac->read_mac_secret_size <= EVP_MAX_MD_SIZE);
         memcpy(&(mac->read_mac_secret[0]), key, mac->read_mac_secret_size);
-        mac_key = EVP_PKEY_new_mac_key(mac_type, NULL,&(mac->read_mac_secret[0]),mac->read_mac_secret_size);
-        EVP_DigestSignInit(mac->read_hash,NULL,m,NULL,mac_key);
-        EVP_PKEY_free(mac_key);
+        // AEAD cipher suites have no MAC, leave the hash empty
+        if (m != NULL) {
+            mac_key = EVP_PKEY_new_mac_key(mac_type, NULL,&(mac->read_mac_secret[0]),mac->read_mac_secret_size);
+            EVP_DigestSignInit(mac->read_hash,NULL,m,NULL,mac_key);
+            EVP_PKEY_free(mac_key);
+        }
+        tls1_precompute_mac(s, &mac->read_hmac_key,
+            mac->read_mac_secret, mac->read_mac_secret_size);
     } else {
         mac->write_hash = EVP_MD_CTX_create();
         //ssl_replace_hash(&(mac->write_hash),NULL);
@@ -195,9 +420,13 @@ SPP_MAC* spp_init_mac_st(SSL* s, SPP_MAC* mac, unsigned char* key, int which) {
         mac->write_mac_secret_size = s->s3->tmp.new_mac_secret_size;
         OPENSSL_assert(mac->write_mac_secret_size <= EVP_MAX_MD_SIZE);
         memcpy(&(mac->write_mac_secret[0]), key, mac->write_mac_secret_size);
-        mac_key = EVP_PKEY_new_mac_key(mac_type, NULL,&(mac->write_mac_secret[0]),mac->write_mac_secret_size);
-        EVP_DigestSignInit(mac->write_hash,NULL,m,NULL,mac_key);
-        EVP_PKEY_free(mac_key);
+        if (m != NULL) {
+            mac_key = EVP_PKEY_new_mac_key(mac_type, NULL,&(mac->write_mac_secret[0]),mac->write_mac_secret_size);
+            EVP_DigestSignInit(mac->write_hash,NULL,m,NULL,mac_key);
+            EVP_PKEY_free(mac_key);
+        }
+        tls1_precompute_mac(s, &mac->write_hmac_key,
+            mac->write_mac_secret, mac->write_mac_secret_size);
     }
     
     return mac;
@@ -231,6 +460,33 @@ err:
     return -1;
 }
 
+/* With an AEAD cipher suite, the integrity tag of a slice record is made
+ * under the endpoint keys. Keep a copy of the endpoint context for it in
+ * def_ctx->write_ciph, so that the TLS record nonce of the original is left
+ * alone. */
+static int spp_store_aead_default(SSL *s, EVP_CIPHER_CTX *ctx, int send) {
+    SPP_CIPH *ciph;
+    EVP_CIPHER_CTX **copy;
+
+    if (ctx == NULL || !(EVP_CIPHER_flags(EVP_CIPHER_CTX_cipher(ctx)) & EVP_CIPH_FLAG_AEAD_CIPHER))
+        return 1;
+    if ((ciph = s->def_ctx->write_ciph) == NULL) {
+        if ((ciph = OPENSSL_malloc(sizeof(SPP_CIPH))) == NULL)
+            return -1;
+        ciph->enc_read_ctx = ciph->enc_write_ctx = NULL;
+        s->def_ctx->write_ciph = ciph;
+    }
+    copy = send ? &ciph->enc_write_ctx : &ciph->enc_read_ctx;
+    if (*copy == NULL) {
+        if ((*copy = OPENSSL_malloc(sizeof(EVP_CIPHER_CTX))) == NULL)
+            return -1;
+    } else {
+        EVP_CIPHER_CTX_cleanup(*copy);
+    }
+    EVP_CIPHER_CTX_init(*copy);
+    return EVP_CIPHER_CTX_copy(*copy, ctx);
+}
+
 int spp_store_defaults(SSL *s, int which) {
     if (which & SSL3_CC_READ) {
         // MAC ctx
@@ -238,20 +494,26 @@ int spp_store_defaults(SSL *s, int which) {
         s->def_ctx->read_mac->read_mac_secret_size = s->s3->read_mac_secret_size;
         memcpy(&(s->def_ctx->read_mac->read_mac_secret[0]), &(s->s3->read_mac_secret[0]), s->s3->read_mac_secret_size);
         s->def_ctx->read_mac->read_hash = s->read_hash;
+        s->def_ctx->read_mac->read_hmac_key = s->s3->read_hmac_key;
         s->def_ctx->read_access = 1;
         
         // Encrypt ctx
         s->def_ctx->read_ciph->enc_read_ctx = s->enc_read_ctx;
+        if (spp_store_aead_default(s, s->enc_read_ctx, 0) <= 0)
+            return -1;
     } else {
         // MAC ctx
         memset(&(s->def_ctx->read_mac->write_sequence[0]),0,8);
         s->def_ctx->read_mac->write_mac_secret_size = s->s3->write_mac_secret_size;
         memcpy(&(s->def_ctx->read_mac->write_mac_secret[0]), &(s->s3->write_mac_secret[0]), s->s3->write_mac_secret_size); 
         s->def_ctx->read_mac->write_hash = s->write_hash;
+        s->def_ctx->read_mac->write_hmac_key = s->s3->write_hmac_key;
         s->def_ctx->write_access = 1;
         
         // Encrypt ctx
         s->def_ctx->read_ciph->enc_write_ctx = s->enc_write_ctx;
+        if (spp_store_aead_default(s, s->enc_write_ctx, 1) <= 0)
+            return -1;
     }
     return 1;
 }
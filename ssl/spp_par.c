@@ -0,0 +1,474 @@
+#include <stdio.h>
+#include <string.h>
+#include "ssl_locl.h"
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <openssl/rand.h>
+
+#if defined(OPENSSL_THREADS) && !defined(OPENSSL_SYS_WINDOWS) && !defined(OPENSSL_SYS_NETWARE)
+#define SPP_SEAL_PTHREADS
+#include <pthread.h>
+#endif
+
+/* Batched (and optionally parallel) sealing of SPP application records.
+ *
+ * A large SPP_write_record() is cut into max_send_fragment sized records
+ * exactly as spp_write_bytes() would do, but instead of building, MACing and
+ * encrypting one record at a time in s->s3->wbuf, the whole batch is laid
+ * out in the (enlarged) write buffer first. Every record's offset is known
+ * up front, since the padded length only depends on the plaintext length, so
+ * records can be sealed in any order and on any thread while the bytes on
+ * the wire stay in order. The batch is then flushed with a single
+ * ssl3_write_pending().
+ *
+ * Records are sealed independently of each other: each one gets a fresh
+ * random explicit IV (SPP always runs with TLS 1.1+ record semantics) and a
+ * private copy of the slice's cipher context, so the CBC chaining state of
+ * the slice is never shared between threads. Records are handed to the
+ * cipher SPP_SEAL_LANES at a time through EVP_Cipher_multi(), which lets
+ * AES-NI interleave their otherwise serial CBC chains. The three MACs are
+ * computed from the precomputed HMAC keys of the slice that tls1_mac() uses
+ * too, which keeps the output byte-compatible with do_spp_write().
+ *
+ * Worker threads only ever touch batch-private objects and those read-only
+ * keys: all EVP objects that carry reference counts are copied and released
+ * on the calling thread. */
+
+/* Upper bound on the records sealed by one batch (about 260KB of wire data
+ * with the default max_send_fragment). */
+#define SPP_SEAL_MAX_BATCH      16
+/* Records per unit of work, encrypted together by EVP_Cipher_multi(). */
+#define SPP_SEAL_LANES          4
+
+typedef struct spp_seal_job_st {
+    unsigned char *out;         /* Start of the record, header included */
+    const unsigned char *in;    /* Plaintext */
+    unsigned int len;           /* Plaintext length */
+    unsigned int enc_len;       /* Length of the encrypted part */
+    EVP_CIPHER_CTX ciph;
+    int ret;
+} SPP_SEAL_JOB;
+
+typedef struct spp_seal_batch_st {
+    SPP_SEAL_JOB jobs[SPP_SEAL_MAX_BATCH];
+    int njobs;
+    int ntasks;
+    /* The three MAC keys: read, write and end-to-end integrity. */
+    const HMAC_PRECOMP *macs[3];
+    unsigned char seq[3][8];
+    int mac_size;
+    int eivlen;
+    int bs;
+    int type;
+    int version;
+    /* Claimed and completed task counts, protected by the pool lock. */
+    int next;
+    int done;
+    struct spp_seal_batch_st *queue_next;
+} SPP_SEAL_BATCH;
+
+/* Writers hold a reference to the pool while they use it, so that
+ * SSL_CTX_set_spp_seal_threads() can swap it out from under live
+ * connections. The count is protected by CRYPTO_LOCK_SSL_CTX. */
+struct spp_seal_pool_st {
+    int references;
+    int nthreads;
+#ifdef SPP_SEAL_PTHREADS
+    pthread_t *threads;
+    pthread_mutex_t lock;
+    pthread_cond_t work;
+    pthread_cond_t done;
+    SPP_SEAL_BATCH *head, *tail;
+    int shutdown;
+#endif
+};
+
+/* Copy the plaintext of |job| into place, then append its MACs and CBC
+ * padding. */
+static int spp_seal_mac(SPP_SEAL_BATCH *b, SPP_SEAL_JOB *job) {
+    unsigned char header[13];
+    unsigned char *p = job->out + SPP_RT_HEADER_LENGTH;
+    unsigned char *mac = p + b->eivlen + job->len;
+    unsigned int l, i, k;
+    HMAC_PRECOMP_CTX hmac;
+
+    /* The explicit IV was filled in by the caller. */
+    memcpy(p + b->eivlen, job->in, job->len);
+
+    header[8] = b->type;
+    header[9] = (unsigned char)(b->version >> 8);
+    header[10] = (unsigned char)(b->version);
+    header[11] = job->len >> 8;
+    header[12] = job->len & 0xff;
+    for (i = 0; i < 3; i++) {
+        memcpy(header, b->seq[i], 8);
+        HMAC_precomp_Init(&hmac, b->macs[i]);
+        HMAC_precomp_Update(&hmac, header, sizeof(header));
+        HMAC_precomp_Update(&hmac, p + b->eivlen, job->len);
+        HMAC_precomp_Final(&hmac, mac + i * b->mac_size);
+    }
+
+    /* Same padding as tls1_enc(). */
+    l = b->eivlen + job->len + 3 * b->mac_size;
+    k = job->enc_len - l;
+    for (i = l; i < job->enc_len; i++)
+        p[i] = k - 1;
+    return 1;
+}
+
+/* Seal records SPP_SEAL_LANES * |task| onwards. */
+static void spp_seal_task(SPP_SEAL_BATCH *b, int task) {
+    EVP_CIPHER_LANE lanes[SPP_SEAL_LANES];
+    SPP_SEAL_JOB *job;
+    int i, n = 0;
+
+    for (i = task * SPP_SEAL_LANES;
+            i < b->njobs && n < SPP_SEAL_LANES; i++, n++) {
+        job = &b->jobs[i];
+        job->ret = spp_seal_mac(b, job);
+        lanes[n].ctx = &job->ciph;
+        lanes[n].out = job->out + SPP_RT_HEADER_LENGTH;
+        lanes[n].in = lanes[n].out;
+        lanes[n].len = job->enc_len;
+    }
+    if (!EVP_Cipher_multi(lanes, n)) {
+        for (i = task * SPP_SEAL_LANES; n > 0; i++, n--)
+            b->jobs[i].ret = 0;
+    }
+}
+
+#ifdef SPP_SEAL_PTHREADS
+/* Claim the next task of the oldest batch that still has unclaimed tasks.
+ * Must be called with the pool lock held. */
+static int spp_seal_claim(SPP_SEAL_POOL *pool, SPP_SEAL_BATCH **batch) {
+    SPP_SEAL_BATCH *b = pool->head;
+    int task;
+
+    if (b == NULL)
+        return -1;
+    task = b->next++;
+    if (b->next == b->ntasks) {
+        /* Fully claimed, nobody needs to find it in the queue anymore. */
+        pool->head = b->queue_next;
+        if (pool->head == NULL)
+            pool->tail = NULL;
+    }
+    *batch = b;
+    return task;
+}
+
+static void *spp_seal_worker(void *arg) {
+    SPP_SEAL_POOL *pool = arg;
+    SPP_SEAL_BATCH *b;
+    int task;
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (!pool->shutdown && pool->head == NULL)
+            pthread_cond_wait(&pool->work, &pool->lock);
+        if (pool->shutdown)
+            break;
+        task = spp_seal_claim(pool, &b);
+        pthread_mutex_unlock(&pool->lock);
+
+        spp_seal_task(b, task);
+
+        pthread_mutex_lock(&pool->lock);
+        if (++b->done == b->ntasks)
+            pthread_cond_broadcast(&pool->done);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+#endif
+
+SPP_SEAL_POOL *spp_seal_pool_new(int nthreads) {
+    SPP_SEAL_POOL *pool;
+
+    if ((pool = OPENSSL_malloc(sizeof(SPP_SEAL_POOL))) == NULL)
+        return NULL;
+    memset(pool, 0, sizeof(SPP_SEAL_POOL));
+    pool->references = 1;
+#ifdef SPP_SEAL_PTHREADS
+    if (nthreads <= 0)
+        return pool;
+    if ((pool->threads = OPENSSL_malloc(nthreads * sizeof(pthread_t))) == NULL) {
+        OPENSSL_free(pool);
+        return NULL;
+    }
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work, NULL);
+    pthread_cond_init(&pool->done, NULL);
+    for (; pool->nthreads < nthreads; pool->nthreads++) {
+        if (pthread_create(&pool->threads[pool->nthreads], NULL,
+                spp_seal_worker, pool) != 0)
+            break;
+    }
+#endif
+    return pool;
+}
+
+/* Drops a reference; the threads are stopped with the last one. */
+void spp_seal_pool_free(SPP_SEAL_POOL *pool) {
+    if (pool == NULL)
+        return;
+    if (CRYPTO_add(&pool->references, -1, CRYPTO_LOCK_SSL_CTX) > 0)
+        return;
+#ifdef SPP_SEAL_PTHREADS
+    if (pool->threads != NULL) {
+        int i;
+        pthread_mutex_lock(&pool->lock);
+        pool->shutdown = 1;
+        pthread_cond_broadcast(&pool->work);
+        pthread_mutex_unlock(&pool->lock);
+        for (i = 0; i < pool->nthreads; i++)
+            pthread_join(pool->threads[i], NULL);
+        pthread_cond_destroy(&pool->done);
+        pthread_cond_destroy(&pool->work);
+        pthread_mutex_destroy(&pool->lock);
+        OPENSSL_free(pool->threads);
+    }
+#endif
+    OPENSSL_free(pool);
+}
+
+/* The seal pool of |ctx|, started on first use, with a reference taken for
+ * the caller; NULL if the context has no seal threads. */
+static SPP_SEAL_POOL *spp_seal_pool_get(SSL_CTX *ctx) {
+    SPP_SEAL_POOL *pool;
+
+    CRYPTO_w_lock(CRYPTO_LOCK_SSL_CTX);
+    if (ctx->spp_seal_pool == NULL && ctx->spp_seal_threads > 0)
+        ctx->spp_seal_pool = spp_seal_pool_new(ctx->spp_seal_threads);
+    if ((pool = ctx->spp_seal_pool) != NULL)
+        pool->references++;
+    CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CTX);
+    return pool;
+}
+
+/* Seal all records of the batch, on the pool's threads if there are any. The
+ * calling thread works on the batch too, so a pool of N threads seals with
+ * N+1 cores. */
+static void spp_seal_run(SPP_SEAL_POOL *pool, SPP_SEAL_BATCH *b) {
+    int i;
+
+    b->ntasks = (b->njobs + SPP_SEAL_LANES - 1) / SPP_SEAL_LANES;
+    b->next = b->done = 0;
+    b->queue_next = NULL;
+#ifdef SPP_SEAL_PTHREADS
+    if (pool != NULL && pool->nthreads > 0 && b->ntasks > 1) {
+        SPP_SEAL_BATCH *cb;
+        int task;
+
+        pthread_mutex_lock(&pool->lock);
+        if (pool->tail != NULL)
+            pool->tail->queue_next = b;
+        else
+            pool->head = b;
+        pool->tail = b;
+        pthread_cond_broadcast(&pool->work);
+        /* Help out with our own batch until it is fully claimed. */
+        while (b->next < b->ntasks) {
+            for (cb = pool->head; cb != NULL && cb != b; cb = cb->queue_next)
+                ;
+            if (cb == NULL)
+                break;
+            task = b->next++;
+            if (b->next == b->ntasks) {
+                /* Unlink the batch; it may sit behind other batches. */
+                SPP_SEAL_BATCH **pp = &pool->head, *prev = NULL;
+                while (*pp != b) {
+                    prev = *pp;
+                    pp = &(*pp)->queue_next;
+                }
+                *pp = b->queue_next;
+                if (pool->tail == b)
+                    pool->tail = prev;
+            }
+            pthread_mutex_unlock(&pool->lock);
+            spp_seal_task(b, task);
+            pthread_mutex_lock(&pool->lock);
+            b->done++;
+        }
+        while (b->done < b->ntasks)
+            pthread_cond_wait(&pool->done, &pool->lock);
+        pthread_mutex_unlock(&pool->lock);
+        return;
+    }
+#endif
+    for (i = 0; i < b->ntasks; i++)
+        spp_seal_task(b, i);
+}
+
+/* Returns 1 if a write of |len| bytes of |type| can go through
+ * spp_write_large(), i.e. if we are an endpoint writing a slice for which we
+ * hold all three MAC keys and the negotiated cipher is a CBC block cipher. */
+int spp_can_write_large(SSL *s, int type, unsigned int len) {
+    SPP_SLICE *slice = s->write_slice;
+    EVP_CIPHER_CTX *ciph;
+
+    if (!(s->mode & SSL_MODE_SPP_LARGE_WRITE) ||
+        type != SSL3_RT_APPLICATION_DATA ||
+        len < 2 * s->max_send_fragment)
+        return 0;
+    if (s->proxy || s->spp_write_ctx != NULL || slice == NULL ||
+        SSL_in_init(s) || s->in_handshake || s->session == NULL)
+        return 0;
+    if (s->compress != NULL || s->version < TLS1_1_VERSION ||
+        s->s3->tmp.new_mac_pkey_type != EVP_PKEY_HMAC ||
+        (s->mac_flags & SSL_MAC_FLAG_WRITE_MAC_STREAM) ||
+        (s->options & SSL_OP_TLS_BLOCK_PADDING_BUG))
+        return 0;
+    if (slice->read_ciph == NULL || slice->read_mac == NULL ||
+        slice->write_mac == NULL || !s->def_ctx->read_access)
+        return 0;
+    if ((ciph = slice->read_ciph->enc_write_ctx) == NULL ||
+        EVP_CIPHER_CTX_mode(ciph) != EVP_CIPH_CBC_MODE ||
+        EVP_CIPHER_CTX_block_size(ciph) <= 1 ||
+        (EVP_CIPHER_flags(ciph->cipher) & EVP_CIPH_FLAG_AEAD_CIPHER))
+        return 0;
+    if (slice->read_mac->write_hash == NULL ||
+        EVP_MD_CTX_md(slice->read_mac->write_hash) == NULL ||
+        slice->write_mac->write_hash == NULL ||
+        s->def_ctx->read_mac->write_hash == NULL ||
+        SPP_HMAC_KEY(&slice->read_mac->write_hmac_key) == NULL ||
+        SPP_HMAC_KEY(&slice->write_mac->write_hmac_key) == NULL ||
+        SPP_HMAC_KEY(&s->def_ctx->read_mac->write_hmac_key) == NULL)
+        return 0;
+    return 1;
+}
+
+/* Seal as many records of |buf| as fit in one batch and write them out.
+ * Returns the number of plaintext bytes consumed, like do_spp_write(). */
+int spp_write_large(SSL *s, int type, const unsigned char *buf, unsigned int len) {
+    SSL3_BUFFER *wb = &(s->s3->wbuf);
+    SPP_SLICE *slice = s->write_slice;
+    SPP_SEAL_BATCH *b = NULL;
+    SPP_SEAL_POOL *pool;
+    SPP_SEAL_JOB *job;
+    EVP_CIPHER_CTX *ciph = slice->read_ciph->enc_write_ctx;
+    const EVP_MD *md;
+    unsigned char *p;
+    unsigned char ivs[SPP_SEAL_MAX_BATCH * EVP_MAX_IV_LENGTH];
+    unsigned int frag = s->max_send_fragment, tot = 0, n, l;
+    size_t need;
+    int i, ret = -1;
+
+    /* Retry of a batch that could not be flushed completely. */
+    if (wb->left != 0)
+        return ssl3_write_pending(s, type, buf, len);
+
+    if (s->s3->alert_dispatch) {
+        i = s->method->ssl_dispatch_alert(s);
+        if (i <= 0)
+            return i;
+    }
+
+    if ((b = OPENSSL_malloc(sizeof(SPP_SEAL_BATCH))) == NULL) {
+        SSLerr(SSL_F_DO_SSL3_WRITE, ERR_R_MALLOC_FAILURE);
+        return -1;
+    }
+    b->njobs = 0;
+    b->type = type;
+    b->version = s->version;
+    b->bs = EVP_CIPHER_CTX_block_size(ciph);
+    b->eivlen = EVP_CIPHER_CTX_iv_length(ciph);
+    md = EVP_MD_CTX_md(slice->read_mac->write_hash);
+    b->mac_size = EVP_MD_size(md);
+    if (b->mac_size <= 0 || b->eivlen > EVP_MAX_IV_LENGTH)
+        goto err;
+
+    /* Lay out the batch: one record per max_send_fragment bytes. */
+    need = 0;
+    while (tot < len && b->njobs < SPP_SEAL_MAX_BATCH) {
+        job = &b->jobs[b->njobs];
+        n = len - tot > frag ? frag : len - tot;
+        l = b->eivlen + n + 3 * b->mac_size;
+        job->in = buf + tot;
+        job->len = n;
+        job->enc_len = l + (b->bs - l % b->bs);
+        need += SPP_RT_HEADER_LENGTH + job->enc_len;
+        tot += n;
+        b->njobs++;
+    }
+
+    /* Grow to a full batch at once, so that all large writes of a
+     * context share one freelist size class. */
+    l = b->eivlen + frag + 3 * b->mac_size;
+    if (!ssl3_grow_write_buffer(s, SPP_SEAL_MAX_BATCH *
+                                (SPP_RT_HEADER_LENGTH + l + (b->bs - l % b->bs))))
+        goto err;
+#if defined(SSL3_ALIGN_PAYLOAD) && SSL3_ALIGN_PAYLOAD!=0
+    wb->offset = spp_payload_align(s, wb->buf, 1);
+#else
+    wb->offset = 0;
+#endif
+
+    b->macs[0] = &slice->read_mac->write_hmac_key;
+    b->macs[1] = &slice->write_mac->write_hmac_key;
+    b->macs[2] = &s->def_ctx->read_mac->write_hmac_key;
+    memcpy(b->seq[0], slice->read_mac->write_sequence, 8);
+    memcpy(b->seq[1], slice->write_mac->write_sequence, 8);
+    memcpy(b->seq[2], s->def_ctx->read_mac->write_sequence, 8);
+
+    if (RAND_bytes(ivs, b->njobs * b->eivlen) <= 0)
+        goto err;
+
+    p = wb->buf + wb->offset;
+    for (i = 0; i < b->njobs; i++) {
+        job = &b->jobs[i];
+        EVP_CIPHER_CTX_init(&job->ciph);
+        if (!EVP_CIPHER_CTX_copy(&job->ciph, ciph)) {
+            b->njobs = i;
+            goto err;
+        }
+        job->out = p;
+        *(p++) = type & 0xff;
+        *(p++) = s->version >> 8;
+        *(p++) = s->version & 0xff;
+        s2n(job->enc_len, p);
+        *(p++) = slice->slice_id;
+        memcpy(p, ivs + i * b->eivlen, b->eivlen);
+        p += job->enc_len;
+
+        s->write_stats.app_bytes += job->len;
+        s->write_stats.header_bytes += SPP_RT_HEADER_LENGTH;
+        s->write_stats.mac_bytes += 3 * b->mac_size;
+        s->write_stats.pad_bytes += job->enc_len - (b->eivlen + job->len + 3 * b->mac_size);
+        s->write_stats.bytes += job->enc_len + SPP_RT_HEADER_LENGTH;
+        spp_stats_record(s, slice, SPP_STATS_WRITE, job->enc_len + SPP_RT_HEADER_LENGTH,
+                         job->len, 3 * b->mac_size, 0);
+        if (SPP_TRACE_FLAGS(s) & SPP_TRACE_RECORDS)
+            spp_trace_record(s, 1, type, slice, job->len,
+                             job->enc_len + SPP_RT_HEADER_LENGTH, SPP_TRACE_MAC_READ |
+                             SPP_TRACE_MAC_WRITE | SPP_TRACE_MAC_INTEGRITY, 0);
+    }
+
+    pool = spp_seal_pool_get(s->ctx);
+    spp_seal_run(pool, b);
+    spp_seal_pool_free(pool);
+
+    for (i = 0; i < b->njobs; i++) {
+        if (!b->jobs[i].ret)
+            goto err;
+    }
+
+    wb->left = need;
+    s->s3->wpend_tot = tot;
+    s->s3->wpend_buf = buf;
+    s->s3->wpend_type = type;
+    s->s3->wpend_ret = tot;
+    ret = 1;
+
+err:
+    if (b != NULL) {
+        for (i = 0; i < b->njobs; i++)
+            EVP_CIPHER_CTX_cleanup(&b->jobs[i].ciph);
+        OPENSSL_free(b);
+    }
+    if (ret <= 0) {
+        SSLerr(SSL_F_DO_SSL3_WRITE, ERR_R_INTERNAL_ERROR);
+        return -1;
+    }
+    return ssl3_write_pending(s, type, buf, tot);
+}
@@ -7,6 +7,10 @@
 #include <openssl/buffer.h>
 #include <openssl/rand.h>
 
+#if defined(OPENSSL_SYS_WIN32) || defined(OPENSSL_SYS_VMS)
+#include <sys/timeb.h>
+#endif
+
 //#define DEBUG
 #define MAX_EMPTY_RECORDS 10 /* Might not be needed */
 /* Read record from the underlying communication medium 
@@ -23,8 +27,12 @@ static int spp_get_record(SSL *s) {
     unsigned char md[EVP_MAX_MD_SIZE];
     short version;
     unsigned mac_size, orig_len;
+    unsigned int wire_len, mac_len;
+    int macs;
     size_t extra;
     unsigned empty_record_count = 0;    
+    SPP_TIMER(t_stage);
+    SPP_TIMER(t_record);
     
     rr= &(s->s3->rrec);
     sess=s->session;
@@ -46,6 +54,7 @@ again:
         (s->packet_length < SPP_RT_HEADER_LENGTH)) {
             n=ssl3_read_n(s, SPP_RT_HEADER_LENGTH, s->s3->rbuf.len, 0);
             if (n <= 0) return(n); /* error or non-blocking */
+            SPP_TIMING_START(s, t_stage);
             s->rstate=SSL_ST_READ_BODY;
 
             p=s->packet;
@@ -94,6 +103,7 @@ fprintf(stderr, "Record type=%d, Length=%d\n", rr->type, rr->length);
                 goto f_err;
             }
 
+            SPP_TIMING_LAP(s, SPP_TIMING_READ_HEADER, t_stage);
             /* now s->rstate == SSL_ST_READ_BODY */
         }
 
@@ -109,6 +119,8 @@ fprintf(stderr, "Record type=%d, Length=%d\n", rr->type, rr->length);
     }
 
     s->rstate=SSL_ST_READ_HEADER; /* set state for later operations */
+    SPP_TIMING_START(s, t_record);
+    SPP_TIMING_START(s, t_stage);
 
     /* At this point, s->packet_length == SPP_RT_HEADER_LNGTH + rr->length,
      * and we have that many bytes in s->packet
@@ -134,6 +146,9 @@ fprintf(stderr, "Record type=%d, Length=%d\n", rr->type, rr->length);
 
     /* decrypt in place in 'rr->input' */
     rr->data=rr->input;
+    wire_len = rr->length + SPP_RT_HEADER_LENGTH;
+    mac_len = 0;
+    macs = 0;
     slice = SPP_get_slice_by_id(s, rr->slice_id);
     //printf("Receiving record slice %d\n", rr->slice_id);
     /* Get slice from id if it can be found. */
@@ -163,14 +178,28 @@ fprintf(stderr, "Record type=%d, Length=%d\n", rr->type, rr->length);
         s->spp_read_ctx = NULL;
     }
     
-    /* Send to ssp_enc for decryption. */
-    enc_err = s->method->ssl3_enc->enc(s,0);
+    SPP_TIMING_LAP(s, SPP_TIMING_READ_SLICE, t_stage);
+    if (spp_aead_slice(s, slice) && slice->read_ciph != NULL &&
+        slice->read_ciph->enc_read_ctx != NULL) {
+        /* Checks the three tags and decrypts, see spp_aead_open(). */
+        s->enc_read_ctx = slice->read_ciph->enc_read_ctx;
+        enc_err = spp_aead_open(s, slice, spp_ctx, &macs);
+        if (enc_err != 0) {
+            mac_len = 3*SPP_AEAD_TAG_LEN;
+            s->read_stats.mac_bytes += mac_len;
+        }
+    } else {
+        /* Send to ssp_enc for decryption. */
+        enc_err = s->method->ssl3_enc->enc(s,0);
+    }
+    SPP_TIMING_LAP(s, s->enc_read_ctx != NULL ? SPP_TIMING_READ_DECRYPT : -1, t_stage);
     
     /* enc_err is:
      *    0: (in non-constant time) if the record is publically invalid.
      *    1: if the padding is valid
      *    -1: if the padding is invalid */
     if (enc_err == 0) {
+        spp_stats_failure(s, slice, 0);
         al=SSL_AD_DECRYPTION_FAILED;
         SSLerr(SSL_F_SSL3_GET_RECORD,SSL_R_BLOCK_CIPHER_PAD_IS_WRONG);
         goto f_err;
@@ -259,6 +288,7 @@ printf("\n");
 #endif
             //printf("Grabbed %d bytes of mac, for 3 %d sized macs\n", mac_size, spp_ctx->mac_length);
             s->read_stats.mac_bytes += mac_size;
+            mac_len = mac_size;
             mac_size = spp_ctx->mac_length;
             spp_ctx->write_mac = &(spp_ctx->read_mac[mac_size]);
             spp_ctx->integrity_mac = &(spp_ctx->write_mac[mac_size]);
@@ -270,8 +300,10 @@ printf("\n");
             printf("md: ");
             spp_print_buffer(md, mac_size);
 #endif
+            macs |= SPP_TRACE_MAC_READ;
             if (i < 0 || mac == NULL || CRYPTO_memcmp(md, mac, (size_t)mac_size) != 0) {
                 enc_err = -1;
+                macs |= SPP_TRACE_MAC_READ_FAILED;
                 printf("Read MAC failed!\n");
             }
             if (rr->length > SSL3_RT_MAX_COMPRESSED_LENGTH+extra+mac_size) {
@@ -284,7 +316,10 @@ printf("\n");
                 spp_copy_mac_state(s, slice->write_mac, 0);
                 mac = spp_ctx->write_mac;
                 i=s->method->ssl3_enc->mac(s,md,0 /* not send */);
+                macs |= SPP_TRACE_MAC_WRITE;
                 if (i < 0 || mac == NULL || CRYPTO_memcmp(md, mac, (size_t)mac_size) != 0) {
+                    spp_stats_failure(s, slice, 1);
+                    macs |= SPP_TRACE_MAC_WRITE_FAILED;
                     printf("Write MAC failed!\n");
                     //enc_err = -1; 
                 }
@@ -294,8 +329,11 @@ printf("\n");
                 spp_copy_mac_state(s, s->def_ctx->read_mac, 0);
                 mac = spp_ctx->integrity_mac;
                 i=s->method->ssl3_enc->mac(s,md,0 /* not send */);
+                macs |= SPP_TRACE_MAC_INTEGRITY;
                 if (i < 0 || mac == NULL || CRYPTO_memcmp(md, mac, (size_t)mac_size) != 0) {
                     enc_err = 0;    /* This is not a fatal error. Just important information to know. Expose it somehow to the application */
+                    spp_stats_failure(s, slice, 1);
+                    macs |= SPP_TRACE_MAC_INTEGRITY_FAILED;
                     printf("Integrity MAC failed!\n");
                 }
             }
@@ -352,14 +390,24 @@ printf("\n");
                     }
 
             s->read_stats.mac_bytes += mac_size;
+            mac_len = mac_size;
             i=s->method->ssl3_enc->mac(s,md,0 /* not send */);
-            if (i < 0 || mac == NULL || CRYPTO_memcmp(md, mac, (size_t)mac_size) != 0)
+            macs |= SPP_TRACE_MAC_TLS;
+            if (i < 0 || mac == NULL || CRYPTO_memcmp(md, mac, (size_t)mac_size) != 0) {
                     enc_err = -1;
+                    macs |= SPP_TRACE_MAC_READ_FAILED;
+            }
             if (rr->length > SSL3_RT_MAX_COMPRESSED_LENGTH+extra+mac_size)
                     enc_err = -1;
     }
+    SPP_TIMING_LAP(s, mac_len != 0 ? SPP_TIMING_READ_MAC : -1, t_stage);
 
     if (enc_err < 0) {
+        /* Bad padding and a bad MAC are deliberately indistinguishable
+         * here, both count as a MAC failure. */
+        spp_stats_failure(s, slice, 1);
+        if (SPP_TRACE_FLAGS(s) & SPP_TRACE_RECORDS)
+            spp_trace_record(s, 0, rr->type, slice, rr->length, wire_len, macs, 0);
         /* A separate 'decryption_failed' alert was introduced with TLS 1.0,
          * SSL 3.0 only has 'bad_record_mac'.  But unless a decryption
          * failure is directly visible from the ciphertext anyway,
@@ -382,9 +430,13 @@ printf("\n");
             SSLerr(SSL_F_SSL3_GET_RECORD,SSL_R_BAD_DECOMPRESSION);
             goto f_err;
         }
+        SPP_TIMING_LAP(s, SPP_TIMING_READ_EXPAND, t_stage);
     }
 
-    if ((s->proxy && rr->length > SPP_RT_MAX_PACKET_SIZE+extra) || (!s->proxy && rr->length > SSL3_RT_MAX_PLAIN_LENGTH+extra)) {
+    /* Whatever we could decrypt is bound by the normal plaintext limit, only
+     * records a proxy forwards opaquely may carry the MACs and padding. */
+    if ((s->proxy && s->enc_read_ctx == NULL && rr->length > SPP_RT_MAX_PACKET_SIZE+extra) ||
+        ((!s->proxy || s->enc_read_ctx != NULL) && rr->length > SSL3_RT_MAX_PLAIN_LENGTH+extra)) {
         printf("Data too big!!\n");
         al=SSL_AD_RECORD_OVERFLOW;
         SSLerr(SSL_F_SSL3_GET_RECORD,SSL_R_DATA_LENGTH_TOO_LONG);
@@ -420,6 +472,12 @@ printf("\n");
         s->read_stats.handshake_bytes += rr->length;
     else if (rr->type == SSL3_RT_ALERT)
         s->read_stats.alert_bytes += rr->length;
+    spp_stats_record(s, slice, SPP_STATS_READ, wire_len, rr->length, mac_len,
+                     s->proxy && slice != NULL && s->enc_read_ctx == NULL);
+    if (SPP_TRACE_FLAGS(s) & SPP_TRACE_RECORDS)
+        spp_trace_record(s, 0, rr->type, slice, rr->length, wire_len, macs,
+                         s->proxy && slice != NULL && s->enc_read_ctx == NULL);
+    SPP_TIMING_LAP(s, SPP_TIMING_READ_RECORD, t_record);
     
 #if 0
     fprintf(stderr, "Ultimate Record type=%d, Length=%d\n", rr->type, rr->length);
@@ -439,6 +497,7 @@ int spp_read_bytes(SSL *s, int type, unsigned char *buf, int len, int peek) {
     unsigned int n;
     SSL3_RECORD *rr;
     void (*cb)(const SSL *ssl,int type2,int val)=NULL;
+    SPP_TIMER(t_copy);
     
     if (s->s3->rbuf.buf == NULL) /* Not initialized yet */
         if (!ssl3_setup_read_buffer(s)) /* Method OK to use with SPP */
@@ -476,7 +535,7 @@ int spp_read_bytes(SSL *s, int type, unsigned char *buf, int len, int peek) {
 
     if (!s->in_handshake && SSL_in_init(s)) {
         /* type == SSL3_RT_APPLICATION_DATA */
-        i=s->handshake_func(s);
+        i=ssl_run_handshake(s,s->handshake_func);
         if (i < 0) return(i);
         if (i == 0) {
             SSLerr(SSL_F_SSL3_READ_BYTES,SSL_R_SSL_HANDSHAKE_FAILURE);
@@ -538,7 +597,9 @@ start:
             else
                     n = (unsigned int)len;
 
+            SPP_TIMING_START(s, t_copy);
             memcpy(buf,&(rr->data[rr->off]),n);
+            SPP_TIMING_LAP(s, SPP_TIMING_READ_COPY, t_copy);
             if (!peek)
                     {
                     rr->length-=n;
@@ -644,7 +705,7 @@ start:
                     ssl3_renegotiate(s);
                     if (ssl3_renegotiate_check(s))
                             {
-                            i=s->handshake_func(s);
+                            i=ssl_run_handshake(s,s->handshake_func);
                             if (i < 0) return(i);
                             if (i == 0)
                                     {
@@ -805,6 +866,8 @@ start:
 
             if (s->msg_callback)
                     s->msg_callback(0, s->version, SSL3_RT_CHANGE_CIPHER_SPEC, rr->data, 1, s, s->msg_callback_arg);
+            if (SPP_TRACE_FLAGS(s) & SPP_TRACE_HANDSHAKE)
+                    spp_trace_message(s, 0, SSL3_RT_CHANGE_CIPHER_SPEC, rr->data, 1);
 
 #ifdef DEBUG
             printf("Got change cipher spec\n");
@@ -837,7 +900,7 @@ start:
                     s->renegotiate=1;
                     s->new_session=1;
                     }
-            i=s->handshake_func(s);
+            i=ssl_run_handshake(s,s->handshake_func);
             if (i < 0) return(i);
             if (i == 0)
                     {
@@ -940,18 +1003,52 @@ int spp_dispatch_alert(SSL *s) {
     return ret;
 }
 
+/* Explicit IV length, block ciphers and TLS version 1.1 or later */
+static int spp_explicit_iv_len(SSL *s, EVP_CIPHER_CTX *ctx) {
+    int mode, eivlen = 0;
+
+    if (ctx == NULL || s->version < TLS1_1_VERSION)
+        return 0;
+    mode = EVP_CIPHER_CTX_mode(ctx);
+    if (mode == EVP_CIPH_CBC_MODE) {
+        eivlen = EVP_CIPHER_CTX_iv_length(ctx);
+        if (eivlen <= 1)
+            eivlen = 0;
+    }
+    /* Need explicit part of IV for GCM mode */
+    else if (mode == EVP_CIPH_GCM_MODE)
+        eivlen = EVP_GCM_TLS_EXPLICIT_IV_LEN;
+    return eivlen;
+}
+
+/* Offset into buf at which to place a record so that its payload, past
+ * the 6 byte header and the explicit IV, starts on a SPP_ALIGN_PAYLOAD
+ * boundary. All slices of a connection share one cipher, so the current
+ * read context gives the IV length for the next record too. */
+long spp_payload_align(SSL *s, const unsigned char *buf, int send) {
+    long align;
+
+    align = (long)buf + SPP_RT_HEADER_LENGTH +
+        spp_explicit_iv_len(s, send ? s->enc_write_ctx : s->enc_read_ctx);
+    return (-align)&(SPP_ALIGN_PAYLOAD-1);
+}
+
 static int do_spp_write(SSL *s, int type, const unsigned char *buf,
 			 unsigned int len, int create_empty_fragment) {
     unsigned char *p,*plen;
     int i,mac_size,clear=0;
     int prefix_len=0;
-    int eivlen;
+    int eivlen, aead;
+    unsigned int mac_len=0;
+    int macs=0;
     long align=0;
     SSL3_RECORD *wr;
     SSL3_BUFFER *wb=&(s->s3->wbuf);
     SSL_SESSION *sess;
     SPP_CTX *spp_ctx = s->spp_write_ctx;
     SPP_SLICE *slice = s->write_slice;
+    SPP_TIMER(t_stage);
+    SPP_TIMER(t_record);
 
     /* first check if there is a SSL3_BUFFER still being written
      * out.  This will happen with non blocking IO */
@@ -977,6 +1074,8 @@ static int do_spp_write(SSL *s, int type, const unsigned char *buf,
 
     wr = &(s->s3->wrec);
     sess = s->session;
+    SPP_TIMING_START(s, t_record);
+    SPP_TIMING_START(s, t_stage);
 
     if (slice != NULL) {
         s->enc_write_ctx = slice->read_ciph->enc_write_ctx;
@@ -1043,8 +1142,7 @@ static int do_spp_write(SSL *s, int type, const unsigned char *buf,
         p = wb->buf + wb->offset + prefix_len;
     } else {
 #if defined(SSL3_ALIGN_PAYLOAD) && SSL3_ALIGN_PAYLOAD!=0
-        align = (long)wb->buf + SPP_RT_HEADER_LENGTH;
-        align = (-align)&(SSL3_ALIGN_PAYLOAD-1);
+        align = spp_payload_align(s, wb->buf, 1);
 #endif
         p = wb->buf + align;
         wb->offset  = align;
@@ -1083,22 +1181,13 @@ static int do_spp_write(SSL *s, int type, const unsigned char *buf,
     spp_print_buffer(wb->buf + wb->offset, SPP_RT_HEADER_LENGTH);
 #endif
     
-    /* Explicit IV length, block ciphers and TLS version 1.1 or later */
-    if (s->enc_write_ctx && s->version >= TLS1_1_VERSION) {
-        int mode = EVP_CIPHER_CTX_mode(s->enc_write_ctx);
-        if (mode == EVP_CIPH_CBC_MODE) {
-            eivlen = EVP_CIPHER_CTX_iv_length(s->enc_write_ctx);
-            if (eivlen <= 1)
-                eivlen = 0;
-        }
-        /* Need explicit part of IV for GCM mode */
-        else if (mode == EVP_CIPH_GCM_MODE)
-            eivlen = EVP_GCM_TLS_EXPLICIT_IV_LEN;
-        else
-            eivlen = 0;
-    } else {
-        eivlen = 0;
-    }
+    /* Slice records of an AEAD cipher suite, see spp_aead_seal() */
+    aead = spp_aead_slice(s, slice) && s->enc_write_ctx != NULL;
+    if (aead)
+        eivlen = SPP_AEAD_NONCE_LEN;
+    else
+        eivlen = spp_explicit_iv_len(s, s->enc_write_ctx);
+    SPP_TIMING_LAP(s, SPP_TIMING_WRITE_HEADER, t_stage);
 
     /* lets setup the record stuff. */
     wr->data=p + eivlen;
@@ -1123,6 +1212,7 @@ static int do_spp_write(SSL *s, int type, const unsigned char *buf,
         memcpy(wr->data,wr->input,wr->length);
         wr->input=wr->data;
     }
+    SPP_TIMING_LAP(s, SPP_TIMING_WRITE_COPY, t_stage);
 
     /* we should still have the output to wr->data and the input
      * from wr->input.  Length should be wr->length.
@@ -1132,6 +1222,8 @@ static int do_spp_write(SSL *s, int type, const unsigned char *buf,
         printf("Generating 3MAC\n");
 #endif
         s->write_stats.mac_bytes += mac_size*3;
+        mac_len = mac_size*3;
+        macs |= SPP_TRACE_MAC_READ;
         /* Must have read access, so write the read MAC. */
         spp_copy_mac_state(s, slice->read_mac, 1);
         if (s->method->ssl3_enc->mac(s,&(p[wr->length + eivlen]),1) < 0)
@@ -1145,6 +1237,7 @@ static int do_spp_write(SSL *s, int type, const unsigned char *buf,
             spp_copy_mac_state(s, slice->write_mac, 1);
             if (s->method->ssl3_enc->mac(s,&(p[wr->length + eivlen + mac_size]),1) < 0)
                 goto err;
+            macs |= SPP_TRACE_MAC_WRITE;
         } else {
             /* Copy from the previous record. */
             memcpy(&(p[wr->length + eivlen + mac_size]), spp_ctx->write_mac, mac_size);
@@ -1157,6 +1250,7 @@ static int do_spp_write(SSL *s, int type, const unsigned char *buf,
             spp_copy_mac_state(s, s->def_ctx->read_mac, 1);
             if (s->method->ssl3_enc->mac(s,&(p[wr->length + eivlen + (mac_size*2)]),1) < 0)
                 goto err;            
+            macs |= SPP_TRACE_MAC_INTEGRITY;
         } else {
             /* Copy from the previous record. */
             memcpy(&(p[wr->length + eivlen + (mac_size*2)]), spp_ctx->integrity_mac, mac_size);
@@ -1167,18 +1261,13 @@ static int do_spp_write(SSL *s, int type, const unsigned char *buf,
          * Instead of using a slice, use the parameters computed via the standard TLS handshake to 
          * both encrypt and generate MAC. */
         s->write_stats.mac_bytes += mac_size;
+        mac_len = mac_size;
+        macs |= SPP_TRACE_MAC_TLS;
         if (s->method->ssl3_enc->mac(s,&(p[wr->length + eivlen]),1) < 0)
             goto err;
 	wr->length+=mac_size;
     }
-    /* If we do not have read access, then the MACs were interpreted as part of the payload. */
-    if (spp_ctx != NULL) {
-        if (s->proxy) {
-            OPENSSL_free(spp_ctx->read_mac);
-        }
-        OPENSSL_free(spp_ctx);
-    }
-
+    SPP_TIMING_LAP(s, mac_len != 0 ? SPP_TIMING_WRITE_MAC : -1, t_stage);
     wr->input=p;
     wr->data=p;
 
@@ -1193,10 +1282,32 @@ static int do_spp_write(SSL *s, int type, const unsigned char *buf,
     spp_print_buffer(wr->data, wr->length);
 #endif
 
-    /* ssl3_enc can only have an error on read */
-    /* This is a call to spp_enc which will encrypt or not 
-     * depending upon whether we have the encryption material. */
-    s->method->ssl3_enc->enc(s,1);
+    if (aead) {
+        if (spp_aead_seal(s, slice, type, p, wr->length - eivlen, spp_ctx, &macs) <= 0)
+            goto err;
+        mac_len = 3*SPP_AEAD_TAG_LEN;
+        s->write_stats.mac_bytes += mac_len;
+        wr->length += mac_len;
+    } else {
+        /* ssl3_enc can only have an error on read */
+        /* This is a call to spp_enc which will encrypt or not 
+         * depending upon whether we have the encryption material. */
+        s->method->ssl3_enc->enc(s,1);
+        /* The TLS AEAD construction takes its nonce from the sequence
+         * number, which spp_copy_mac_state() resets for every record. Keep
+         * it moving with the peer's read sequence instead. The Finished
+         * message goes out without a slice, under the sequence number the
+         * default context was given at the ChangeCipherSpec, so carry on
+         * after it rather than use that number a second time. */
+        if (s->enc_write_ctx != NULL &&
+            (EVP_CIPHER_flags(EVP_CIPHER_CTX_cipher(s->enc_write_ctx)) & EVP_CIPH_FLAG_AEAD_CIPHER)) {
+            if (slice != NULL)
+                spp_copy_mac_back(s, slice->read_mac, 1);
+            else if (s->def_ctx->write_access)
+                spp_copy_mac_back(s, s->def_ctx->read_mac, 1);
+        }
+    }
+    SPP_TIMING_LAP(s, s->enc_write_ctx != NULL ? SPP_TIMING_WRITE_ENCRYPT : -1, t_stage);
 
 #ifdef DEBUG
     printf("Encrypted packet: ");
@@ -1204,6 +1315,12 @@ static int do_spp_write(SSL *s, int type, const unsigned char *buf,
 #endif
     
     s->write_stats.bytes += wr->length + SPP_RT_HEADER_LENGTH;
+    spp_stats_record(s, slice, SPP_STATS_WRITE, wr->length + SPP_RT_HEADER_LENGTH,
+                     len, mac_len, s->proxy && slice != NULL && s->enc_write_ctx == NULL);
+    if (SPP_TRACE_FLAGS(s) & SPP_TRACE_RECORDS)
+        spp_trace_record(s, 1, type, slice, len, wr->length + SPP_RT_HEADER_LENGTH, macs,
+                         s->proxy && slice != NULL && s->enc_write_ctx == NULL);
+    SPP_TIMING_LAP(s, SPP_TIMING_WRITE_RECORD, t_record);
     
     /* record length after mac and block padding */
     s2n(wr->length,plen);
@@ -1239,6 +1356,64 @@ err:
     return -1;
 }
 
+/* Release the MACs of a forwarded record, once all of it has been written. */
+void spp_free_write_ctx(SSL *s) {
+    SPP_CTX *spp_ctx = s->spp_write_ctx;
+
+    if (spp_ctx == NULL)
+        return;
+    if (s->proxy) {
+        OPENSSL_free(spp_ctx->read_mac);
+    }
+    OPENSSL_free(spp_ctx);
+    s->spp_write_ctx = NULL;
+}
+
+static unsigned long spp_time_ms(void) {
+#if defined(OPENSSL_SYS_WIN32)
+    struct _timeb tb;
+    _ftime(&tb);
+    return (unsigned long)tb.time*1000 + tb.millitm;
+#elif defined(OPENSSL_SYS_VMS)
+    struct timeb tb;
+    ftime(&tb);
+    return (unsigned long)tb.time*1000 + tb.millitm;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (unsigned long)tv.tv_sec*1000 + tv.tv_usec/1000;
+#endif
+}
+
+/* Number of bytes out of n to put into the next record. A record we
+ * forward can only be cut if we regenerate its MACs, i.e. we modified it
+ * and hold both the read and the write key of the slice. Otherwise the
+ * write and integrity MACs copied from the original record would no longer
+ * match and it has to go out as it came in. Everything else is cut at
+ * max_send_fragment, or at the small record size while the connection is
+ * fresh or has been idle (see SSL_CTX_set_spp_record_sizing()). */
+static unsigned int spp_record_size(SSL *s, int type, unsigned int n) {
+    SPP_SLICE *slice = s->write_slice;
+    unsigned int frag = s->max_send_fragment;
+    unsigned long now;
+
+    if (s->spp_write_ctx != NULL &&
+        (!s->spp_write_modified || slice == NULL ||
+         slice->read_ciph == NULL || slice->read_ciph->enc_write_ctx == NULL ||
+         slice->write_mac == NULL))
+        return n;
+
+    if (s->spp_record_small != 0 && type == SSL3_RT_APPLICATION_DATA) {
+        now = spp_time_ms();
+        if (s->spp_record_idle != 0 && now - s->spp_record_last >= s->spp_record_idle)
+            s->spp_record_sent = 0;
+        s->spp_record_last = now;
+        if (s->spp_record_sent < s->spp_record_boost && s->spp_record_small < frag)
+            frag = s->spp_record_small;
+    }
+    return n > frag ? frag : n;
+}
+
 /* This function is not actually changed from ssl3_write_bytes, 
  * but we need to change do_write, so we copy this here as well. */
 int spp_write_bytes(SSL *s, int type, const void *buf_, int len) {
@@ -1252,7 +1427,7 @@ int spp_write_bytes(SSL *s, int type, const void *buf_, int len) {
     s->s3->wnum=0;
 
     if (SSL_in_init(s) && !s->in_handshake) {
-	i=s->handshake_func(s);
+	i=ssl_run_handshake(s,s->handshake_func);
 	if (i < 0) return(i);
 	if (i == 0) {
             SSLerr(SSL_F_SSL3_WRITE_BYTES,SSL_R_SSL_HANDSHAKE_FAILURE);
@@ -1276,17 +1451,31 @@ int spp_write_bytes(SSL *s, int type, const void *buf_, int len) {
 
     n=(len-tot);
     for (;;) {
-	if (!s->proxy && n > s->max_send_fragment)
-            nw=s->max_send_fragment;
-        else
-            nw=n;
-
-        i=do_spp_write(s, type, &(buf[tot]), nw, 0);
+        /* What didn't go out of the last record or batch is finished
+         * before the next is sized: the size may have changed since (the
+         * idle timer), and ssl3_write_pending() needs at least the length
+         * the pending write was made for. */
+        if (s->s3->wbuf.left != 0)
+            i=ssl3_write_pending(s, type, &(buf[tot]), n);
+        else {
+            nw=spp_record_size(s, type, n);
+
+            /* Several full records worth of data: seal them as one
+             * batch. */
+            if (nw < n && nw == s->max_send_fragment && spp_can_write_large(s, type, n))
+                i=spp_write_large(s, type, &(buf[tot]), n);
+            else
+                i=do_spp_write(s, type, &(buf[tot]), nw, 0);
+        }
 	if (i <= 0) {
             s->s3->wnum=tot;
             return i;
 	}
+        if (type == SSL3_RT_APPLICATION_DATA)
+            s->spp_record_sent += i;
 
+	if (i == (int)n)
+            spp_free_write_ctx(s);
 	if ((i == (int)n) ||
             (type == SSL3_RT_APPLICATION_DATA &&
             (s->mode & SSL_MODE_ENABLE_PARTIAL_WRITE))) {
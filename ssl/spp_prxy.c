@@ -191,13 +191,17 @@ void spp_proxies_count(SSL *s, int *ahead, int *behind) {
  * The read and write calls provided by openssl for handshake messages 
  * are inconsistent in whether the 4 byte header is included or not. */
 int spp_forward_message(SSL *to, SSL*from) {
+    int ret;
     // When receiving a message, the helper functions automatically strip the header.
     // Meant, from->init_msg = &(init_buf->data[init_off])+4
     // So, keep the same pointer location into init_buf->data but increase the init_num value by 4.
     to->init_num = from->init_num + 4;
     to->init_off = from->init_off;
     memcpy(&(to->init_buf->data[to->init_off]), &(from->init_buf->data[from->init_off]), to->init_num);    
-    return(ssl3_do_write(to,SSL3_RT_HANDSHAKE));
+    to->spp_trace_forward = 1;
+    ret = ssl3_do_write(to,SSL3_RT_HANDSHAKE);
+    to->spp_trace_forward = 0;
+    return ret;
 }
 int spp_duplicate_message(SSL *to, SSL*from) {
     to->init_num = from->init_num;
@@ -209,6 +213,8 @@ int spp_duplicate_message(SSL *to, SSL*from) {
 /* Grab a handshake message from one state and forward it to the other. */
 int get_proxy_msg(SSL *s, int st1, int stn, int msg, int forward) {
     int n, ok;
+    /* The trace event consumes the middlebox the message belongs to. */
+    int proxy_id = s->spp_trace_proxy_id;
     n=s->method->ssl_get_message(s,
         st1,
         stn,
@@ -221,8 +227,10 @@ int get_proxy_msg(SSL *s, int st1, int stn, int msg, int forward) {
     printf("Got handshake message, len=%d, type=%d\n", n, s->s3->tmp.message_type);
     spp_print_buffer(s->init_msg, s->init_num);
 #endif
-    if (forward)
+    if (forward) {
+        s->other_ssl->spp_trace_proxy_id = proxy_id;
         return spp_forward_message(s->other_ssl, s);
+    }
     return 1;
 }
 
@@ -253,7 +261,9 @@ long spp_get_finished(SSL *s, int st1, int stn)
                 }
                 
                 // Forward the message along
+                s->other_ssl->spp_trace_forward = 1;
                 i=spp_duplicate_message(s->other_ssl, s);
+                s->other_ssl->spp_trace_forward = 0;
                 if (i<=0) goto err;
             }
             s->state=stn;
@@ -267,10 +277,12 @@ long spp_get_finished(SSL *s, int st1, int stn)
         // Send to opposite.
         // First, send change cipher spec
         s->other_ssl->state=SSL3_ST_CW_CHANGE_A;
+        s->other_ssl->spp_trace_forward = 1;
         i=ssl3_send_change_cipher_spec(s->other_ssl, SSL3_ST_CW_CHANGE_A, SSL3_ST_CW_CHANGE_B);
-        if (i<=0) goto err;
-        // Then send finished
-        i=spp_duplicate_message(s->other_ssl, s);
+        if (i > 0)
+            // Then send finished
+            i=spp_duplicate_message(s->other_ssl, s);
+        s->other_ssl->spp_trace_forward = 0;
         if (i<=0) goto err;
 
 	return s->init_num;
@@ -524,6 +536,7 @@ int get_proxy_material_ext(SSL *s, int server) {
     unsigned char *encrypted_key_mat; /* HACK size... */
     int n, shared_secret_len;
     unsigned char *shared_secret=NULL;
+    SPP_TIMER(pk_t);
     
     key_mat_envelope = d = (unsigned char *)s->init_msg;
     n = s->init_num;
@@ -573,6 +586,7 @@ int get_proxy_material_ext(SSL *s, int server) {
 
     //printf("opening envelope!\n");
 
+    SPP_PK_START(pk_t);
     key_mat_len = envelope_open(
         private_key,
         encrypted_key_mat,
@@ -584,6 +598,7 @@ int get_proxy_material_ext(SSL *s, int server) {
         &shared_secret,
         &shared_secret_len
         );
+    SPP_PK_END(s, SPP_PK_RSA_DECRYPT, 0, pk_t);
     
     /* Proxy actually has no reason to save the secret, cleanse and free */
     if (shared_secret != NULL) { 
@@ -910,6 +925,7 @@ int spp_proxy_accept(SSL *s) {
                                 #ifdef DEBUG
 				log_time("Sending proxy certificate\n", &currTime, &prevTime, &originTime); 
 				#endif
+                        s->spp_trace_proxy_id = next_st->spp_trace_proxy_id = s->proxy_id;
                         ret=ssl3_send_server_certificate(s); //OK
                         if (ret <= 0) goto end;
                         ret=spp_duplicate_message(next_st, s);
@@ -976,6 +992,7 @@ int spp_proxy_accept(SSL *s) {
                                 #ifdef DEBUG
 				log_time("Sending proxy key exchange\n", &currTime, &prevTime, &originTime); 
 				#endif
+                        s->spp_trace_proxy_id = next_st->spp_trace_proxy_id = s->proxy_id;
                         ret=ssl3_send_server_key_exchange(s); //OK
                         if (ret <= 0) goto end;
                         ret=spp_duplicate_message(next_st, s);
@@ -993,6 +1010,7 @@ int spp_proxy_accept(SSL *s) {
                                 #ifdef DEBUG
 				log_time("Sending proxy done\n", &currTime, &prevTime, &originTime); 
 				#endif
+                s->spp_trace_proxy_id = next_st->spp_trace_proxy_id = s->proxy_id;
                 ret=ssl3_send_server_done(s); //OK
                 if (ret <= 0) goto end;
                 ret=spp_duplicate_message(next_st, s);
@@ -1021,6 +1039,7 @@ int spp_proxy_accept(SSL *s) {
 				#endif
                 while (proxy != NULL) {
                     next_st->state=SPP_ST_PR_BEHIND_A;
+                    next_st->spp_trace_proxy_id = proxy->proxy_id;
                     ret=get_proxy_msg(next_st, SPP_ST_PR_BEHIND_A, SPP_ST_PR_BEHIND_B, -1, 1);
                                 #ifdef DEBUG
 				log_time("Proxy message received\n", &currTime, &prevTime, &originTime); 
@@ -1047,6 +1066,7 @@ int spp_proxy_accept(SSL *s) {
 				#endif
                 while (proxy != NULL) {
                     s->state=SPP_ST_PR_AHEAD_A;
+                    s->spp_trace_proxy_id = proxy->proxy_id;
                     ret=get_proxy_msg(s, SPP_ST_PR_AHEAD_A, SPP_ST_PR_AHEAD_B, -1, 1);
                                 #ifdef DEBUG
 				log_time("Proxy message received\n", &currTime, &prevTime, &originTime); 
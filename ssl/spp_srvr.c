@@ -408,6 +408,13 @@ int spp_accept(SSL *s) 	{
                                 #ifdef DEBUG
 				log_time("Checking for second client hello\n", &currTime, &prevTime, &originTime); 
 				#endif
+                /* Unless a client certificate was asked for, the message
+                 * looked at here is the first middlebox's certificate. */
+                if (!s->s3->tmp.cert_request) {
+                    SPP_PROXY *next = spp_get_next_proxy(s, proxy, 0);
+                    if (next != NULL)
+                        s->spp_trace_proxy_id = next->proxy_id;
+                }
                 ret = ssl3_check_client_hello(s);
                                 #ifdef DEBUG
 				log_time("Checked for second client hello\n", &currTime, &prevTime, &originTime); 
@@ -0,0 +1,553 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+#include "ssl_locl.h"
+
+/* SPP traffic counters.
+ *
+ * Every SSL counts its own records in read_stats/write_stats and, per
+ * slice, in SPP_SLICE.stats. Only the thread driving the SSL updates them,
+ * so they are plain 64 bit additions without locks or atomics. What a
+ * middlebox operator wants to see, however, is the traffic of all
+ * connections of a context broken down by slice. Each SSL therefore adds
+ * what it counted since the last time (kept in stats_folded) to the
+ * SSL_CTX totals every SPP_STATS_FOLD_RECORDS records, on SPP_fold_stats()
+ * and when it is freed. That takes CRYPTO_LOCK_SSL_CTX once per thousand
+ * records instead of once per record.
+ *
+ * So that a quiet connection doesn't go unseen until it closes, the
+ * SSL_CTX also lists its live SSLs and the getters add what each of them
+ * counted since it last folded. They read those counters while the
+ * threads driving the connections update them, so a figure can be a
+ * record behind, and the slices of a connection only count once its
+ * handshake is done and they are all there. */
+
+static void spp_stats_add_live(SPP_STATS *to, const SPP_STATS *now,
+                               const SPP_STATS *folded) {
+    to->records += now->records - folded->records;
+    to->bytes += now->bytes - folded->bytes;
+    to->app_bytes += now->app_bytes - folded->app_bytes;
+    to->pad_bytes += now->pad_bytes - folded->pad_bytes;
+    to->header_bytes += now->header_bytes - folded->header_bytes;
+    to->handshake_bytes += now->handshake_bytes - folded->handshake_bytes;
+    to->alert_bytes += now->alert_bytes - folded->alert_bytes;
+    to->mac_bytes += now->mac_bytes - folded->mac_bytes;
+    to->mac_failures += now->mac_failures - folded->mac_failures;
+    to->decrypt_failures += now->decrypt_failures - folded->decrypt_failures;
+    to->opaque_records += now->opaque_records - folded->opaque_records;
+}
+
+static void spp_stats_add_delta(SPP_STATS *to, SPP_STATS *now, SPP_STATS *folded) {
+    spp_stats_add_live(to, now, folded);
+    *folded = *now;
+}
+
+static void spp_stats_fold_slice(SSL_CTX *ctx, SPP_SLICE *slice) {
+    int i;
+
+    if (slice == NULL || slice->slice_id < 0 ||
+        slice->slice_id >= SPP_STATS_MAX_SLICES)
+        return;
+    for (i = 0; i < 2; i++)
+        spp_stats_add_delta(&ctx->spp_slice_stats[slice->slice_id][i],
+                            &slice->stats[i], &slice->stats_folded[i]);
+}
+
+static void spp_timing_merge(SPP_TIMING_HIST *to, const SPP_TIMING_HIST *from) {
+    int i;
+
+    if (from->count == 0)
+        return;
+    if (to->count == 0 || from->min < to->min)
+        to->min = from->min;
+    if (from->max > to->max)
+        to->max = from->max;
+    to->count += from->count;
+    to->sum += from->sum;
+    for (i = 0; i < SPP_TIMING_BUCKETS; i++)
+        to->buckets[i] += from->buckets[i];
+}
+
+/* Under CRYPTO_LOCK_SSL_CTX */
+static void spp_fold_stats_locked(SSL *s) {
+    SSL_CTX *ctx = s->ctx;
+    size_t i;
+
+    if (ctx->spp_slice_stats == NULL) {
+        ctx->spp_slice_stats = OPENSSL_malloc(SPP_STATS_MAX_SLICES *
+                                              sizeof(*ctx->spp_slice_stats));
+        if (ctx->spp_slice_stats != NULL)
+            memset(ctx->spp_slice_stats, 0,
+                   SPP_STATS_MAX_SLICES * sizeof(*ctx->spp_slice_stats));
+    }
+    spp_stats_add_delta(&ctx->spp_stats[SPP_STATS_READ], &s->read_stats,
+                        &s->stats_folded[SPP_STATS_READ]);
+    spp_stats_add_delta(&ctx->spp_stats[SPP_STATS_WRITE], &s->write_stats,
+                        &s->stats_folded[SPP_STATS_WRITE]);
+    if (ctx->spp_slice_stats != NULL) {
+        spp_stats_fold_slice(ctx, s->def_ctx);
+        for (i = 0; i < s->slices_len; i++)
+            spp_stats_fold_slice(ctx, s->slices[i]);
+    }
+    if (s->spp_timing != NULL) {
+        if (ctx->spp_timing == NULL &&
+            (ctx->spp_timing = OPENSSL_malloc(sizeof(SPP_TIMING))) != NULL)
+            memset(ctx->spp_timing, 0, sizeof(SPP_TIMING));
+        if (ctx->spp_timing != NULL) {
+            for (i = 0; i < SPP_TIMING_STAGES; i++)
+                spp_timing_merge(&ctx->spp_timing->stage[i],
+                                 &s->spp_timing->stage[i]);
+            memset(s->spp_timing, 0, sizeof(SPP_TIMING));
+        }
+    }
+}
+
+void SPP_fold_stats(SSL *s) {
+    if (s->ctx == NULL)
+        return;
+    CRYPTO_w_lock(CRYPTO_LOCK_SSL_CTX);
+    spp_fold_stats_locked(s);
+    CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CTX);
+}
+
+/* Puts s on the list of live connections of its SSL_CTX */
+void spp_stats_attach(SSL *s) {
+    SSL_CTX *ctx = s->ctx;
+
+    if (ctx == NULL)
+        return;
+    CRYPTO_w_lock(CRYPTO_LOCK_SSL_CTX);
+    s->spp_live_prev = NULL;
+    s->spp_live_next = ctx->spp_live;
+    if (ctx->spp_live != NULL)
+        ctx->spp_live->spp_live_prev = s;
+    ctx->spp_live = s;
+    CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CTX);
+}
+
+/* Folds the counters of s and takes it off the list */
+void spp_stats_detach(SSL *s) {
+    SSL_CTX *ctx = s->ctx;
+
+    if (ctx == NULL)
+        return;
+    CRYPTO_w_lock(CRYPTO_LOCK_SSL_CTX);
+    spp_fold_stats_locked(s);
+    if (s->spp_live_prev != NULL)
+        s->spp_live_prev->spp_live_next = s->spp_live_next;
+    else if (ctx->spp_live == s)
+        ctx->spp_live = s->spp_live_next;
+    if (s->spp_live_next != NULL)
+        s->spp_live_next->spp_live_prev = s->spp_live_prev;
+    s->spp_live_next = s->spp_live_prev = NULL;
+    CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CTX);
+}
+
+/* Adds the unfolded counters of slice to stats if it is slice_id, or to
+ * all[slice id] if all is not NULL. */
+static void spp_stats_live_slice(SPP_SLICE *slice, int slice_id,
+                                 int direction, SPP_STATS *stats,
+                                 SPP_STATS (*all)[2]) {
+    int i;
+
+    if (slice == NULL || slice->slice_id < 0 ||
+        slice->slice_id >= SPP_STATS_MAX_SLICES)
+        return;
+    if (all != NULL) {
+        for (i = 0; i < 2; i++)
+            spp_stats_add_live(&all[slice->slice_id][i], &slice->stats[i],
+                               &slice->stats_folded[i]);
+    } else if (slice->slice_id == slice_id)
+        spp_stats_add_live(stats, &slice->stats[direction],
+                           &slice->stats_folded[direction]);
+}
+
+/* Adds what the live connections of ctx counted since they last folded:
+ * to total (both directions) if it is not NULL, and to stats (slice_id in
+ * direction) or all slices. Under CRYPTO_LOCK_SSL_CTX. */
+static void spp_stats_live(SSL_CTX *ctx, SPP_STATS *total, int slice_id,
+                           int direction, SPP_STATS *stats,
+                           SPP_STATS (*all)[2]) {
+    SSL *s;
+    size_t i;
+
+    for (s = ctx->spp_live; s != NULL; s = s->spp_live_next) {
+        if (total != NULL) {
+            spp_stats_add_live(&total[SPP_STATS_READ], &s->read_stats,
+                               &s->stats_folded[SPP_STATS_READ]);
+            spp_stats_add_live(&total[SPP_STATS_WRITE], &s->write_stats,
+                               &s->stats_folded[SPP_STATS_WRITE]);
+        }
+        if ((stats == NULL && all == NULL) || SSL_in_init(s))
+            continue;
+        spp_stats_live_slice(s->def_ctx, slice_id, direction, stats, all);
+        for (i = 0; i < s->slices_len; i++)
+            spp_stats_live_slice(s->slices[i], slice_id, direction, stats,
+                                 all);
+    }
+}
+
+/* Account one record sent or received on slice (NULL if unknown). The
+ * connection wide byte counts are kept by the record layers themselves. */
+void spp_stats_record(SSL *s, SPP_SLICE *slice, int direction,
+                      unsigned int wire, unsigned int app, unsigned int mac,
+                      int opaque) {
+    SPP_STATS *st = direction == SPP_STATS_WRITE ? &s->write_stats : &s->read_stats;
+
+    st->records++;
+    if (opaque)
+        st->opaque_records++;
+    if (slice != NULL) {
+        SPP_STATS *sl = &slice->stats[direction];
+
+        sl->records++;
+        sl->bytes += wire;
+        sl->app_bytes += app;
+        sl->mac_bytes += mac;
+        if (opaque)
+            sl->opaque_records++;
+    }
+    if ((st->records & (SPP_STATS_FOLD_RECORDS - 1)) == 0)
+        SPP_fold_stats(s);
+}
+
+/* Account a received record that failed its MAC check (mac != 0) or could
+ * not be decrypted. */
+void spp_stats_failure(SSL *s, SPP_SLICE *slice, int mac) {
+    if (mac) {
+        s->read_stats.mac_failures++;
+        if (slice != NULL)
+            slice->stats[SPP_STATS_READ].mac_failures++;
+    } else {
+        s->read_stats.decrypt_failures++;
+        if (slice != NULL)
+            slice->stats[SPP_STATS_READ].decrypt_failures++;
+    }
+}
+
+/* Counters of one connection: all of its traffic for slice_id -1, that of
+ * one slice otherwise. Returns 0 for an unknown slice or direction. */
+int SPP_get_stats(const SSL *s, int slice_id, int direction, SPP_STATS *stats) {
+    SPP_SLICE *slice;
+
+    if (direction != SPP_STATS_READ && direction != SPP_STATS_WRITE)
+        return 0;
+    if (slice_id < 0) {
+        *stats = direction == SPP_STATS_WRITE ? s->write_stats : s->read_stats;
+        return 1;
+    }
+    if ((slice = SPP_get_slice_by_id((SSL *)s, slice_id)) == NULL)
+        return 0;
+    *stats = slice->stats[direction];
+    return 1;
+}
+
+/* Counters of all connections of ctx, the live ones included. */
+int SSL_CTX_get_spp_stats(SSL_CTX *ctx, int slice_id, int direction, SPP_STATS *stats) {
+    SPP_STATS total[2];
+
+    if (direction != SPP_STATS_READ && direction != SPP_STATS_WRITE)
+        return 0;
+    if (slice_id >= SPP_STATS_MAX_SLICES)
+        return 0;
+    CRYPTO_r_lock(CRYPTO_LOCK_SSL_CTX);
+    if (slice_id < 0) {
+        total[SPP_STATS_READ] = ctx->spp_stats[SPP_STATS_READ];
+        total[SPP_STATS_WRITE] = ctx->spp_stats[SPP_STATS_WRITE];
+        spp_stats_live(ctx, total, slice_id, direction, NULL, NULL);
+        *stats = total[direction];
+    } else {
+        if (ctx->spp_slice_stats != NULL)
+            *stats = ctx->spp_slice_stats[slice_id][direction];
+        else
+            memset(stats, 0, sizeof(*stats));
+        spp_stats_live(ctx, NULL, slice_id, direction, stats, NULL);
+    }
+    CRYPTO_r_unlock(CRYPTO_LOCK_SSL_CTX);
+    return 1;
+}
+
+/* All counters of ctx at once, consistent with each other. */
+SPP_STATS_SNAPSHOT *SSL_CTX_get_spp_stats_snapshot(SSL_CTX *ctx) {
+    SPP_STATS_SNAPSHOT *snap;
+    int i;
+
+    if ((snap = OPENSSL_malloc(sizeof(*snap))) == NULL) {
+        SSLerr(SSL_F_SSL_CTX_GET_SPP_STATS_SNAPSHOT, ERR_R_MALLOC_FAILURE);
+        return NULL;
+    }
+    memset(snap, 0, sizeof(*snap));
+    snap->time = (long)time(NULL);
+    CRYPTO_r_lock(CRYPTO_LOCK_SSL_CTX);
+    snap->total[SPP_STATS_READ] = ctx->spp_stats[SPP_STATS_READ];
+    snap->total[SPP_STATS_WRITE] = ctx->spp_stats[SPP_STATS_WRITE];
+    /* by slice id first, then only the slices seen */
+    if (ctx->spp_slice_stats != NULL)
+        memcpy(snap->slices, ctx->spp_slice_stats, sizeof(snap->slices));
+    spp_stats_live(ctx, snap->total, -1, 0, NULL, snap->slices);
+    CRYPTO_r_unlock(CRYPTO_LOCK_SSL_CTX);
+    for (i = 0; i < SPP_STATS_MAX_SLICES; i++) {
+        if (snap->slices[i][SPP_STATS_READ].records == 0 &&
+            snap->slices[i][SPP_STATS_WRITE].records == 0)
+            continue;
+        snap->slice_ids[snap->slices_len] = i;
+        snap->slices[snap->slices_len][SPP_STATS_READ] = snap->slices[i][SPP_STATS_READ];
+        snap->slices[snap->slices_len][SPP_STATS_WRITE] = snap->slices[i][SPP_STATS_WRITE];
+        snap->slices_len++;
+    }
+    return snap;
+}
+
+void SPP_STATS_SNAPSHOT_free(SPP_STATS_SNAPSHOT *snap) {
+    if (snap != NULL)
+        OPENSSL_free(snap);
+}
+
+/* Stage timing.
+ *
+ * The record layer marks the end of each stage with SPP_TIMING_LAP(), see
+ * ssl_locl.h, which lands here only if timing is on for the SSL. Samples
+ * go into histograms with power of two buckets kept with the SSL and are
+ * folded into the SSL_CTX along with the traffic counters. Ticks are TSC
+ * cycles where we can read the TSC cheaply and nanoseconds elsewhere. */
+
+#if (defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))) || \
+    (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)))
+#define SPP_TIMING_TSC
+#endif
+
+#ifndef OPENSSL_NO_SPP_TIMING
+SPP_COUNTER spp_timing_now(void) {
+#if defined(SPP_TIMING_TSC) && defined(_MSC_VER)
+    return __rdtsc();
+#elif defined(SPP_TIMING_TSC)
+    unsigned int lo, hi;
+
+    __asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+    return ((SPP_COUNTER)hi << 32) | lo;
+#elif defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (SPP_COUNTER)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#else
+    return (SPP_COUNTER)clock() * (1000000000 / CLOCKS_PER_SEC);
+#endif
+}
+
+static int spp_timing_bucket(SPP_COUNTER v) {
+    int i = 0;
+
+    if (v < 2)
+        return 0;
+#if defined(__GNUC__)
+    i = 63 - __builtin_clzll(v);
+#else
+    while (v >>= 1)
+        i++;
+#endif
+    return i;
+}
+
+void spp_timing_lap(SSL *s, int stage, SPP_COUNTER *timer) {
+    SPP_COUNTER now = spp_timing_now(), v = now - *timer;
+    SPP_TIMING_HIST *h;
+
+    *timer = now;
+    if (stage < 0)
+        return;
+    h = &s->spp_timing->stage[stage];
+    if (h->count == 0 || v < h->min)
+        h->min = v;
+    if (v > h->max)
+        h->max = v;
+    h->count++;
+    h->sum += v;
+    h->buckets[spp_timing_bucket(v)]++;
+}
+#endif
+
+/* Have new SSLs of ctx time their record layer stages. Returns 0 if
+ * timing was compiled out. */
+int SSL_CTX_set_spp_timing(SSL_CTX *ctx, int on) {
+#ifndef OPENSSL_NO_SPP_TIMING
+    ctx->spp_timing_on = on != 0;
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+int SSL_set_spp_timing(SSL *s, int on) {
+#ifndef OPENSSL_NO_SPP_TIMING
+    if (on && s->spp_timing == NULL) {
+        if ((s->spp_timing = OPENSSL_malloc(sizeof(SPP_TIMING))) == NULL)
+            return 0;
+        memset(s->spp_timing, 0, sizeof(SPP_TIMING));
+    } else if (!on && s->spp_timing != NULL) {
+        SPP_fold_stats(s);
+        OPENSSL_free(s->spp_timing);
+        s->spp_timing = NULL;
+    }
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+/* Stage histogram of all connections of ctx, as far as folded. */
+int SSL_CTX_get_spp_timing(SSL_CTX *ctx, int stage, SPP_TIMING_HIST *hist) {
+    if (stage < 0 || stage >= SPP_TIMING_STAGES)
+        return 0;
+    CRYPTO_r_lock(CRYPTO_LOCK_SSL_CTX);
+    if (ctx->spp_timing != NULL)
+        *hist = ctx->spp_timing->stage[stage];
+    else
+        memset(hist, 0, sizeof(*hist));
+    CRYPTO_r_unlock(CRYPTO_LOCK_SSL_CTX);
+    return 1;
+}
+
+void SSL_CTX_reset_spp_timing(SSL_CTX *ctx) {
+    CRYPTO_w_lock(CRYPTO_LOCK_SSL_CTX);
+    if (ctx->spp_timing != NULL)
+        memset(ctx->spp_timing, 0, sizeof(SPP_TIMING));
+    CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CTX);
+}
+
+const char *SPP_timing_stage_name(int stage) {
+    static const char *names[SPP_TIMING_STAGES] = {
+        "read header", "read slice", "read decrypt", "read mac",
+        "read expand", "read copy", "read record",
+        "write header", "write copy", "write mac", "write encrypt",
+        "write record"
+    };
+
+    if (stage < 0 || stage >= SPP_TIMING_STAGES)
+        return NULL;
+    return names[stage];
+}
+
+const char *SPP_timing_unit(void) {
+#ifdef SPP_TIMING_TSC
+    return "cycles";
+#else
+    return "ns";
+#endif
+}
+
+/* Upper bound of the bucket holding the p-th percentile (0 < p <= 100),
+ * capped at the largest sample. */
+SPP_COUNTER SPP_TIMING_HIST_percentile(const SPP_TIMING_HIST *hist, double p) {
+    SPP_COUNTER want, seen = 0, top;
+    int i;
+
+    if (hist->count == 0)
+        return 0;
+    want = (SPP_COUNTER)(p / 100 * (double)hist->count);
+    if (want == 0)
+        want = 1;
+    for (i = 0; i < SPP_TIMING_BUCKETS - 1; i++) {
+        seen += hist->buckets[i];
+        if (seen >= want)
+            break;
+    }
+    top = i == 0 ? 1 : (((SPP_COUNTER)2 << i) - 1);
+    return top < hist->max ? top : hist->max;
+}
+
+/* Public key operations.
+ *
+ * The handshake code wraps every public key operation in SPP_PK_START()
+ * and SPP_PK_END(), see ssl_locl.h. Each SSL keeps a count and the time
+ * taken per operation for every middlebox it did them for, in a short
+ * array grown as middleboxes turn up; a chain rarely has more than a
+ * handful. */
+
+void spp_pk_count(SSL *s, int op, int proxy_id, SPP_COUNTER start) {
+    CRYPTO_MEM_ARENA *arena;
+    SPP_PK_PROXY *p;
+    int i;
+
+    if (op < 0 || op >= SPP_PK_OPS)
+        return;
+    /* A middlebox's operations all use its own key */
+    if (s->proxy)
+        proxy_id = s->proxy_id;
+    for (i = 0; i < s->spp_pk_len; i++)
+        if (s->spp_pk[i].proxy_id == proxy_id)
+            break;
+    if (i == s->spp_pk_len) {
+        if (i > MAX_SPP_PROXIES)
+            return;
+        /* Accounting is a diagnostic, carry on without it if out of
+         * memory. It stays with the connection, out of the handshake's
+         * arena. */
+        arena = ssl_arena_leave(s);
+        p = OPENSSL_realloc(s->spp_pk, (i + 1) * sizeof(*p));
+        ssl_arena_enter(s, arena);
+        if (p == NULL)
+            return;
+        s->spp_pk = p;
+        memset(&p[i], 0, sizeof(*p));
+        p[i].proxy_id = proxy_id;
+        s->spp_pk_len++;
+    }
+    p = &s->spp_pk[i];
+    p->ops[op].count++;
+#ifndef OPENSSL_NO_SPP_TIMING
+    p->ops[op].time += spp_timing_now() - start;
+#endif
+}
+
+int spp_pk_sign_op(const EVP_PKEY *pkey, int verify) {
+    switch (pkey != NULL ? pkey->type : EVP_PKEY_NONE) {
+    case EVP_PKEY_RSA:
+        return verify ? SPP_PK_RSA_VERIFY : SPP_PK_RSA_SIGN;
+    case EVP_PKEY_DSA:
+        return verify ? SPP_PK_DSA_VERIFY : SPP_PK_DSA_SIGN;
+    case EVP_PKEY_EC:
+        return verify ? SPP_PK_ECDSA_VERIFY : SPP_PK_ECDSA_SIGN;
+    }
+    return SPP_PK_OTHER;
+}
+
+static void spp_pk_add(SPP_PK_STATS *stats, const SPP_PK_PROXY *from, int len) {
+    int i, j, op;
+
+    for (i = 0; i < len; i++) {
+        for (j = 0; j < stats->proxies_len; j++)
+            if (stats->proxies[j].proxy_id == from[i].proxy_id)
+                break;
+        if (j == stats->proxies_len) {
+            if (j > MAX_SPP_PROXIES)
+                continue;
+            stats->proxies[j].proxy_id = from[i].proxy_id;
+            stats->proxies_len++;
+        }
+        for (op = 0; op < SPP_PK_OPS; op++) {
+            stats->proxies[j].ops[op].count += from[i].ops[op].count;
+            stats->proxies[j].ops[op].time += from[i].ops[op].time;
+            stats->total[op].count += from[i].ops[op].count;
+            stats->total[op].time += from[i].ops[op].time;
+        }
+    }
+}
+
+/* Public key operations of the connection since SSL_new() or SSL_clear(),
+ * in total and per middlebox. On a middlebox either of its two SSLs gives
+ * those of both. Only the thread driving the connection may call this. */
+int SPP_get_pk_stats(const SSL *s, SPP_PK_STATS *stats) {
+    memset(stats, 0, sizeof(*stats));
+    if (s->proxy)
+        stats->role = SPP_PK_ROLE_PROXY;
+    else
+        stats->role = s->server ? SPP_PK_ROLE_SERVER : SPP_PK_ROLE_CLIENT;
+    spp_pk_add(stats, s->spp_pk, s->spp_pk_len);
+    if (s->proxy && s->other_ssl != NULL)
+        spp_pk_add(stats, s->other_ssl->spp_pk, s->other_ssl->spp_pk_len);
+    return 1;
+}
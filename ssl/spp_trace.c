@@ -0,0 +1,163 @@
+#include <stdio.h>
+#include <string.h>
+#include "ssl_locl.h"
+#include <openssl/bio.h>
+
+/* SPP trace events.
+ *
+ * The msg_callback sees the SPP handshake messages as plain handshake
+ * records: a middlebox's certificate looks like the server's and nothing
+ * says which middlebox a key material message is for. The trace callback
+ * gets one SPP_TRACE_EVENT per handshake message, with the middlebox it
+ * belongs to and whether it is being passed on, and optionally one per
+ * record with the slice and the MACs generated or checked.
+ *
+ * An SSL takes the SSL_CTX's callback when it is created or moved to
+ * another SSL_CTX, unless it has one of its own, so events are delivered
+ * without any locking; a middlebox that wants to switch tracing of its
+ * live connections keeps the callback installed and has it drop events.
+ * Without a callback an event costs a flag test. The SSL_CTX's callback
+ * and argument are set and read together under the SSL_CTX lock, so that
+ * other threads never pair one with the other's predecessor. */
+
+void SSL_CTX_set_spp_trace(SSL_CTX *ctx, int flags, SPP_TRACE_CB cb, void *arg) {
+    CRYPTO_w_lock(CRYPTO_LOCK_SSL_CTX);
+    ctx->spp_trace_cb = cb;
+    ctx->spp_trace_arg = arg;
+    ctx->spp_trace_flags = cb != NULL ? flags : 0;
+    CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CTX);
+}
+
+/* A NULL cb goes back to the SSL_CTX's callback. */
+void SSL_set_spp_trace(SSL *s, int flags, SPP_TRACE_CB cb, void *arg) {
+    s->spp_trace_own = cb != NULL;
+    if (cb == NULL) {
+        spp_trace_inherit(s);
+        return;
+    }
+    s->spp_trace_cb = cb;
+    s->spp_trace_arg = arg;
+    s->spp_trace_flags = flags;
+}
+
+/* Copy the SSL_CTX's callback into s, unless s has its own. */
+void spp_trace_inherit(SSL *s) {
+    if (s->spp_trace_own)
+        return;
+    CRYPTO_r_lock(CRYPTO_LOCK_SSL_CTX);
+    s->spp_trace_cb = s->ctx->spp_trace_cb;
+    s->spp_trace_arg = s->ctx->spp_trace_arg;
+    s->spp_trace_flags = s->ctx->spp_trace_flags;
+    CRYPTO_r_unlock(CRYPTO_LOCK_SSL_CTX);
+}
+
+static void spp_trace_deliver(SSL *s, SPP_TRACE_EVENT *ev) {
+    if (s->spp_trace_cb != NULL)
+        s->spp_trace_cb(s, ev, s->spp_trace_arg);
+}
+
+void spp_trace_message(SSL *s, int write_p, int content_type,
+                       const unsigned char *msg, size_t len) {
+    SPP_TRACE_EVENT ev;
+
+    memset(&ev, 0, sizeof(ev));
+    ev.type = SPP_TRACE_HANDSHAKE;
+    ev.write_p = write_p;
+    ev.content_type = content_type;
+    ev.msg_type = -1;
+    ev.slice_id = -1;
+    ev.proxy_id = s->spp_trace_proxy_id;
+    ev.forwarded = s->spp_trace_forward;
+    ev.length = len;
+    if (content_type == SSL3_RT_HANDSHAKE && len > 0) {
+        ev.msg_type = msg[0];
+        /* Key material names its middlebox (or the far endpoint) in the
+         * first byte after the message header. */
+        if (ev.msg_type == SPP_MT_PROXY_KEY_MATERIAL && len > 4)
+            ev.proxy_id = msg[4];
+    }
+    s->spp_trace_proxy_id = 0;
+    spp_trace_deliver(s, &ev);
+}
+
+void spp_trace_record(SSL *s, int write_p, int content_type, SPP_SLICE *slice,
+                      size_t len, size_t wire_len, int macs, int opaque) {
+    SPP_TRACE_EVENT ev;
+
+    memset(&ev, 0, sizeof(ev));
+    ev.type = SPP_TRACE_RECORDS;
+    ev.write_p = write_p;
+    ev.content_type = content_type;
+    ev.msg_type = -1;
+    ev.slice_id = slice != NULL ? slice->slice_id : -1;
+    ev.proxy_id = s->proxy_id;
+    ev.opaque = opaque;
+    ev.macs = macs;
+    ev.length = len;
+    ev.wire_length = wire_len;
+    spp_trace_deliver(s, &ev);
+}
+
+const char *SPP_trace_msg_name(int msg_type) {
+    switch (msg_type) {
+    case SSL3_MT_HELLO_REQUEST:         return "hello_request";
+    case SSL3_MT_CLIENT_HELLO:          return "client_hello";
+    case SSL3_MT_SERVER_HELLO:          return "server_hello";
+    case SSL3_MT_NEWSESSION_TICKET:     return "new_session_ticket";
+    case SSL3_MT_CERTIFICATE:           return "certificate";
+    case SSL3_MT_SERVER_KEY_EXCHANGE:   return "server_key_exchange";
+    case SSL3_MT_CERTIFICATE_REQUEST:   return "certificate_request";
+    case SSL3_MT_SERVER_DONE:           return "server_done";
+    case SSL3_MT_CERTIFICATE_VERIFY:    return "certificate_verify";
+    case SSL3_MT_CLIENT_KEY_EXCHANGE:   return "client_key_exchange";
+    case SSL3_MT_FINISHED:              return "finished";
+    case SPP_MT_PROXY_KEY_MATERIAL:     return "proxy_key_material";
+#ifndef OPENSSL_NO_NEXTPROTONEG
+    case SSL3_MT_NEXT_PROTO:            return "next_protocol";
+#endif
+    }
+    return "unknown";
+}
+
+/* A ready made callback, writes one line per event to the BIO passed as
+ * the callback argument. */
+void SPP_trace_print(const SSL *s, const SPP_TRACE_EVENT *ev, void *bio) {
+    BIO *b = (BIO *)bio;
+    char macs[32];
+
+    if (ev->type == SPP_TRACE_HANDSHAKE) {
+        if (ev->content_type == SSL3_RT_CHANGE_CIPHER_SPEC)
+            BIO_printf(b, "SPP %d %s change_cipher_spec len=%lu\n",
+                       s->proxy_id, ev->write_p ? ">>>" : "<<<",
+                       (unsigned long)ev->length);
+        else
+            BIO_printf(b, "SPP %d %s handshake %s%s len=%lu proxy=%d%s\n",
+                       s->proxy_id, ev->write_p ? ">>>" : "<<<",
+                       ev->proxy_id != 0 && ev->msg_type != SPP_MT_PROXY_KEY_MATERIAL ?
+                       "proxy " : "", SPP_trace_msg_name(ev->msg_type),
+                       (unsigned long)ev->length, ev->proxy_id,
+                       ev->forwarded ? " forwarded" : "");
+        return;
+    }
+    strcpy(macs, ev->macs & SPP_TRACE_MAC_TLS ? "tls" : "");
+    if (ev->macs & SPP_TRACE_MAC_READ)
+        strcat(macs, "R");
+    if (ev->macs & SPP_TRACE_MAC_WRITE)
+        strcat(macs, "W");
+    if (ev->macs & SPP_TRACE_MAC_INTEGRITY)
+        strcat(macs, "I");
+    if (ev->macs & (SPP_TRACE_MAC_READ_FAILED|SPP_TRACE_MAC_WRITE_FAILED|
+                    SPP_TRACE_MAC_INTEGRITY_FAILED))
+        strcat(macs, " failed=");
+    if (ev->macs & SPP_TRACE_MAC_READ_FAILED)
+        strcat(macs, "R");
+    if (ev->macs & SPP_TRACE_MAC_WRITE_FAILED)
+        strcat(macs, "W");
+    if (ev->macs & SPP_TRACE_MAC_INTEGRITY_FAILED)
+        strcat(macs, "I");
+    BIO_printf(b, "SPP %d %s record type=%d slice=%d len=%lu wire=%lu macs=%s%s\n",
+               s->proxy_id, ev->write_p ? ">>>" : "<<<", ev->content_type,
+               ev->slice_id, (unsigned long)ev->length,
+               (unsigned long)ev->wire_length, macs[0] ? macs : "none",
+               ev->opaque ? " opaque" : "");
+}
@@ -0,0 +1,962 @@
+/* ssl/sppbench.c */
+/*
+ * In-process SPP benchmark.
+ *
+ * Wires a client, 0-8 proxies and a server together inside one process and
+ * measures the protocol alone, without a network or tc shaped links in the
+ * way. Every node runs on its own thread; the hops between neighbours are
+ * BIO pairs (crypto/bio/bss_bio.c) or, with -socketpair, AF_UNIX stream
+ * socket pairs.
+ *
+ * For every configuration, -conns connections are made one after the other.
+ * Each connection does a full SPP handshake through the proxy chain, after
+ * which the server writes -bytes of application data in records of -record
+ * bytes, round robin over the slices, and the proxies forward it to the
+ * client. The client measures handshake time, time to first byte (from the
+ * start of the handshake), records and bytes per second.
+ *
+ * -proxies, -slices and -record take comma separated lists; every
+ * combination is run and reported as one line of JSON on stdout, so the
+ * output can be collected for regression tracking. -tls runs plain TLS over
+ * the same harness instead (without proxies) as a reference. -timing
+ * turns on the record layer stage timers (SSL_CTX_set_spp_timing()) and
+ * adds a line per node and stage with the distribution of its times.
+ *
+ * -threads runs that many chains side by side, each making -conns
+ * connections, for the scaling of the library under concurrent handshakes;
+ * connections_per_sec is over all chains and wall clock time. -rand drbg
+ * swaps md_rand for the per-thread CTR_DRBG (RAND_ctr_drbg()). The
+ * library's locks are the built-in reader/writer locks
+ * (CRYPTO_thread_setup_pthreads()); -lockstats adds a line per lock with
+ * its acquisitions, contended acquisitions and time waited.
+ *
+ * -memcache installs the library's per-thread allocator
+ * (CRYPTO_mem_cache_setup()) and adds the allocations per handshake of the
+ * client, all proxies together and the server to the report; -arena also
+ * serves the handshakes' small allocations from per-handshake arenas
+ * (SSL_MODE_HANDSHAKE_ARENA).
+ *
+ * usage: sppbench [-proxies 0,1,2] [-slices 1,4] [-record 1024,16384]
+ *                 [-threads 1,2,4] [-rproxies n] [-wproxies n] [-conns n]
+ *                 [-bytes n] [-cipher list] [-rand md|drbg] [-socketpair]
+ *                 [-tls] [-timing] [-lockstats] [-memcache] [-arena]
+ *                 [-cert file] [-dhparam file]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <openssl/ssl.h>
+#include <openssl/err.h>
+#include <openssl/pem.h>
+#include <openssl/bio.h>
+#include <openssl/rand.h>
+#ifndef OPENSSL_NO_ECDH
+#include <openssl/ec.h>
+#include <openssl/objects.h>
+#endif
+
+#if defined(OPENSSL_THREADS) && !defined(OPENSSL_SYS_WINDOWS) && !defined(OPENSSL_SYS_NETWARE) && !defined(OPENSSL_SYS_VMS)
+
+#include <pthread.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#define MAX_BENCH_PROXIES   8
+#define MAX_BENCH_LIST      16
+#define MAX_BENCH_THREADS   64
+#define BENCH_PAIR_SIZE     (64*1024)
+
+/* The envelopes carrying the proxies' key material only take RSA keys of
+ * up to 1024 bits, so the 2048 bit apps/server.pem cannot be used. */
+#define TEST_SERVER_CERT    "../evaluation/client_server/server.pem"
+#define TEST_DH_PARAM       "../apps/dh1024.pem"
+
+/* One hop between two neighbouring nodes. The two halves of a BIO pair
+ * share state, so both ends of a hop are serialised on one lock, and a
+ * reader (writer) that finds the pair empty (full) sleeps until its peer
+ * made progress instead of returning a retry, giving the blocking
+ * semantics the SPP handshake code expects. */
+typedef struct bench_link_st {
+    pthread_mutex_t lock;
+    pthread_cond_t progress;
+    int fd[2];                  /* -socketpair */
+    BIO *bio[2];                /* [0] client side end, [1] server side end */
+    int attached[2];
+} BENCH_LINK;
+
+typedef struct bench_config_st {
+    int tls;
+    int socketpair;
+    int proxies;
+    int slices;
+    int rproxies;
+    int wproxies;
+    int record;
+    int threads;
+    int conns;
+    long bytes;
+    const char *cipher;
+    const char *rand;
+    int timing;
+    int lockstats;
+    int memcache;
+    int arena;
+} BENCH_CONFIG;
+
+typedef struct bench_result_st {
+    double handshake;           /* seconds, summed over connections */
+    double ttfb;
+    double transfer;
+    long records;
+    long bytes;
+    int failed;
+    /* Public key operations and their time, summed over connections, of
+     * the client, all proxies together and the server */
+    SPP_COUNTER pk_ops[3];
+    SPP_COUNTER pk_time[3];
+    /* Allocations by the handshakes, likewise */
+    unsigned long allocs[3];
+} BENCH_RESULT;
+
+typedef struct bench_chain_st BENCH_CHAIN;
+
+typedef struct bench_node_st {
+    BENCH_CHAIN *chain;
+    int idx;
+} BENCH_NODE;
+
+/* A client, its proxies and server with the hops between them; -threads
+ * runs several, each on a thread of its own. */
+struct bench_chain_st {
+    BENCH_LINK links[MAX_BENCH_PROXIES+1];
+    BENCH_NODE nodes[MAX_BENCH_PROXIES+1];
+    BENCH_RESULT res;
+    pthread_t thread;
+};
+
+static BENCH_CONFIG *cfg;
+static char proxy_address[MAX_BENCH_PROXIES][16];
+static char server_address[] = "server";
+static SSL_CTX *client_ctx, *server_ctx, *proxy_ctx;
+
+static double now(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+/* BIO method wrapping one half of a hop's BIO pair. */
+
+static int link_write(BIO *b, const char *in, int inl);
+static int link_read(BIO *b, char *out, int outl);
+static int link_puts(BIO *b, const char *str);
+static long link_ctrl(BIO *b, int cmd, long num, void *ptr);
+static int link_new(BIO *b);
+static int link_free(BIO *b);
+
+static BIO_METHOD methods_link = {
+    BIO_TYPE_SOURCE_SINK,
+    "SPP benchmark link",
+    link_write,
+    link_read,
+    link_puts,
+    NULL,                       /* gets */
+    link_ctrl,
+    link_new,
+    link_free,
+    NULL,
+};
+
+typedef struct link_end_st {
+    BENCH_LINK *link;
+    BIO *half;
+} LINK_END;
+
+static int link_new(BIO *b)
+{
+    b->init = 0;
+    b->ptr = NULL;
+    b->flags = 0;
+    return 1;
+}
+
+static int link_free(BIO *b)
+{
+    LINK_END *end;
+
+    if (b == NULL || b->ptr == NULL)
+        return 0;
+    end = b->ptr;
+    pthread_mutex_lock(&end->link->lock);
+    BIO_free(end->half);
+    pthread_mutex_unlock(&end->link->lock);
+    OPENSSL_free(end);
+    b->ptr = NULL;
+    return 1;
+}
+
+static int link_read(BIO *b, char *out, int outl)
+{
+    LINK_END *end = b->ptr;
+    int ret;
+
+    BIO_clear_retry_flags(b);
+    pthread_mutex_lock(&end->link->lock);
+    for (;;) {
+        ret = BIO_read(end->half, out, outl);
+        if (ret > 0 || !BIO_should_retry(end->half))
+            break;
+        pthread_cond_wait(&end->link->progress, &end->link->lock);
+    }
+    pthread_cond_broadcast(&end->link->progress);
+    pthread_mutex_unlock(&end->link->lock);
+    return ret;
+}
+
+static int link_write(BIO *b, const char *in, int inl)
+{
+    LINK_END *end = b->ptr;
+    int ret;
+
+    BIO_clear_retry_flags(b);
+    pthread_mutex_lock(&end->link->lock);
+    for (;;) {
+        ret = BIO_write(end->half, in, inl);
+        if (ret > 0 || !BIO_should_retry(end->half))
+            break;
+        pthread_cond_wait(&end->link->progress, &end->link->lock);
+    }
+    pthread_cond_broadcast(&end->link->progress);
+    pthread_mutex_unlock(&end->link->lock);
+    return ret;
+}
+
+static int link_puts(BIO *b, const char *str)
+{
+    return link_write(b, str, strlen(str));
+}
+
+static long link_ctrl(BIO *b, int cmd, long num, void *ptr)
+{
+    LINK_END *end = b->ptr;
+    long ret;
+
+    switch (cmd) {
+    case BIO_CTRL_FLUSH:
+    case BIO_CTRL_DUP:
+        return 1;
+    case BIO_CTRL_GET_CLOSE:
+        return b->shutdown;
+    case BIO_CTRL_SET_CLOSE:
+        b->shutdown = (int)num;
+        return 1;
+    }
+    pthread_mutex_lock(&end->link->lock);
+    ret = BIO_ctrl(end->half, cmd, num, ptr);
+    pthread_cond_broadcast(&end->link->progress);
+    pthread_mutex_unlock(&end->link->lock);
+    return ret;
+}
+
+static BIO *link_end_bio(BENCH_LINK *link, BIO *half)
+{
+    BIO *b;
+    LINK_END *end;
+
+    if ((b = BIO_new(&methods_link)) == NULL)
+        return NULL;
+    if ((end = OPENSSL_malloc(sizeof(*end))) == NULL) {
+        BIO_free(b);
+        return NULL;
+    }
+    end->link = link;
+    end->half = half;
+    b->ptr = end;
+    b->init = 1;
+    b->shutdown = 1;
+    return b;
+}
+
+static int link_open(BENCH_LINK *link)
+{
+    BIO *half0, *half1;
+
+    link->bio[0] = link->bio[1] = NULL;
+    link->fd[0] = link->fd[1] = -1;
+    link->attached[0] = link->attached[1] = 0;
+    if (cfg->socketpair)
+        return socketpair(AF_UNIX, SOCK_STREAM, 0, link->fd) == 0;
+
+    pthread_mutex_init(&link->lock, NULL);
+    pthread_cond_init(&link->progress, NULL);
+    if (!BIO_new_bio_pair(&half0, BENCH_PAIR_SIZE, &half1, BENCH_PAIR_SIZE))
+        return 0;
+    link->bio[0] = link_end_bio(link, half0);
+    link->bio[1] = link_end_bio(link, half1);
+    return link->bio[0] != NULL && link->bio[1] != NULL;
+}
+
+/* Attach side (0 or 1) of a hop to s. The SSL takes the BIO over. */
+static void link_attach(SSL *s, BENCH_LINK *link, int side)
+{
+    if (cfg->socketpair)
+        SSL_set_fd(s, link->fd[side]);
+    else
+        SSL_set_bio(s, link->bio[side], link->bio[side]);
+    link->attached[side] = 1;
+}
+
+/* No more data from this side of the hop. Also used to pass a failure
+ * along the chain, so every node sees the end of its connection. */
+static void link_shutdown(BENCH_LINK *link, int side)
+{
+    if (cfg->socketpair)
+        shutdown(link->fd[side], SHUT_WR);
+    else
+        BIO_ctrl(link->bio[side], BIO_C_SHUTDOWN_WR, 0, NULL);
+}
+
+/* After all nodes are done and their SSLs freed. */
+static void link_close(BENCH_LINK *link)
+{
+    if (cfg->socketpair) {
+        close(link->fd[0]);
+        close(link->fd[1]);
+    } else {
+        if (link->bio[0] != NULL && !link->attached[0])
+            BIO_free(link->bio[0]);
+        if (link->bio[1] != NULL && !link->attached[1])
+            BIO_free(link->bio[1]);
+        pthread_cond_destroy(&link->progress);
+        pthread_mutex_destroy(&link->lock);
+    }
+}
+
+/* The nodes */
+
+static SSL *next_hop(SSL *s, char *address)
+{
+    BENCH_CHAIN *chain = SSL_get_app_data(s);
+    SSL *n;
+    int i;
+
+    if ((n = SSL_new(proxy_ctx)) == NULL)
+        return NULL;
+    for (i = 0; i < cfg->proxies; i++)
+        if (strcmp(address, proxy_address[i]) == 0)
+            break;
+    link_attach(n, &chain->links[i], 0);
+    return n;
+}
+
+static void *proxy_main(void *arg)
+{
+    BENCH_NODE *node = arg;
+    BENCH_LINK *links = node->chain->links;
+    int idx = node->idx;
+    SSL *s, *n = NULL;
+    SPP_SLICE *slice;
+    SPP_CTX *ctx;
+    char *buf;
+    int r;
+
+    /* Records of slices the proxy cannot read are handed over encrypted. */
+    buf = OPENSSL_malloc(SPP_RT_MAX_PACKET_SIZE);
+    s = SSL_new(proxy_ctx);
+    SSL_set_app_data(s, node->chain);
+    link_attach(s, &links[idx], 1);
+    if (buf == NULL || SPP_proxy(s, proxy_address[idx], next_hop, &n) <= 0 ||
+        n == NULL) {
+        ERR_print_errors_fp(stderr);
+        goto end;
+    }
+    /* Forward the server's data towards the client until it closes. */
+    while ((r = SPP_read_record(n, buf, SPP_RT_MAX_PACKET_SIZE,
+                                &slice, &ctx)) > 0) {
+        if (SPP_forward_record(s, buf, r, slice, ctx, 0) != r) {
+            ERR_print_errors_fp(stderr);
+            break;
+        }
+    }
+    SSL_shutdown(s);
+ end:
+    link_shutdown(&links[idx], 1);
+    link_shutdown(&links[idx+1], 0);
+    if (buf != NULL)
+        OPENSSL_free(buf);
+    return s;
+}
+
+static void *server_main(void *arg)
+{
+    BENCH_LINK *links = arg;
+    SSL *s;
+    char *buf;
+    long sent = 0;
+    int n, i = 0;
+
+    buf = OPENSSL_malloc(cfg->record);
+    s = SSL_new(server_ctx);
+    link_attach(s, &links[cfg->proxies], 1);
+    if (buf == NULL || SSL_accept(s) <= 0) {
+        ERR_print_errors_fp(stderr);
+        goto end;
+    }
+    memset(buf, 'x', cfg->record);
+    while (sent < cfg->bytes) {
+        n = cfg->bytes - sent > cfg->record ? cfg->record : cfg->bytes - sent;
+        if (cfg->tls)
+            n = SSL_write(s, buf, n);
+        else
+            n = SPP_write_record(s, buf, n, s->slices[i++ % s->slices_len]);
+        if (n <= 0) {
+            ERR_print_errors_fp(stderr);
+            goto end;
+        }
+        sent += n;
+    }
+    SSL_shutdown(s);
+ end:
+    link_shutdown(&links[cfg->proxies], 1);
+    if (buf != NULL)
+        OPENSSL_free(buf);
+    return s;
+}
+
+static int client_handshake(SSL *c)
+{
+    SPP_SLICE *slices[MAX_SPP_SLICES];
+    SPP_PROXY *proxies[MAX_BENCH_PROXIES+1];
+    int i;
+
+    if (cfg->tls)
+        return SSL_connect(c);
+
+    for (i = 0; i < cfg->proxies; i++)
+        proxies[i] = SPP_generate_proxy(c, proxy_address[i]);
+    proxies[cfg->proxies] = SPP_generate_proxy(c, server_address);
+    for (i = 0; i < cfg->slices; i++)
+        slices[i] = SPP_generate_slice(c, "bench");
+    for (i = 0; i < cfg->proxies; i++) {
+        if (i < cfg->rproxies)
+            SPP_assign_proxy_read_slices(c, proxies[i], slices, cfg->slices);
+        if (i < cfg->wproxies)
+            SPP_assign_proxy_write_slices(c, proxies[i], slices, cfg->slices);
+    }
+    return SPP_connect(c, slices, cfg->slices, proxies, cfg->proxies+1);
+}
+
+static void add_pk_stats(BENCH_RESULT *res, SSL *s)
+{
+    SPP_PK_STATS st;
+    int op;
+
+    SPP_get_pk_stats(s, &st);
+    for (op = 0; op < SPP_PK_OPS; op++) {
+        res->pk_ops[st.role] += st.total[op].count;
+        res->pk_time[st.role] += st.total[op].time;
+    }
+}
+
+static void add_mem_stats(BENCH_RESULT *res, SSL *s, int role)
+{
+    CRYPTO_MEM_STATS st;
+
+    SSL_get_handshake_mem_stats(s, &st);
+    res->allocs[role] += st.allocs;
+}
+
+static int run_connection(BENCH_CHAIN *chain)
+{
+    BENCH_LINK *links = chain->links;
+    BENCH_RESULT *res = &chain->res;
+    pthread_t threads[MAX_BENCH_PROXIES+1];
+    void *ssl[MAX_BENCH_PROXIES+1];
+    SSL *c = NULL;
+    SPP_SLICE *slice;
+    SPP_CTX *ctx;
+    char *buf = NULL;
+    double t0, t1, t2 = 0;
+    long got = 0;
+    int i, r, ok = 0;
+
+    for (i = 0; i <= cfg->proxies; i++)
+        if (!link_open(&links[i]))
+            return 0;
+    for (i = 0; i < cfg->proxies; i++) {
+        chain->nodes[i].chain = chain;
+        chain->nodes[i].idx = i;
+        pthread_create(&threads[i], NULL, proxy_main, &chain->nodes[i]);
+    }
+    pthread_create(&threads[cfg->proxies], NULL, server_main, links);
+
+    buf = OPENSSL_malloc(SSL3_RT_MAX_PLAIN_LENGTH);
+    c = SSL_new(client_ctx);
+    link_attach(c, &links[0], 0);
+
+    t0 = now();
+    if (buf == NULL || client_handshake(c) <= 0) {
+        ERR_print_errors_fp(stderr);
+        link_shutdown(&links[0], 0);
+        goto join;
+    }
+    t1 = now();
+    while (got < cfg->bytes) {
+        if (cfg->tls)
+            r = SSL_read(c, buf, SSL3_RT_MAX_PLAIN_LENGTH);
+        else
+            r = SPP_read_record(c, buf, SSL3_RT_MAX_PLAIN_LENGTH, &slice, &ctx);
+        if (r <= 0)
+            break;
+        if (got == 0)
+            t2 = now();
+        got += r;
+        res->records++;
+    }
+    res->handshake += t1 - t0;
+    if (got > 0) {
+        res->ttfb += t2 - t0;
+        res->transfer += now() - t2;
+    }
+    res->bytes += got;
+    ok = (got == cfg->bytes);
+    /* Leave the proxies nothing to wait for in the other direction. */
+    link_shutdown(&links[0], 0);
+
+ join:
+    for (i = 0; i <= cfg->proxies; i++) {
+        SSL *s, *n;
+
+        pthread_join(threads[i], &ssl[i]);
+        if ((s = ssl[i]) == NULL)
+            continue;
+        add_pk_stats(res, s);
+        /* A proxy's handshake drives that of its other SSL, so s counts
+         * the allocations of both. */
+        add_mem_stats(res, s, i < cfg->proxies ? SPP_PK_ROLE_PROXY
+                                               : SPP_PK_ROLE_SERVER);
+        /* A proxy's two connections share one session. */
+        if (i < cfg->proxies && (n = s->other_ssl) != NULL) {
+            if (n->session == s->session)
+                n->session = NULL;
+            SSL_free(n);
+        }
+        SSL_free(s);
+    }
+    add_pk_stats(res, c);
+    add_mem_stats(res, c, SPP_PK_ROLE_CLIENT);
+    SSL_free(c);
+    if (buf != NULL)
+        OPENSSL_free(buf);
+    for (i = 0; i <= cfg->proxies; i++)
+        link_close(&links[i]);
+    return ok;
+}
+
+static void *chain_main(void *arg)
+{
+    BENCH_CHAIN *chain = arg;
+    int c;
+
+    for (c = 0; c < cfg->conns; c++)
+        if (!run_connection(chain))
+            chain->res.failed++;
+    return NULL;
+}
+
+/* Runs cfg->threads chains and sums their results into res; returns the
+ * wall clock time taken */
+static double run_chains(BENCH_RESULT *res)
+{
+    BENCH_CHAIN *chains;
+    double t0;
+    int i, op;
+
+    memset(res, 0, sizeof(*res));
+    if ((chains = OPENSSL_malloc(cfg->threads * sizeof(*chains))) == NULL) {
+        res->failed = cfg->conns * cfg->threads;
+        return 0;
+    }
+    memset(chains, 0, cfg->threads * sizeof(*chains));
+    t0 = now();
+    for (i = 0; i < cfg->threads; i++)
+        pthread_create(&chains[i].thread, NULL, chain_main, &chains[i]);
+    for (i = 0; i < cfg->threads; i++)
+        pthread_join(chains[i].thread, NULL);
+    t0 = now() - t0;
+
+    for (i = 0; i < cfg->threads; i++) {
+        BENCH_RESULT *r = &chains[i].res;
+
+        res->handshake += r->handshake;
+        res->ttfb += r->ttfb;
+        res->transfer += r->transfer;
+        res->records += r->records;
+        res->bytes += r->bytes;
+        res->failed += r->failed;
+        for (op = 0; op < 3; op++) {
+            res->pk_ops[op] += r->pk_ops[op];
+            res->pk_time[op] += r->pk_time[op];
+            res->allocs[op] += r->allocs[op];
+        }
+    }
+    OPENSSL_free(chains);
+    return t0;
+}
+
+/* Public key operations and allocations count for failed connections too */
+static double per_conn(SPP_COUNTER v)
+{
+    int conns = cfg->conns * cfg->threads;
+
+    return conns > 0 ? (double)v / conns : 0;
+}
+
+/* Per connection figures are averages over all chains; with -threads above
+ * 1, handshakes_per_sec is the rate of one chain and connections_per_sec
+ * that of all of them together. */
+static void report(BENCH_RESULT *res, double wall)
+{
+    int conns = cfg->conns * cfg->threads;
+    int done = conns - res->failed;
+
+    printf("{\"mode\":\"%s\",\"transport\":\"%s\",\"proxies\":%d,"
+           "\"slices\":%d,\"read_proxies\":%d,\"write_proxies\":%d,"
+           "\"record\":%d,\"cipher\":\"%s\",\"rand\":\"%s\","
+           "\"threads\":%d,\"connections\":%d,"
+           "\"failed\":%d,\"bytes\":%ld,\"records\":%ld,"
+           "\"connections_per_sec\":%.2f,"
+           "\"handshakes_per_sec\":%.2f,\"handshake_ms\":%.3f,"
+           "\"ttfb_ms\":%.3f,\"records_per_sec\":%.1f,"
+           "\"bytes_per_sec\":%.0f,\"pk_ops_client\":%.1f,"
+           "\"pk_ops_proxies\":%.1f,\"pk_ops_server\":%.1f,"
+           "\"pk_time_client\":%.0f,\"pk_time_proxies\":%.0f,"
+           "\"pk_time_server\":%.0f,\"pk_time_unit\":\"%s\","
+           "\"allocator\":\"%s\",\"allocs_client\":%.1f,"
+           "\"allocs_proxies\":%.1f,\"allocs_server\":%.1f}\n",
+           cfg->tls ? "tls" : "spp",
+           cfg->socketpair ? "socketpair" : "biopair",
+           cfg->proxies, cfg->tls ? 0 : cfg->slices,
+           cfg->rproxies < cfg->proxies ? cfg->rproxies : cfg->proxies,
+           cfg->wproxies < cfg->proxies ? cfg->wproxies : cfg->proxies,
+           cfg->record, cfg->cipher, cfg->rand, cfg->threads, conns,
+           res->failed, res->bytes, res->records,
+           wall > 0 ? done / wall : 0,
+           res->handshake > 0 ? done / res->handshake : 0,
+           done > 0 ? res->handshake * 1000 / done : 0,
+           done > 0 ? res->ttfb * 1000 / done : 0,
+           res->transfer > 0 ? res->records / res->transfer : 0,
+           res->transfer > 0 ? res->bytes / res->transfer : 0,
+           per_conn(res->pk_ops[SPP_PK_ROLE_CLIENT]),
+           per_conn(res->pk_ops[SPP_PK_ROLE_PROXY]),
+           per_conn(res->pk_ops[SPP_PK_ROLE_SERVER]),
+           per_conn(res->pk_time[SPP_PK_ROLE_CLIENT]),
+           per_conn(res->pk_time[SPP_PK_ROLE_PROXY]),
+           per_conn(res->pk_time[SPP_PK_ROLE_SERVER]),
+           SPP_timing_unit(),
+           cfg->arena ? "arena" : cfg->memcache ? "cache" : "system",
+           per_conn(res->allocs[SPP_PK_ROLE_CLIENT]),
+           per_conn(res->allocs[SPP_PK_ROLE_PROXY]),
+           per_conn(res->allocs[SPP_PK_ROLE_SERVER]));
+    fflush(stdout);
+}
+
+static void report_timing(const char *node, SSL_CTX *ctx)
+{
+    SPP_TIMING_HIST h;
+    int i;
+
+    if (ctx == NULL)
+        return;
+    for (i = 0; i < SPP_TIMING_STAGES; i++) {
+        if (!SSL_CTX_get_spp_timing(ctx, i, &h) || h.count == 0)
+            continue;
+        printf("{\"node\":\"%s\",\"stage\":\"%s\",\"unit\":\"%s\","
+               "\"count\":%llu,\"mean\":%.1f,\"min\":%llu,\"p50\":%llu,"
+               "\"p90\":%llu,\"p99\":%llu,\"max\":%llu}\n",
+               node, SPP_timing_stage_name(i), SPP_timing_unit(),
+               (unsigned long long)h.count, (double)h.sum / h.count,
+               (unsigned long long)h.min,
+               (unsigned long long)SPP_TIMING_HIST_percentile(&h, 50),
+               (unsigned long long)SPP_TIMING_HIST_percentile(&h, 90),
+               (unsigned long long)SPP_TIMING_HIST_percentile(&h, 99),
+               (unsigned long long)h.max);
+    }
+    SSL_CTX_reset_spp_timing(ctx);
+    fflush(stdout);
+}
+
+static void report_lock(const char *name, int type)
+{
+    CRYPTO_LOCK_STATS st;
+
+    if (!CRYPTO_lock_stats(type, &st) || st.read + st.write == 0)
+        return;
+    printf("{\"lock\":\"%s\",\"read\":%lu,\"write\":%lu,"
+           "\"contended\":%lu,\"wait_ms\":%.3f,\"max_wait_ms\":%.3f}\n",
+           name, st.read, st.write, st.contended, st.wait * 1000,
+           st.max_wait * 1000);
+}
+
+static void report_locks(void)
+{
+    int i;
+
+    for (i = 0; i < CRYPTO_num_locks(); i++)
+        report_lock(CRYPTO_get_lock_name(i), i);
+    report_lock("dynamic", -1);
+    CRYPTO_lock_stats_reset();
+    fflush(stdout);
+}
+
+static SSL_CTX *make_ctx(const SSL_METHOD *meth, const char *cert,
+                         const char *dhparam)
+{
+    SSL_CTX *ctx;
+    BIO *in;
+    DH *dh;
+#ifndef OPENSSL_NO_ECDH
+    EC_KEY *ecdh;
+#endif
+
+    if ((ctx = SSL_CTX_new(meth)) == NULL)
+        return NULL;
+    if (!SSL_CTX_set_cipher_list(ctx, cfg->cipher) ||
+        !SSL_CTX_use_certificate_chain_file(ctx, cert) ||
+        !SSL_CTX_use_PrivateKey_file(ctx, cert, SSL_FILETYPE_PEM)) {
+        SSL_CTX_free(ctx);
+        return NULL;
+    }
+    if ((in = BIO_new_file(dhparam, "r")) != NULL) {
+        if ((dh = PEM_read_bio_DHparams(in, NULL, NULL, NULL)) != NULL) {
+            SSL_CTX_set_tmp_dh(ctx, dh);
+            DH_free(dh);
+        }
+        BIO_free(in);
+    }
+#ifndef OPENSSL_NO_ECDH
+    /* The ECDHE suites need a curve, take the one s_server defaults to */
+    if ((ecdh = EC_KEY_new_by_curve_name(NID_X9_62_prime256v1)) != NULL) {
+        SSL_CTX_set_tmp_ecdh(ctx, ecdh);
+        EC_KEY_free(ecdh);
+    }
+#endif
+    return ctx;
+}
+
+/* Does not allocate: the allocator can only be swapped before the
+ * library's first allocation. */
+static int parse_list(const char *arg, int *list)
+{
+    char *end;
+    int n = 0;
+
+    while (*arg != '\0' && n < MAX_BENCH_LIST) {
+        list[n++] = (int)strtol(arg, &end, 10);
+        arg = *end == ',' ? end + 1 : end + strlen(end);
+    }
+    return n;
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: sppbench [options]\n");
+    fprintf(stderr, " -proxies n,..  - number of proxies, 0-%d (default 1)\n", MAX_BENCH_PROXIES);
+    fprintf(stderr, " -slices n,..   - number of slices (default 1)\n");
+    fprintf(stderr, " -record n,..   - application write size (default 16384)\n");
+    fprintf(stderr, " -threads n,..  - chains run side by side, 1-%d (default 1)\n", MAX_BENCH_THREADS);
+    fprintf(stderr, " -rproxies n    - proxies with read access (default all)\n");
+    fprintf(stderr, " -wproxies n    - proxies with write access (default 0)\n");
+    fprintf(stderr, " -conns n       - connections per configuration (default 10)\n");
+    fprintf(stderr, " -bytes n       - bytes sent by the server per connection (default 1048576)\n");
+    fprintf(stderr, " -cipher list   - cipher list (default DHE-RSA-AES128-SHA256)\n");
+    fprintf(stderr, " -rand md|drbg  - md_rand or the per-thread CTR_DRBG (default md)\n");
+    fprintf(stderr, " -socketpair    - use socket pairs instead of BIO pairs\n");
+    fprintf(stderr, " -tls           - plain TLS instead of SPP (no proxies)\n");
+    fprintf(stderr, " -timing        - report per stage record layer timings\n");
+    fprintf(stderr, " -lockstats     - report acquisitions and waits per library lock\n");
+    fprintf(stderr, " -memcache      - per-thread allocator, report allocations per handshake\n");
+    fprintf(stderr, " -arena         - -memcache with per-handshake arenas\n");
+    fprintf(stderr, " -cert file     - certificate and key of every node (default %s)\n", TEST_SERVER_CERT);
+    fprintf(stderr, " -dhparam file  - DH parameters (default %s)\n", TEST_DH_PARAM);
+}
+
+int main(int argc, char *argv[])
+{
+    BENCH_CONFIG config;
+    BENCH_RESULT res;
+    int proxies[MAX_BENCH_LIST] = { 1 }, nproxies = 1;
+    int slices[MAX_BENCH_LIST] = { 1 }, nslices = 1;
+    int records[MAX_BENCH_LIST] = { 16384 }, nrecords = 1;
+    int threads[MAX_BENCH_LIST] = { 1 }, nthreads = 1;
+    const char *cert = TEST_SERVER_CERT, *dhparam = TEST_DH_PARAM;
+    double wall;
+    int i, j, k, t, failed = 0;
+
+    memset(&config, 0, sizeof(config));
+    config.rproxies = MAX_BENCH_PROXIES;
+    config.conns = 10;
+    config.bytes = 1024*1024;
+    config.cipher = "DHE-RSA-AES128-SHA256";
+    config.rand = "md";
+    cfg = &config;
+
+    for (argc--, argv++; argc > 0; argc--, argv++) {
+        if (strcmp(*argv, "-socketpair") == 0)
+            config.socketpair = 1;
+        else if (strcmp(*argv, "-timing") == 0)
+            config.timing = 1;
+        else if (strcmp(*argv, "-tls") == 0)
+            config.tls = 1;
+        else if (strcmp(*argv, "-lockstats") == 0)
+            config.lockstats = 1;
+        else if (strcmp(*argv, "-memcache") == 0)
+            config.memcache = 1;
+        else if (strcmp(*argv, "-arena") == 0)
+            config.memcache = config.arena = 1;
+        else if (argc < 2)
+            goto bad;
+        else if (strcmp(*argv, "-proxies") == 0)
+            nproxies = parse_list(*++argv, proxies), argc--;
+        else if (strcmp(*argv, "-slices") == 0)
+            nslices = parse_list(*++argv, slices), argc--;
+        else if (strcmp(*argv, "-record") == 0)
+            nrecords = parse_list(*++argv, records), argc--;
+        else if (strcmp(*argv, "-threads") == 0)
+            nthreads = parse_list(*++argv, threads), argc--;
+        else if (strcmp(*argv, "-rproxies") == 0)
+            config.rproxies = atoi(*++argv), argc--;
+        else if (strcmp(*argv, "-wproxies") == 0)
+            config.wproxies = atoi(*++argv), argc--;
+        else if (strcmp(*argv, "-conns") == 0)
+            config.conns = atoi(*++argv), argc--;
+        else if (strcmp(*argv, "-bytes") == 0)
+            config.bytes = atol(*++argv), argc--;
+        else if (strcmp(*argv, "-cipher") == 0)
+            config.cipher = *++argv, argc--;
+        else if (strcmp(*argv, "-rand") == 0)
+            config.rand = *++argv, argc--;
+        else if (strcmp(*argv, "-cert") == 0)
+            cert = *++argv, argc--;
+        else if (strcmp(*argv, "-dhparam") == 0)
+            dhparam = *++argv, argc--;
+        else
+            goto bad;
+    }
+    if (config.tls) {
+        proxies[0] = 0;
+        nproxies = 1;
+        nslices = 1;
+    }
+    for (i = 0; i < nproxies; i++)
+        if (proxies[i] < 0 || proxies[i] > MAX_BENCH_PROXIES)
+            goto bad;
+    for (i = 0; i < nslices; i++)
+        if (slices[i] < 1 || slices[i] > MAX_SPP_SLICES)
+            goto bad;
+    for (i = 0; i < nrecords; i++)
+        if (records[i] < 1)
+            goto bad;
+    for (i = 0; i < nthreads; i++)
+        if (threads[i] < 1 || threads[i] > MAX_BENCH_THREADS)
+            goto bad;
+    if (strcmp(config.rand, "md") != 0 && strcmp(config.rand, "drbg") != 0)
+        goto bad;
+    if (config.conns < 1 || config.bytes < 1)
+        goto bad;
+
+    /* Before anything is allocated */
+    if (config.memcache && !CRYPTO_mem_cache_setup()) {
+        fprintf(stderr, "cannot install the per-thread allocator\n");
+        return 1;
+    }
+    SSL_library_init();
+    SSL_load_error_strings();
+    if (strcmp(config.rand, "drbg") == 0)
+        RAND_set_rand_method(RAND_ctr_drbg());
+    /* The nodes share the SSL_CTXs, so the library needs real locks */
+    if (!CRYPTO_thread_setup_pthreads(config.lockstats ?
+                                      CRYPTO_PTHREADS_LOCK_STATS : 0))
+        return 1;
+
+    for (i = 0; i < MAX_BENCH_PROXIES; i++)
+        BIO_snprintf(proxy_address[i], sizeof(proxy_address[i]), "proxy%d", i);
+    if (config.tls) {
+        client_ctx = SSL_CTX_new(SSLv23_client_method());
+        server_ctx = make_ctx(SSLv23_server_method(), cert, dhparam);
+        if (client_ctx != NULL)
+            SSL_CTX_set_cipher_list(client_ctx, config.cipher);
+    } else {
+        /* Key material for the proxies is sealed to the client's key too. */
+        client_ctx = make_ctx(SPP_method(), cert, dhparam);
+        server_ctx = make_ctx(SPP_method(), cert, dhparam);
+        proxy_ctx = make_ctx(SPP_proxy_method(), cert, dhparam);
+        if (proxy_ctx == NULL)
+            server_ctx = NULL;
+    }
+    if (client_ctx == NULL || server_ctx == NULL) {
+        ERR_print_errors_fp(stderr);
+        return 1;
+    }
+    if (config.timing && !config.tls &&
+        (!SSL_CTX_set_spp_timing(client_ctx, 1) ||
+         !SSL_CTX_set_spp_timing(server_ctx, 1) ||
+         !SSL_CTX_set_spp_timing(proxy_ctx, 1))) {
+        fprintf(stderr, "stage timing was compiled out (no-spp-timing)\n");
+        return 1;
+    }
+    if (config.arena) {
+        SSL_CTX_set_mode(client_ctx, SSL_MODE_HANDSHAKE_ARENA);
+        SSL_CTX_set_mode(server_ctx, SSL_MODE_HANDSHAKE_ARENA);
+        if (proxy_ctx != NULL)
+            SSL_CTX_set_mode(proxy_ctx, SSL_MODE_HANDSHAKE_ARENA);
+    }
+
+    CRYPTO_lock_stats_reset();
+    for (i = 0; i < nproxies; i++)
+        for (j = 0; j < nslices; j++)
+            for (k = 0; k < nrecords; k++)
+                for (t = 0; t < nthreads; t++) {
+                    config.proxies = proxies[i];
+                    config.slices = slices[j];
+                    config.record = records[k];
+                    config.threads = threads[t];
+                    wall = run_chains(&res);
+                    report(&res, wall);
+                    if (config.timing && !config.tls) {
+                        report_timing("client", client_ctx);
+                        report_timing("proxy", proxy_ctx);
+                        report_timing("server", server_ctx);
+                    }
+                    if (config.lockstats)
+                        report_locks();
+                    failed += res.failed;
+                }
+
+    SSL_CTX_free(client_ctx);
+    SSL_CTX_free(server_ctx);
+    if (proxy_ctx != NULL)
+        SSL_CTX_free(proxy_ctx);
+    ERR_free_strings();
+    EVP_cleanup();
+    RAND_cleanup();
+    CRYPTO_thread_cleanup_pthreads();
+    return failed ? 1 : 0;
+
+ bad:
+    usage();
+    return 1;
+}
+
+#else                           /* OPENSSL_THREADS */
+
+int main(int argc, char *argv[])
+{
+    fprintf(stderr, "sppbench needs POSIX threads\n");
+    return 0;
+}
+#endif
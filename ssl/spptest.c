@@ -0,0 +1,556 @@
+/* ssl/spptest.c */
+/*
+ * SPP record layer tests.
+ *
+ * Sets up a client, one proxy and a server over AF_UNIX socket pairs, runs
+ * the handshakes on threads and then drives the records from the main
+ * thread: the kernel buffers every hop, so a record can be written, read
+ * and forwarded by the nodes one after the other.
+ *
+ * The proxy can read and write slice 1, only read slice 2 and has no
+ * access to slice 3. Stream records are tested under a CBC suite and both
+ * kinds of AEAD suite, datagram records and the client's record sizing only
+ * under the CBC one.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <openssl/ssl.h>
+#include <openssl/err.h>
+#include <openssl/pem.h>
+#include <openssl/bio.h>
+
+#include "../e_os.h"
+
+#if defined(OPENSSL_THREADS) && !defined(OPENSSL_SYS_WINDOWS) && !defined(OPENSSL_SYS_NETWARE) && !defined(OPENSSL_SYS_VMS)
+
+#include <pthread.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#define TEST_SERVER_CERT    "../evaluation/client_server/server.pem"
+#define TEST_DH_PARAM       "../apps/dh1024.pem"
+
+#define SLICE_RW            0
+#define SLICE_RO            1
+#define SLICE_NONE          2
+
+typedef struct spp_test_chain_st {
+    int fd[2][2];               /* stream hops: client-proxy, proxy-server */
+    int dfd[2][2];              /* datagram hops */
+    SSL *client;
+    SSL *proxy;                 /* the proxy's SSL towards the client */
+    SSL *proxy_next;            /* and towards the server */
+    SSL *server;
+    int slice_ids[3];
+} SPP_TEST_CHAIN;
+
+static SSL_CTX *client_ctx, *proxy_ctx, *server_ctx;
+static char proxy_address[] = "proxy0";
+static char server_address[] = "server";
+
+static const char *test_ciphers[] = {
+    "DHE-RSA-AES128-SHA256",
+    "DHE-RSA-AES128-GCM-SHA256",
+    "DHE-RSA-CHACHA20-POLY1305",
+};
+
+static SSL_CTX *make_ctx(const SSL_METHOD *meth, const char *cipher)
+{
+    SSL_CTX *ctx;
+    BIO *in;
+    DH *dh;
+
+    if ((ctx = SSL_CTX_new(meth)) == NULL)
+        return NULL;
+    if (!SSL_CTX_set_cipher_list(ctx, cipher) ||
+        !SSL_CTX_use_certificate_chain_file(ctx, TEST_SERVER_CERT) ||
+        !SSL_CTX_use_PrivateKey_file(ctx, TEST_SERVER_CERT, SSL_FILETYPE_PEM)) {
+        SSL_CTX_free(ctx);
+        return NULL;
+    }
+    if ((in = BIO_new_file(TEST_DH_PARAM, "r")) != NULL) {
+        if ((dh = PEM_read_bio_DHparams(in, NULL, NULL, NULL)) != NULL) {
+            SSL_CTX_set_tmp_dh(ctx, dh);
+            DH_free(dh);
+        }
+        BIO_free(in);
+    }
+    return ctx;
+}
+
+static SSL *next_hop(SSL *s, char *address)
+{
+    SPP_TEST_CHAIN *chain = SSL_get_app_data(s);
+    SSL *n;
+
+    if ((n = SSL_new(proxy_ctx)) == NULL)
+        return NULL;
+    SSL_set_fd(n, chain->fd[1][0]);
+    return n;
+}
+
+static void *proxy_main(void *arg)
+{
+    SPP_TEST_CHAIN *chain = arg;
+
+    if (SPP_proxy(chain->proxy, proxy_address, next_hop,
+                  &chain->proxy_next) <= 0)
+        chain->proxy_next = NULL;
+    return NULL;
+}
+
+static void *server_main(void *arg)
+{
+    SPP_TEST_CHAIN *chain = arg;
+
+    return SSL_accept(chain->server) > 0 ? chain : NULL;
+}
+
+static int client_handshake(SPP_TEST_CHAIN *chain)
+{
+    SSL *c = chain->client;
+    SPP_SLICE *slices[3];
+    SPP_PROXY *proxies[2];
+    int i;
+
+    proxies[0] = SPP_generate_proxy(c, proxy_address);
+    proxies[1] = SPP_generate_proxy(c, server_address);
+    for (i = 0; i < 3; i++) {
+        slices[i] = SPP_generate_slice(c, "test");
+        chain->slice_ids[i] = slices[i]->slice_id;
+    }
+    SPP_assign_proxy_read_slices(c, proxies[0], slices, 2);
+    SPP_assign_proxy_write_slices(c, proxies[0], slices, 1);
+    return SPP_connect(c, slices, 3, proxies, 2);
+}
+
+static void chain_free(SPP_TEST_CHAIN *chain)
+{
+    int i;
+
+    if (chain->proxy_next != NULL) {
+        /* The proxy's two connections share one session. */
+        if (chain->proxy_next->session == chain->proxy->session)
+            chain->proxy_next->session = NULL;
+        SSL_free(chain->proxy_next);
+    }
+    SSL_free(chain->proxy);
+    SSL_free(chain->client);
+    SSL_free(chain->server);
+    for (i = 0; i < 2; i++) {
+        close(chain->fd[i][0]);
+        close(chain->fd[i][1]);
+    }
+    OPENSSL_free(chain);
+}
+
+/* Connects a client to the server through the proxy. */
+static SPP_TEST_CHAIN *chain_new(void)
+{
+    SPP_TEST_CHAIN *chain;
+    pthread_t proxy_thread, server_thread;
+    void *server_ok;
+    int ok;
+
+    if ((chain = OPENSSL_malloc(sizeof(*chain))) == NULL)
+        return NULL;
+    memset(chain, 0, sizeof(*chain));
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, chain->fd[0]) != 0 ||
+        socketpair(AF_UNIX, SOCK_STREAM, 0, chain->fd[1]) != 0) {
+        OPENSSL_free(chain);
+        return NULL;
+    }
+    chain->client = SSL_new(client_ctx);
+    chain->proxy = SSL_new(proxy_ctx);
+    chain->server = SSL_new(server_ctx);
+    SSL_set_fd(chain->client, chain->fd[0][0]);
+    SSL_set_fd(chain->proxy, chain->fd[0][1]);
+    SSL_set_fd(chain->server, chain->fd[1][1]);
+    SSL_set_app_data(chain->proxy, chain);
+
+    pthread_create(&proxy_thread, NULL, proxy_main, chain);
+    pthread_create(&server_thread, NULL, server_main, chain);
+    ok = client_handshake(chain) > 0;
+    if (!ok) {
+        /* Let the others see the end of their connections. */
+        shutdown(chain->fd[0][0], SHUT_RDWR);
+        shutdown(chain->fd[1][0], SHUT_RDWR);
+    }
+    pthread_join(proxy_thread, NULL);
+    pthread_join(server_thread, &server_ok);
+    if (!ok || server_ok == NULL || chain->proxy_next == NULL) {
+        ERR_print_errors_fp(stderr);
+        chain_free(chain);
+        return NULL;
+    }
+    return chain;
+}
+
+static BIO *dgram_bio(int fd)
+{
+    struct sockaddr sa;
+    BIO *b;
+
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    if ((b = BIO_new_dgram(fd, BIO_CLOSE)) == NULL)
+        return NULL;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_family = AF_UNIX;
+    BIO_ctrl(b, BIO_CTRL_DGRAM_SET_CONNECTED, 0, &sa);
+    return b;
+}
+
+/* Gives every node a datagram BIO; the SSLs close the sockets. */
+static int chain_dgram(SPP_TEST_CHAIN *chain)
+{
+    if (socketpair(AF_UNIX, SOCK_DGRAM, 0, chain->dfd[0]) != 0 ||
+        socketpair(AF_UNIX, SOCK_DGRAM, 0, chain->dfd[1]) != 0)
+        return 0;
+    return SPP_set_dgram_bio(chain->client, dgram_bio(chain->dfd[0][0])) &&
+        SPP_set_dgram_bio(chain->proxy, dgram_bio(chain->dfd[0][1])) &&
+        SPP_set_dgram_bio(chain->proxy_next, dgram_bio(chain->dfd[1][0])) &&
+        SPP_set_dgram_bio(chain->server, dgram_bio(chain->dfd[1][1]));
+}
+
+static SPP_SLICE *slice_of(SSL *s, SPP_TEST_CHAIN *chain, int idx)
+{
+    return SPP_get_slice_by_id(s, chain->slice_ids[idx]);
+}
+
+static unsigned long mac_failures(SSL *s)
+{
+    SPP_STATS st;
+
+    SPP_get_stats(s, -1, SPP_STATS_READ, &st);
+    return (unsigned long)st.mac_failures;
+}
+
+/* Passes one datagram record from the server through the proxy, which
+ * flips a bit of it if |modify| is set, and reads it at the client into
+ * |out|. Returns the length read by the client. */
+static int dgram_pass(SPP_TEST_CHAIN *chain, int idx, const unsigned char *in,
+                      int len, int modify, unsigned char *out, int outl)
+{
+    unsigned char buf[SPP_DGRAM_MAX_PACKET_SIZE];
+    SPP_SLICE *slice;
+    SPP_CTX *ctx;
+    int n;
+
+    if (SPP_dgram_write(chain->server, in, len,
+                        slice_of(chain->server, chain, idx)) != len)
+        return -1;
+    /* Without the slice key the proxy gets the record encrypted. */
+    if ((n = SPP_dgram_read(chain->proxy_next, buf, sizeof(buf),
+                            &slice, &ctx)) <= 0)
+        return -1;
+    if (modify)
+        buf[0] ^= 1;
+    if (SPP_dgram_forward(chain->proxy, buf, n, slice, ctx) != n)
+        return -1;
+    return SPP_dgram_read(chain->client, out, outl, &slice, &ctx);
+}
+
+static int test_dgram(SPP_TEST_CHAIN *chain)
+{
+    unsigned char in[1000], out[1000], buf[SPP_DGRAM_MAX_PACKET_SIZE];
+    SPP_SLICE *slice;
+    SPP_CTX *ctx;
+    unsigned long failures;
+    int err = 0, n;
+
+    if (!chain_dgram(chain)) {
+        fprintf(stderr, "cannot set up the datagram BIOs\n");
+        return 1;
+    }
+    memset(in, 'd', sizeof(in));
+
+    /* A record that does not fit the buffer is kept for the next read,
+     * on the proxy as well as at the client. */
+    if (SPP_dgram_write(chain->server, in, sizeof(in),
+                        slice_of(chain->server, chain, SLICE_RW)) != sizeof(in)) {
+        fprintf(stderr, "datagram write failed\n");
+        return 1;
+    }
+    if (SPP_dgram_read(chain->proxy_next, buf, 16, &slice, &ctx) != -1 ||
+        ERR_GET_REASON(ERR_get_error()) != SPP_R_DGRAM_BUFFER_TOO_SMALL) {
+        fprintf(stderr, "short datagram read on the proxy did not fail\n");
+        err++;
+    }
+    n = SPP_dgram_read(chain->proxy_next, buf, sizeof(buf), &slice, &ctx);
+    if (n != sizeof(in) || SPP_dgram_forward(chain->proxy, buf, n, slice, ctx) != n) {
+        fprintf(stderr, "datagram record not forwarded whole\n");
+        return err + 1;
+    }
+    if (SPP_dgram_read(chain->client, out, 16, &slice, &ctx) != -1 ||
+        ERR_GET_REASON(ERR_get_error()) != SPP_R_DGRAM_BUFFER_TOO_SMALL) {
+        fprintf(stderr, "short datagram read on the client did not fail\n");
+        err++;
+    }
+    if (SPP_dgram_read(chain->client, out, sizeof(out), &slice, &ctx) != sizeof(in) ||
+        memcmp(in, out, sizeof(in)) != 0 ||
+        slice->slice_id != chain->slice_ids[SLICE_RW] ||
+        mac_failures(chain->client) != 0) {
+        fprintf(stderr, "datagram record not received intact\n");
+        err++;
+    }
+
+    /* A change by a proxy allowed to write the slice is delivered, but
+     * the client notices it through the integrity MAC. */
+    failures = mac_failures(chain->client);
+    if (dgram_pass(chain, SLICE_RW, in, 100, 1, out, sizeof(out)) != 100 ||
+        out[0] != (in[0] ^ 1) || mac_failures(chain->client) != failures + 1) {
+        fprintf(stderr, "datagram integrity MAC not checked\n");
+        err++;
+    }
+
+    /* One by a proxy that may only read it is dropped. */
+    failures = mac_failures(chain->client);
+    if (dgram_pass(chain, SLICE_RO, in, 100, 1, out, sizeof(out)) != -1 ||
+        mac_failures(chain->client) != failures + 1) {
+        fprintf(stderr, "datagram record changed by a reader accepted\n");
+        err++;
+    }
+
+    /* Records of slices the proxy cannot read pass unchanged. */
+    if (dgram_pass(chain, SLICE_NONE, in, 100, 0, out, sizeof(out)) != 100 ||
+        memcmp(in, out, 100) != 0) {
+        fprintf(stderr, "opaque datagram record not forwarded\n");
+        err++;
+    }
+    ERR_clear_error();
+    return err;
+}
+
+/* Passes one stream record on slice |idx|, or the default context if |idx|
+ * is negative, from the client (the server if |back| is set) through the
+ * proxy and reads it at the other end into |out|. Returns the length read
+ * there. */
+static int stream_pass(SPP_TEST_CHAIN *chain, int idx, int back,
+                       const unsigned char *in, int len,
+                       unsigned char *out, int outl)
+{
+    static unsigned char buf[SPP_RT_MAX_PACKET_SIZE];
+    SSL *from = back ? chain->server : chain->client;
+    SSL *to = back ? chain->client : chain->server;
+    SPP_SLICE *slice;
+    SPP_CTX *ctx;
+    int n;
+
+    slice = idx < 0 ? from->def_ctx : slice_of(from, chain, idx);
+    if (SPP_write_record(from, in, len, slice) != len)
+        return -1;
+    if ((n = SPP_read_record(back ? chain->proxy_next : chain->proxy, buf,
+                             sizeof(buf), &slice, &ctx)) <= 0)
+        return -1;
+    if (SPP_forward_record(back ? chain->proxy : chain->proxy_next, buf, n,
+                           slice, ctx, 0) != n)
+        return -1;
+    return SPP_read_record(to, out, outl, &slice, &ctx);
+}
+
+static int test_stream(SPP_TEST_CHAIN *chain, const char *cipher)
+{
+    static const int order[] = { -1, SLICE_RW, -1, SLICE_RO, SLICE_NONE, -1 };
+    unsigned char in[1000], out[1000];
+    int err = 0, i, back;
+
+    /* The default context follows on from the Finished messages, and its
+     * records are interleaved with slice records, both ways. */
+    for (back = 0; back < 2; back++) {
+        for (i = 0; i < (int)(sizeof(order)/sizeof(order[0])); i++) {
+            memset(in, 'a' + i, sizeof(in));
+            if (stream_pass(chain, order[i], back, in, sizeof(in),
+                            out, sizeof(out)) != sizeof(in) ||
+                memcmp(in, out, sizeof(in)) != 0) {
+                fprintf(stderr, "%s: %s record %d %s not received intact\n",
+                        cipher, order[i] < 0 ? "default context" : "slice",
+                        i, back ? "to the client" : "to the server");
+                ERR_print_errors_fp(stderr);
+                err++;
+                break;
+            }
+        }
+    }
+    if (mac_failures(chain->client) != 0 || mac_failures(chain->server) != 0) {
+        fprintf(stderr, "%s: unmodified stream records failed a MAC\n", cipher);
+        err++;
+    }
+    return err;
+}
+
+/* The context's counters include those of its live connections, which have
+ * sent far fewer than SPP_STATS_FOLD_RECORDS records. */
+static int test_ctx_stats(SPP_TEST_CHAIN *chain, const char *cipher)
+{
+    SPP_STATS conn, ctx;
+    int id = chain->slice_ids[SLICE_RW];
+
+    if (!SPP_get_stats(chain->client, -1, SPP_STATS_WRITE, &conn) ||
+        !SSL_CTX_get_spp_stats(client_ctx, -1, SPP_STATS_WRITE, &ctx) ||
+        conn.records == 0 || ctx.records != conn.records ||
+        ctx.bytes != conn.bytes) {
+        fprintf(stderr, "%s: context totals miss a live connection\n", cipher);
+        return 1;
+    }
+    if (!SPP_get_stats(chain->client, id, SPP_STATS_WRITE, &conn) ||
+        !SSL_CTX_get_spp_stats(client_ctx, id, SPP_STATS_WRITE, &ctx) ||
+        conn.records == 0 || ctx.records != conn.records ||
+        ctx.app_bytes != conn.app_bytes) {
+        fprintf(stderr, "%s: context slice counters miss a live connection\n",
+                cipher);
+        return 1;
+    }
+    return 0;
+}
+
+/* Reads records on the proxy and checks their lengths against |lens|. */
+static int proxy_records(SPP_TEST_CHAIN *chain, const int *lens, int n)
+{
+    static unsigned char buf[SPP_RT_MAX_PACKET_SIZE];
+    SPP_SLICE *slice;
+    SPP_CTX *ctx;
+    int i, l;
+
+    for (i = 0; i < n; i++) {
+        if ((l = SPP_read_record(chain->proxy, buf, sizeof(buf), &slice,
+                                 &ctx)) != lens[i]) {
+            fprintf(stderr, "record %d of %d bytes, expected %d\n",
+                    i, l, lens[i]);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Reads what the client wrote on the proxy's socket without going through
+ * the proxy, which is lost for it after this. */
+static void drain(SPP_TEST_CHAIN *chain)
+{
+    static unsigned char buf[65536];
+
+    while (read(chain->fd[0][1], buf, sizeof(buf)) > 0)
+        ;
+}
+
+/* The first bytes after the handshake and after an idle spell go out in
+ * small records, the rest in full ones. The test leaves the client's
+ * socket non-blocking and the proxy out of step, so it comes last. */
+static int test_record_sizing(SPP_TEST_CHAIN *chain)
+{
+    static const int boosted[] = { 1024, 1024, 1024, 1024, 1904 };
+    static const int full[] = { 2000 };
+    static const int idle[] = { 1024, 976 };
+    static unsigned char in[1 << 22];
+    SPP_SLICE *slice = slice_of(chain->client, chain, SLICE_RW);
+    int err = 0, ret, tries;
+
+    memset(in, 's', sizeof(in));
+    SSL_set_spp_record_sizing(chain->client, 1024, 4096, 100);
+    if (SPP_write_record(chain->client, in, 6000, slice) != 6000 ||
+        !proxy_records(chain, boosted, 5)) {
+        fprintf(stderr, "first records not small\n");
+        err++;
+    }
+    if (SPP_write_record(chain->client, in, 2000, slice) != 2000 ||
+        !proxy_records(chain, full, 1)) {
+        fprintf(stderr, "records after the boost not full size\n");
+        err++;
+    }
+    usleep(150000);
+    if (SPP_write_record(chain->client, in, 2000, slice) != 2000 ||
+        !proxy_records(chain, idle, 2)) {
+        fprintf(stderr, "records after an idle spell not small\n");
+        err++;
+    }
+
+    /* A batch of full records that doesn't all go out is retried after
+     * the idle timer has made the next record small again: the retry
+     * finishes the batch first. */
+    SSL_set_mode(chain->client, SSL_MODE_SPP_LARGE_WRITE);
+    SSL_set_spp_record_sizing(chain->client, 1024, 1024, 100);
+    fcntl(chain->fd[0][0], F_SETFL,
+          fcntl(chain->fd[0][0], F_GETFL) | O_NONBLOCK);
+    fcntl(chain->fd[0][1], F_SETFL,
+          fcntl(chain->fd[0][1], F_GETFL) | O_NONBLOCK);
+    ret = SPP_write_record(chain->client, in, sizeof(in), slice);
+    if (ret != -1 || SSL_get_error(chain->client, ret) != SSL_ERROR_WANT_WRITE) {
+        fprintf(stderr, "large write did not block\n");
+        return err + 1;
+    }
+    usleep(150000);
+    for (tries = 0; tries < 10000 && ret == -1; tries++) {
+        drain(chain);
+        ret = SPP_write_record(chain->client, in, sizeof(in), slice);
+        if (ret == -1 &&
+            SSL_get_error(chain->client, ret) != SSL_ERROR_WANT_WRITE)
+            break;
+    }
+    if (ret != sizeof(in)) {
+        fprintf(stderr, "write not finished after an idle retry\n");
+        ERR_print_errors_fp(stderr);
+        err++;
+    }
+    ERR_clear_error();
+    return err;
+}
+
+int main(int argc, char *argv[])
+{
+    SPP_TEST_CHAIN *chain;
+    int err = 0, i;
+
+    SSL_library_init();
+    SSL_load_error_strings();
+    /* The handshakes run on threads sharing the SSL_CTXs. */
+    if (!CRYPTO_thread_setup_pthreads(0))
+        EXIT(1);
+
+    for (i = 0; i < (int)(sizeof(test_ciphers)/sizeof(test_ciphers[0])); i++) {
+        client_ctx = make_ctx(SPP_method(), test_ciphers[i]);
+        proxy_ctx = make_ctx(SPP_proxy_method(), test_ciphers[i]);
+        server_ctx = make_ctx(SPP_method(), test_ciphers[i]);
+        if (client_ctx == NULL || proxy_ctx == NULL || server_ctx == NULL) {
+            ERR_print_errors_fp(stderr);
+            EXIT(1);
+        }
+
+        if ((chain = chain_new()) == NULL) {
+            fprintf(stderr, "%s: SPP handshake failed\n", test_ciphers[i]);
+            err++;
+        } else {
+            err += test_stream(chain, test_ciphers[i]);
+            err += test_ctx_stats(chain, test_ciphers[i]);
+            if (i == 0) {
+                err += test_dgram(chain);
+                err += test_record_sizing(chain);
+            }
+            chain_free(chain);
+        }
+
+        SSL_CTX_free(client_ctx);
+        SSL_CTX_free(proxy_ctx);
+        SSL_CTX_free(server_ctx);
+    }
+    ERR_free_strings();
+    EVP_cleanup();
+    CRYPTO_thread_cleanup_pthreads();
+
+    if (err)
+        printf("%d SPP tests failed\n", err);
+    else
+        printf("test SPP ok\n");
+    EXIT(err);
+    return err;
+}
+
+#else                           /* OPENSSL_THREADS */
+
+int main(int argc, char *argv[])
+{
+    printf("No SPP tests without POSIX threads\n");
+    return 0;
+}
+#endif
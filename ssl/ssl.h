@@ -291,6 +291,7 @@ extern "C" {
 #define SSL_TXT_AES_GCM		"AESGCM"
 #define SSL_TXT_CAMELLIA128	"CAMELLIA128"
 #define SSL_TXT_CAMELLIA256	"CAMELLIA256"
+#define SSL_TXT_CHACHA20	"CHACHA20"
 #define SSL_TXT_CAMELLIA	"CAMELLIA"
 
 #define SSL_TXT_MD5		"MD5"
@@ -530,6 +531,11 @@ struct ssl_session_st
 	/* These are used to make removal of session-ids more
 	 * efficient and to implement a maximum cache size. */
 	struct ssl_session_st *prev,*next;
+	/* The same sessions in the order they expire, by the time they
+	 * expired at when added to the cache, so that expiry only looks at
+	 * the ones that are due. */
+	struct ssl_session_st *exp_prev,*exp_next;
+	long expires;
 #ifndef OPENSSL_NO_TLSEXT
 	char *tlsext_hostname;
 #ifndef OPENSSL_NO_EC
@@ -658,6 +664,20 @@ struct ssl_session_st
  * To be set by applications that reconnect with a downgraded protocol
  * version; see draft-ietf-tls-downgrade-scsv-00 for details. */
 #define SSL_MODE_SEND_FALLBACK_SCSV 0x00000080L
+/* Seal SPP application writes that span several records as one batch,
+ * fanned out to the SSL_CTX's seal threads (see
+ * SSL_CTX_set_spp_seal_threads()), and flush the batch with one write. */
+#define SSL_MODE_SPP_LARGE_WRITE 0x00000100L
+/* Carve the read and write buffers of an SSL_CTX's connections out of
+ * 2MB slabs, backed by huge pages where the system has them, instead of
+ * allocating them one by one. Meant for proxies holding many connections;
+ * set it on the SSL_CTX before the first connection. Slabs are only
+ * returned to the system when the SSL_CTX is freed. */
+#define SSL_MODE_SPP_BUFFER_SLABS 0x00000200L
+/* Serve the small allocations made during a handshake from an arena that
+ * is dropped when the handshake is over. Needs the allocator installed by
+ * CRYPTO_mem_cache_setup(), and is ignored without it. */
+#define SSL_MODE_HANDSHAKE_ARENA 0x00000400L
 
 /* Note: SSL[_CTX]_set_{options,mode} use |= op on the previous value,
  * they cannot be used to clear bits. */
@@ -748,6 +768,10 @@ int SRP_generate_client_master_secret(SSL *s,unsigned char *master_key);
 #endif
 
 #define SSL_SESSION_CACHE_MAX_SIZE_DEFAULT	(1024*20)
+/* The internal session cache is split by session ID into this many shards,
+ * each with a lock of its own; see SSL_CTX_sess_set_cache_shards(). */
+#define SSL_SESSION_CACHE_SHARDS_DEFAULT	16
+#define SSL_SESSION_CACHE_MAX_SHARDS		256
 
 /* This callback type is used inside SSL_CTX, SSL, and in the functions that set
  * them. It is used to override the generation of SSL/TLS session IDs in a
@@ -765,6 +789,155 @@ int SRP_generate_client_master_secret(SSL *s,unsigned char *master_key);
 typedef int (*GEN_SESSION_CB)(const SSL *ssl, unsigned char *id,
 				unsigned int *id_len);
 
+/* SPP traffic counters of one direction, see SPP_get_stats(). They are
+ * only touched by the thread using the SSL and folded into the SSL_CTX
+ * totals every SPP_STATS_FOLD_RECORDS records and on SSL_free(); the
+ * SSL_CTX getters add what the live connections counted since. */
+#if (defined(_WIN32) || defined(_WIN64)) && !defined(__MINGW32__)
+#define SPP_COUNTER unsigned __int64
+#else
+#define SPP_COUNTER unsigned long long
+#endif
+
+#define SPP_STATS_READ          0
+#define SPP_STATS_WRITE         1
+/* Slice ids are a single byte in the record header */
+#define SPP_STATS_MAX_SLICES    256
+#define SPP_STATS_FOLD_RECORDS  1024
+
+struct spp_stats_st
+        {
+        SPP_COUNTER records;
+        SPP_COUNTER bytes;              /* on the wire, headers included */
+        SPP_COUNTER app_bytes;
+        SPP_COUNTER pad_bytes;
+        SPP_COUNTER header_bytes;
+        SPP_COUNTER handshake_bytes;
+        SPP_COUNTER alert_bytes;
+        SPP_COUNTER mac_bytes;
+        SPP_COUNTER mac_failures;       /* read, write or integrity MAC mismatch */
+        SPP_COUNTER decrypt_failures;   /* bad length or padding */
+        SPP_COUNTER opaque_records;     /* forwarded without the slice key */
+        };
+
+/* All of an SSL_CTX's counters at one point in time */
+typedef struct spp_stats_snapshot_st
+        {
+        long time;
+        SPP_STATS total[2];
+        /* Slices seen so far, by ascending id */
+        int slices_len;
+        int slice_ids[SPP_STATS_MAX_SLICES];
+        SPP_STATS slices[SPP_STATS_MAX_SLICES][2];
+        } SPP_STATS_SNAPSHOT;
+
+/* Time spent in the stages of the SPP record layer, see
+ * SSL_CTX_set_spp_timing(). The *_RECORD stages cover a whole record
+ * without the network I/O. Times are in ticks, see SPP_timing_unit(). */
+#define SPP_TIMING_READ_HEADER          0
+#define SPP_TIMING_READ_SLICE           1
+#define SPP_TIMING_READ_DECRYPT         2
+#define SPP_TIMING_READ_MAC             3
+#define SPP_TIMING_READ_EXPAND          4
+#define SPP_TIMING_READ_COPY            5
+#define SPP_TIMING_READ_RECORD          6
+#define SPP_TIMING_WRITE_HEADER         7
+#define SPP_TIMING_WRITE_COPY           8
+#define SPP_TIMING_WRITE_MAC            9
+#define SPP_TIMING_WRITE_ENCRYPT        10
+#define SPP_TIMING_WRITE_RECORD         11
+#define SPP_TIMING_STAGES               12
+/* buckets[0] counts samples below 2 ticks, buckets[i] those in
+ * [2^i, 2^(i+1)) */
+#define SPP_TIMING_BUCKETS              64
+
+typedef struct spp_timing_hist_st
+        {
+        SPP_COUNTER count;
+        SPP_COUNTER sum;
+        SPP_COUNTER min;
+        SPP_COUNTER max;
+        SPP_COUNTER buckets[SPP_TIMING_BUCKETS];
+        } SPP_TIMING_HIST;
+
+/* SPP trace events, see SSL_CTX_set_spp_trace() */
+#define SPP_TRACE_HANDSHAKE     0x01    /* handshake messages and CCS */
+#define SPP_TRACE_RECORDS       0x02    /* every SPP record */
+
+/* The MACs of a record that were generated (sent) or checked (received),
+ * and which of the checked ones did not match */
+#define SPP_TRACE_MAC_READ              0x01
+#define SPP_TRACE_MAC_WRITE             0x02
+#define SPP_TRACE_MAC_INTEGRITY         0x04
+#define SPP_TRACE_MAC_TLS               0x08    /* single MAC, no slice keys */
+#define SPP_TRACE_MAC_READ_FAILED       0x10
+#define SPP_TRACE_MAC_WRITE_FAILED      0x20
+#define SPP_TRACE_MAC_INTEGRITY_FAILED  0x40
+
+typedef struct spp_trace_event_st
+        {
+        int type;               /* SPP_TRACE_HANDSHAKE or SPP_TRACE_RECORDS */
+        int write_p;            /* 1 sent, 0 received */
+        int content_type;
+        int msg_type;           /* handshake message type, -1 for records and CCS */
+        int slice_id;           /* -1 if none */
+        /* Handshake: the middlebox a message is from or for, 0 for the
+         * endpoints' own messages. Records: the id of this node. */
+        int proxy_id;
+        int forwarded;          /* a middlebox passing a handshake message on */
+        int opaque;             /* a record forwarded without the slice keys */
+        int macs;               /* SPP_TRACE_MAC_* */
+        size_t length;          /* message, or record plaintext */
+        size_t wire_length;     /* record on the wire, 0 for handshake messages */
+        } SPP_TRACE_EVENT;
+
+typedef void (*SPP_TRACE_CB)(const SSL *s, const SPP_TRACE_EVENT *ev, void *arg);
+
+/* Public key operations of a connection, see SPP_get_pk_stats(). A
+ * certificate chain verification is counted once, not per signature. */
+#define SPP_PK_RSA_ENCRYPT      0       /* key transport, envelope seal */
+#define SPP_PK_RSA_DECRYPT      1       /* key transport, envelope open */
+#define SPP_PK_RSA_SIGN         2
+#define SPP_PK_RSA_VERIFY       3
+#define SPP_PK_DSA_SIGN         4
+#define SPP_PK_DSA_VERIFY       5
+#define SPP_PK_ECDSA_SIGN       6
+#define SPP_PK_ECDSA_VERIFY     7
+#define SPP_PK_DH_KEYGEN        8
+#define SPP_PK_DH_DERIVE        9
+#define SPP_PK_ECDH_KEYGEN      10
+#define SPP_PK_ECDH_DERIVE      11
+#define SPP_PK_CHAIN_VERIFY     12
+#define SPP_PK_OTHER            13      /* GOST */
+#define SPP_PK_OPS              14
+
+#define SPP_PK_ROLE_CLIENT      0
+#define SPP_PK_ROLE_SERVER      1
+#define SPP_PK_ROLE_PROXY       2
+
+typedef struct spp_pk_count_st
+        {
+        SPP_COUNTER count;
+        SPP_COUNTER time;       /* in SPP_timing_unit(), 0 without timing */
+        } SPP_PK_COUNT;
+
+/* The operations done for one middlebox (its certificate, its key
+ * exchange, the key material sealed for it) or, with proxy_id 0, those
+ * between the endpoints. A middlebox counts all its own under its id. */
+typedef struct spp_pk_proxy_st
+        {
+        int proxy_id;
+        SPP_PK_COUNT ops[SPP_PK_OPS];
+        } SPP_PK_PROXY;
+
+typedef struct spp_pk_stats_st
+        {
+        int role;               /* SPP_PK_ROLE_* */
+        SPP_PK_COUNT total[SPP_PK_OPS];
+        int proxies_len;
+        SPP_PK_PROXY proxies[MAX_SPP_PROXIES + 1];
+        } SPP_PK_STATS;
+
 typedef struct ssl_comp_st SSL_COMP;
 
 #ifndef OPENSSL_NO_SSL_INTERN
@@ -792,12 +965,15 @@ struct ssl_ctx_st
 	STACK_OF(SSL_CIPHER) *cipher_list_by_id;
 
 	struct x509_store_st /* X509_STORE */ *cert_store;
+	/* The hash table of the first shard of the session cache, which
+	 * with a single shard is the whole cache (SSL_CTX_sessions()). */
 	LHASH_OF(SSL_SESSION) *sessions;
 	/* Most session-ids that will be cached, default is
-	 * SSL_SESSION_CACHE_MAX_SIZE_DEFAULT. 0 is unlimited. */
+	 * SSL_SESSION_CACHE_MAX_SIZE_DEFAULT. 0 is unlimited. Every shard
+	 * holds at most its share of it. */
 	unsigned long session_cache_size;
-	struct ssl_session_st *session_cache_head;
-	struct ssl_session_st *session_cache_tail;
+	struct ssl_sess_shard_st *sess_shards;
+	unsigned int sess_nshards;
 
 	/* This can have one of 2 values, ored together,
 	 * SSL_SESS_CACHE_CLIENT,
@@ -967,6 +1143,7 @@ struct ssl_ctx_st
 	unsigned int freelist_max_len;
 	struct ssl3_buf_freelist_st *wbuf_freelist;
 	struct ssl3_buf_freelist_st *rbuf_freelist;
+	struct ssl3_buf_slab_st *buf_slabs;
 #endif
 #ifndef OPENSSL_NO_SRP
 	SRP_CTX srp_ctx; /* ctx for SRP authentication */
@@ -995,6 +1172,33 @@ struct ssl_ctx_st
         /* SRTP profiles we are willing to do from RFC 5764 */
         STACK_OF(SRTP_PROTECTION_PROFILE) *srtp_profiles;  
 #endif
+        /* Number of worker threads sealing SPP records for
+         * SSL_MODE_SPP_LARGE_WRITE. The pool is started on first use. */
+        int spp_seal_threads;
+        struct spp_seal_pool_st *spp_seal_pool;
+        /* Dynamic SPP record sizing, see SSL_CTX_set_spp_record_sizing().
+         * Application data goes out in records of at most spp_record_small
+         * bytes until spp_record_boost bytes have been sent, and again after
+         * spp_record_idle milliseconds without a write. 0 disables it. */
+        unsigned int spp_record_small;
+        unsigned long spp_record_boost;
+        unsigned long spp_record_idle;
+        /* SPP traffic of the connections made from this context, by
+         * direction and, allocated on first use, by slice id. */
+        SPP_STATS spp_stats[2];
+        SPP_STATS (*spp_slice_stats)[2];
+        /* The SSLs made from it that are not freed yet, whose counters
+         * are added to the folded ones on reading them. */
+        struct ssl_st *spp_live;
+        /* Record layer stage timing: whether new SSLs measure it and the
+         * histograms folded in from them, allocated on first use. */
+        int spp_timing_on;
+        struct spp_timing_st *spp_timing;
+        /* Trace callback of the SSLs created from this context, unless
+         * they set their own */
+        int spp_trace_flags;
+        SPP_TRACE_CB spp_trace_cb;
+        void *spp_trace_arg;
 	};
 
 #endif
@@ -1011,6 +1215,9 @@ struct ssl_ctx_st
 	(SSL_SESS_CACHE_NO_INTERNAL_LOOKUP|SSL_SESS_CACHE_NO_INTERNAL_STORE)
 
 LHASH_OF(SSL_SESSION) *SSL_CTX_sessions(SSL_CTX *ctx);
+LHASH_OF(SSL_SESSION) *SSL_CTX_sessions_shard(SSL_CTX *ctx, unsigned int i);
+void SSL_CTX_sessions_doall(SSL_CTX *ctx,
+	void (*func)(SSL_SESSION *sess, void *arg), void *arg);
 #define SSL_CTX_sess_number(ctx) \
 	SSL_CTX_ctrl(ctx,SSL_CTRL_SESS_NUMBER,0,NULL)
 #define SSL_CTX_sess_connect(ctx) \
@@ -1117,6 +1324,11 @@ const char *SSL_get_psk_identity(const SSL *s);
 #define SSL_MAC_FLAG_READ_MAC_STREAM 1
 #define SSL_MAC_FLAG_WRITE_MAC_STREAM 2
 
+/* Slice records of an AEAD cipher suite carry an explicit nonce after the
+ * header and end in three tags: reader, writer and end-to-end integrity. */
+#define SPP_AEAD_NONCE_LEN      8
+#define SPP_AEAD_TAG_LEN        16
+
 #ifndef OPENSSL_NO_SSL_INTERN
 
 struct spp_mac_st {
@@ -1128,6 +1340,10 @@ struct spp_mac_st {
     unsigned char write_mac_secret[EVP_MAX_MD_SIZE];
     EVP_MD_CTX *read_hash;
     EVP_MD_CTX *write_hash;
+    /* The same keys with the HMAC pads precomputed; type is NID_undef when
+     * the MAC is not an HMAC that HMAC_precompute() handles. */
+    HMAC_PRECOMP read_hmac_key;
+    HMAC_PRECOMP write_hmac_key;
     long spacer;
 };
 
@@ -1145,6 +1361,10 @@ struct spp_slice_st
         SPP_CIPH *read_ciph;
         SPP_MAC *read_mac;
         SPP_MAC *write_mac;
+        /* With an AEAD cipher suite, the contexts under the write key
+         * that produce the writer tag. In def_ctx, copies of the
+         * endpoint contexts for the integrity tag. */
+        SPP_CIPH *write_ciph;
         /* Indicates whether this context contains the material 
          * need to encrypt/decrypt. basically, whether enc_read_ctx 
          * and enc_write_ctx are valid or not. */
@@ -1163,6 +1383,10 @@ struct spp_slice_st
         int write_mat_len;
         unsigned char other_write_mat[EVP_MAX_KEY_LENGTH];
         int other_write_mat_len;
+        /* Traffic on this slice, indexed by SPP_STATS_READ/WRITE, and the
+         * part of it already added to the SSL_CTX */
+        SPP_STATS stats[2];
+        SPP_STATS stats_folded[2];
         };
         
 struct spp_proxy_st 
@@ -1186,19 +1410,12 @@ struct spp_read_st
         unsigned char *read_mac;
         unsigned char *write_mac;
         size_t mac_length;
+        /* Epoch and sequence number of a datagram record */
+        unsigned char seq_num[8];
+        /* Explicit nonce of an AEAD slice record */
+        unsigned char nonce[SPP_AEAD_NONCE_LEN];
         };     
         
-struct spp_stats_st
-        {
-        int bytes;
-        int app_bytes;
-        int pad_bytes;
-        int header_bytes;
-        int handshake_bytes;
-        int alert_bytes;
-        int mac_bytes;
-        };
-
 struct ssl_st
 	{
 	/* protocol version
@@ -1291,6 +1508,7 @@ struct ssl_st
 	int mac_flags; 
 	EVP_CIPHER_CTX *enc_read_ctx;		/* cryptographic state */
 	EVP_MD_CTX *read_hash;		/* used for mac generation */
+	const HMAC_PRECOMP *read_hmac;	/* read_hash's key precomputed, or NULL */
 #ifndef OPENSSL_NO_COMP
 	COMP_CTX *expand;			/* uncompress */
 #else
@@ -1299,6 +1517,7 @@ struct ssl_st
 
 	EVP_CIPHER_CTX *enc_write_ctx;		/* cryptographic state */
 	EVP_MD_CTX *write_hash;		/* used for mac generation */
+	const HMAC_PRECOMP *write_hmac;	/* write_hash's key precomputed, or NULL */
 #ifndef OPENSSL_NO_COMP
 	COMP_CTX *compress;			/* compression */
 #else
@@ -1501,10 +1720,62 @@ struct ssl_st
         
         struct spp_stats_st read_stats;
         struct spp_stats_st write_stats;
+        /* Part of read_stats/write_stats already added to the SSL_CTX */
+        struct spp_stats_st stats_folded[2];
+        /* In the SSL_CTX's list of live connections */
+        struct ssl_st *spp_live_next, *spp_live_prev;
+        /* Stage timings not yet added to the SSL_CTX, NULL unless timing
+         * is on for this SSL. */
+        struct spp_timing_st *spp_timing;
+
+        /* Trace callback, the SSL_CTX's unless spp_trace_own is set */
+        int spp_trace_flags;
+        SPP_TRACE_CB spp_trace_cb;
+        void *spp_trace_arg;
+        int spp_trace_own;
+        /* The middlebox the next handshake message is from or for, and
+         * whether it is being passed on, as known to the SPP state
+         * machines; consumed by the trace event. */
+        int spp_trace_proxy_id;
+        int spp_trace_forward;
+
+        /* Public key operations since SSL_new() or SSL_clear(), by
+         * middlebox, see SPP_get_pk_stats() */
+        SPP_PK_PROXY *spp_pk;
+        int spp_pk_len;
 
         /* used to store the shared secret to encrypt/decrypt proxy key mat */
         unsigned char *proxy_key_mat_shared_secret;
         int proxy_key_mat_shared_secret_len;
+
+        /* Dynamic record sizing, inherited from the SSL_CTX. spp_record_sent
+         * counts application bytes written since the connection started or
+         * last went idle, spp_record_last is the time of the last write in
+         * milliseconds. */
+        unsigned int spp_record_small;
+        unsigned long spp_record_boost;
+        unsigned long spp_record_idle;
+        unsigned long spp_record_sent;
+        unsigned long spp_record_last;
+        /* Set by SPP_forward_record() if the data being forwarded was
+         * modified by this proxy and may thus be re-fragmented. */
+        int spp_write_modified;
+        /* Explicit nonce of the next AEAD slice record we write, seeded
+         * at random on first use. */
+        unsigned char spp_aead_nonce[SPP_AEAD_NONCE_LEN];
+        int spp_aead_nonce_set;
+
+        /* Datagram transport for application data, see SPP_set_dgram_bio() */
+        struct spp_dgram_st *spp_dgram;
+
+        /* Allocations of the current or last handshake, see
+         * SSL_get_handshake_mem_stats(). hs_arena is only set during a
+         * handshake in SSL_MODE_HANDSHAKE_ARENA, hs_mem_depth counts the
+         * handshake calls on the stack. */
+        CRYPTO_MEM_ARENA *hs_arena;
+        CRYPTO_MEM_STATS hs_mem_stats;
+        int hs_mem_depth;
+        int hs_mem_running;
 	};
 
 #endif
@@ -1764,6 +2035,12 @@ DECLARE_PEM_rw(SSL_SESSION, SSL_SESSION)
 #define SSL_CTRL_CLEAR_EXTRA_CHAIN_CERTS	83
 
 #define SSL_CTRL_CHECK_PROTO_VERSION		119
+#define SSL_CTRL_SET_SESS_CACHE_SHARDS		120
+#define SSL_CTRL_GET_SESS_CACHE_SHARDS		121
+
+/* SPP controls */
+#define SSL_CTRL_SET_SPP_SEAL_THREADS		200
+#define SSL_CTRL_GET_SPP_SEAL_THREADS		201
 
 #define DTLSv1_get_timeout(ssl, arg) \
 	SSL_ctrl(ssl,DTLS_CTRL_GET_TIMEOUT,0, (void *)arg)
@@ -2011,6 +2288,32 @@ int 	SSL_peek(SSL *ssl,void *buf,int num);
 int 	SSL_write(SSL *ssl,const void *buf,int num);
 int 	SPP_write_record(SSL *ssl,const void *buf,int num,SPP_SLICE *slice);
 int 	SPP_forward_record(SSL *ssl,const void *buf,int num,SPP_SLICE *slice,SPP_CTX *ctx,int modified);
+int     SPP_set_dgram_bio(SSL *s, BIO *bio);
+int     SPP_dgram_write(SSL *s, const void *buf, int num, SPP_SLICE *slice);
+int     SPP_dgram_read(SSL *s, void *buf, int num, SPP_SLICE **slice, SPP_CTX **ctx);
+int     SPP_dgram_forward(SSL *s, const void *buf, int num, SPP_SLICE *slice, SPP_CTX *ctx);
+int     SSL_CTX_set_spp_record_sizing(SSL_CTX *ctx, unsigned int small,
+                                      unsigned long boost, unsigned long idle_ms);
+int     SSL_set_spp_record_sizing(SSL *s, unsigned int small,
+                                  unsigned long boost, unsigned long idle_ms);
+int     SPP_get_stats(const SSL *s, int slice_id, int direction, SPP_STATS *stats);
+void    SPP_fold_stats(SSL *s);
+int     SSL_CTX_get_spp_stats(SSL_CTX *ctx, int slice_id, int direction, SPP_STATS *stats);
+SPP_STATS_SNAPSHOT *SSL_CTX_get_spp_stats_snapshot(SSL_CTX *ctx);
+void    SPP_STATS_SNAPSHOT_free(SPP_STATS_SNAPSHOT *snap);
+int     SSL_CTX_set_spp_timing(SSL_CTX *ctx, int on);
+int     SSL_set_spp_timing(SSL *s, int on);
+int     SSL_CTX_get_spp_timing(SSL_CTX *ctx, int stage, SPP_TIMING_HIST *hist);
+void    SSL_CTX_reset_spp_timing(SSL_CTX *ctx);
+const char *SPP_timing_stage_name(int stage);
+const char *SPP_timing_unit(void);
+SPP_COUNTER SPP_TIMING_HIST_percentile(const SPP_TIMING_HIST *hist, double p);
+void    SSL_CTX_set_spp_trace(SSL_CTX *ctx, int flags, SPP_TRACE_CB cb, void *arg);
+void    SSL_set_spp_trace(SSL *s, int flags, SPP_TRACE_CB cb, void *arg);
+const char *SPP_trace_msg_name(int msg_type);
+void    SPP_trace_print(const SSL *s, const SPP_TRACE_EVENT *ev, void *bio);
+int     SPP_get_pk_stats(const SSL *s, SPP_PK_STATS *stats);
+void    SSL_get_handshake_mem_stats(const SSL *s, CRYPTO_MEM_STATS *st);
 long	SSL_ctrl(SSL *ssl,int cmd, long larg, void *parg);
 long	SSL_callback_ctrl(SSL *, int, void (*)(void));
 long	SSL_CTX_ctrl(SSL_CTX *ctx,int cmd, long larg, void *parg);
@@ -2139,6 +2442,10 @@ int SSL_get_ex_data_X509_STORE_CTX_idx(void );
 	SSL_CTX_ctrl(ctx,SSL_CTRL_SET_SESS_CACHE_SIZE,t,NULL)
 #define SSL_CTX_sess_get_cache_size(ctx) \
 	SSL_CTX_ctrl(ctx,SSL_CTRL_GET_SESS_CACHE_SIZE,0,NULL)
+#define SSL_CTX_sess_set_cache_shards(ctx,n) \
+	SSL_CTX_ctrl(ctx,SSL_CTRL_SET_SESS_CACHE_SHARDS,n,NULL)
+#define SSL_CTX_sess_get_cache_shards(ctx) \
+	SSL_CTX_ctrl(ctx,SSL_CTRL_GET_SESS_CACHE_SHARDS,0,NULL)
 #define SSL_CTX_set_session_cache_mode(ctx,m) \
 	SSL_CTX_ctrl(ctx,SSL_CTRL_SET_SESS_CACHE_MODE,m,NULL)
 #define SSL_CTX_get_session_cache_mode(ctx) \
@@ -2164,6 +2471,11 @@ int SSL_get_ex_data_X509_STORE_CTX_idx(void );
 #define SSL_set_max_send_fragment(ssl,m) \
 	SSL_ctrl(ssl,SSL_CTRL_SET_MAX_SEND_FRAGMENT,m,NULL)
 
+#define SSL_CTX_set_spp_seal_threads(ctx,n) \
+	SSL_CTX_ctrl(ctx,SSL_CTRL_SET_SPP_SEAL_THREADS,n,NULL)
+#define SSL_CTX_get_spp_seal_threads(ctx) \
+	SSL_CTX_ctrl(ctx,SSL_CTRL_GET_SPP_SEAL_THREADS,0,NULL)
+
      /* NB: the keylength is only applicable when is_export is true */
 #ifndef OPENSSL_NO_RSA
 void SSL_CTX_set_tmp_rsa_callback(SSL_CTX *ctx,
@@ -2221,6 +2533,18 @@ int SSL_cache_hit(SSL *s);
 const struct openssl_ssl_test_functions *SSL_test_functions(void);
 #endif
 
+/* SPP reason codes. mkerr.pl only handles SSL_R_ codes, so these are kept
+ * out of the generated block below, SSL_load_error_strings() loads their
+ * strings. */
+#define SPP_R_INVALID_SLICE_ID			 601
+#define SPP_R_MISSING_SLICE			 602
+#define SPP_R_MISSING_PROXY			 604
+#define SPP_R_INVALID_PROXY_ID			 605
+#define SPP_R_DGRAM_BIO_NOT_SET			 610
+#define SPP_R_UNSUPPORTED_DGRAM_CIPHER		 611
+#define SPP_R_DGRAM_SEQUENCE_EXHAUSTED		 612
+#define SPP_R_DGRAM_BUFFER_TOO_SMALL		 614
+
 /* BEGIN ERROR CODES */
 /* The following lines are auto generated by the script mkerr.pl. Any changes
  * made after this point may be overwritten when the script is next run.
@@ -2277,6 +2601,11 @@ void ERR_load_SSL_strings(void);
 #define SSL_F_SERVER_FINISH				 239
 #define SSL_F_SERVER_HELLO				 114
 #define SSL_F_SERVER_VERIFY				 240
+#define SSL_F_SPP_DGRAM_FORWARD				 608
+#define SSL_F_SPP_DGRAM_READ				 607
+#define SSL_F_SPP_DGRAM_WRITE				 606
+#define SSL_F_SPP_ENC					 603
+#define SSL_F_SPP_SET_DGRAM_BIO				 609
 #define SSL_F_SSL23_ACCEPT				 115
 #define SSL_F_SSL23_CLIENT_HELLO			 116
 #define SSL_F_SSL23_CONNECT				 117
@@ -2365,6 +2694,7 @@ void ERR_load_SSL_strings(void);
 #define SSL_F_SSL_CREATE_CIPHER_LIST			 166
 #define SSL_F_SSL_CTRL					 232
 #define SSL_F_SSL_CTX_CHECK_PRIVATE_KEY			 168
+#define SSL_F_SSL_CTX_GET_SPP_STATS_SNAPSHOT		 613
 #define SSL_F_SSL_CTX_MAKE_PROFILES			 309
 #define SSL_F_SSL_CTX_NEW				 169
 #define SSL_F_SSL_CTX_SET_CIPHER_LIST			 269
@@ -2753,13 +3083,6 @@ void ERR_load_SSL_strings(void);
 #define SSL_R_X509_LIB					 268
 #define SSL_R_X509_VERIFICATION_SETUP_PROBLEMS		 269
 
-#define SPP_R_INVALID_SLICE_ID                           601
-#define SPP_R_MISSING_SLICE                              602
-#define SSL_F_SPP_ENC                                    603
-#define SPP_R_MISSING_PROXY                              604
-#define SPP_R_INVALID_PROXY_ID                           605
-
-
 #ifdef  __cplusplus
 }
 #endif
@@ -272,6 +272,15 @@ extern "C" {
 # endif
 #endif
 
+/* SPP records are MACed three times and usually sealed with SIMD AES and
+ * SHA code, so their payload, i.e. what follows the 6 byte header and the
+ * explicit IV, starts on a cache line. Only used if SSL3_ALIGN_PAYLOAD is. */
+#ifndef SPP_ALIGN_PAYLOAD
+# define SPP_ALIGN_PAYLOAD			64
+#elif (SPP_ALIGN_PAYLOAD&(SPP_ALIGN_PAYLOAD-1))!=0
+# error "insane SPP_ALIGN_PAYLOAD"
+#endif
+
 /* This is the maximum MAC (digest) size used by the SSL library.
  * Currently maximum of 20 is used by SHA1, but we reserve for
  * future extension for 512-bit hashes.
@@ -304,6 +313,8 @@ extern "C" {
 
 #define SSL3_RT_SEND_MAX_ENCRYPTED_OVERHEAD \
 			(SSL_RT_MAX_CIPHER_BLOCK_SIZE + SSL3_RT_MAX_MD_SIZE)
+#define SPP_RT_SEND_MAX_ENCRYPTED_OVERHEAD \
+			(2*SSL_RT_MAX_CIPHER_BLOCK_SIZE + SSL3_RT_MAX_MD_SIZE*3)
 
 /* If compression isn't used don't include the compression overhead */
 
@@ -321,6 +332,10 @@ extern "C" {
 		(SSL3_RT_MAX_ENCRYPTED_LENGTH+SSL3_RT_HEADER_LENGTH)
 #define SPP_RT_MAX_PACKET_SIZE		\
 		(SPP_RT_MAX_ENCRYPTED_LENGTH+SPP_RT_HEADER_LENGTH)
+/* Datagram records add the epoch and sequence number to the header */
+#define SPP_DGRAM_HEADER_LENGTH		(SPP_RT_HEADER_LENGTH+8)
+#define SPP_DGRAM_MAX_PACKET_SIZE	\
+		(SPP_RT_MAX_ENCRYPTED_LENGTH+SPP_DGRAM_HEADER_LENGTH)
 
 #define SSL3_MD_CLIENT_FINISHED_CONST	"\x43\x4C\x4E\x54"
 #define SSL3_MD_SERVER_FINISHED_CONST	"\x53\x52\x56\x52"
@@ -430,6 +445,10 @@ typedef struct ssl3_state_st
 	unsigned char write_sequence[8];
 	int write_mac_secret_size;
 	unsigned char write_mac_secret[EVP_MAX_MD_SIZE];
+	/* The TLS MAC keys with their HMAC pads precomputed, see
+	 * SSL.read_hmac and SSL.write_hmac. */
+	HMAC_PRECOMP read_hmac_key;
+	HMAC_PRECOMP write_hmac_key;
 
 	unsigned char server_random[SSL3_RANDOM_SIZE];
 	unsigned char client_random[SSL3_RANDOM_SIZE];
@@ -164,11 +164,13 @@
 #define SSL_ENC_SEED_IDX    	11
 #define SSL_ENC_AES128GCM_IDX	12
 #define SSL_ENC_AES256GCM_IDX	13
-#define SSL_ENC_NUM_IDX		14
+#define SSL_ENC_CHACHA20POLY1305_IDX	14
+#define SSL_ENC_NUM_IDX		15
 
 
 static const EVP_CIPHER *ssl_cipher_methods[SSL_ENC_NUM_IDX]={
-	NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL
+	NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,
+	NULL
 	};
 
 #define SSL_COMP_NULL_IDX	0
@@ -299,6 +301,7 @@ static const SSL_CIPHER cipher_aliases[]={
 	{0,SSL_TXT_CAMELLIA128,0,0,0,SSL_CAMELLIA128,0,0,0,0,0,0},
 	{0,SSL_TXT_CAMELLIA256,0,0,0,SSL_CAMELLIA256,0,0,0,0,0,0},
 	{0,SSL_TXT_CAMELLIA   ,0,0,0,SSL_CAMELLIA128|SSL_CAMELLIA256,0,0,0,0,0,0},
+	{0,SSL_TXT_CHACHA20,0,0,0,SSL_CHACHA20POLY1305,0,0,0,0,0,0},
 
 	/* MAC aliases */	
 	{0,SSL_TXT_MD5,0,     0,0,0,SSL_MD5,   0,0,0,0,0},
@@ -396,6 +399,10 @@ void ssl_load_ciphers(void)
 	  EVP_get_cipherbyname(SN_aes_128_gcm);
 	ssl_cipher_methods[SSL_ENC_AES256GCM_IDX]=
 	  EVP_get_cipherbyname(SN_aes_256_gcm);
+#if !defined(OPENSSL_NO_CHACHA) && !defined(OPENSSL_NO_POLY1305)
+	ssl_cipher_methods[SSL_ENC_CHACHA20POLY1305_IDX]=
+	  EVP_get_cipherbyname(SN_chacha20_poly1305);
+#endif
 
 	ssl_digest_methods[SSL_MD_MD5_IDX]=
 		EVP_get_digestbyname(SN_md5);
@@ -558,6 +565,9 @@ int ssl_cipher_get_evp(const SSL_SESSION *s, const EVP_CIPHER **enc,
 	case SSL_AES256GCM:
 		i=SSL_ENC_AES256GCM_IDX;
 		break;
+	case SSL_CHACHA20POLY1305:
+		i=SSL_ENC_CHACHA20POLY1305_IDX;
+		break;
 	default:
 		i= -1;
 		break;
@@ -760,6 +770,7 @@ static void ssl_cipher_get_disabled(unsigned long *mkey, unsigned long *auth, un
 	*enc |= (ssl_cipher_methods[SSL_ENC_AES256_IDX] == NULL) ? SSL_AES256:0;
 	*enc |= (ssl_cipher_methods[SSL_ENC_AES128GCM_IDX] == NULL) ? SSL_AES128GCM:0;
 	*enc |= (ssl_cipher_methods[SSL_ENC_AES256GCM_IDX] == NULL) ? SSL_AES256GCM:0;
+	*enc |= (ssl_cipher_methods[SSL_ENC_CHACHA20POLY1305_IDX] == NULL) ? SSL_CHACHA20POLY1305:0;
 	*enc |= (ssl_cipher_methods[SSL_ENC_CAMELLIA128_IDX] == NULL) ? SSL_CAMELLIA128:0;
 	*enc |= (ssl_cipher_methods[SSL_ENC_CAMELLIA256_IDX] == NULL) ? SSL_CAMELLIA256:0;
 	*enc |= (ssl_cipher_methods[SSL_ENC_GOST89_IDX] == NULL) ? SSL_eGOST2814789CNT:0;
@@ -1683,6 +1694,9 @@ char *SSL_CIPHER_description(const SSL_CIPHER *cipher, char *buf, int len)
 	case SSL_AES256GCM:
 		enc="AESGCM(256)";
 		break;
+	case SSL_CHACHA20POLY1305:
+		enc="ChaCha20-Poly1305";
+		break;
 	case SSL_CAMELLIA128:
 		enc="Camellia(128)";
 		break;
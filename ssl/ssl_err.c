@@ -117,6 +117,11 @@ static ERR_STRING_DATA SSL_str_functs[]=
 {ERR_FUNC(SSL_F_SERVER_FINISH),	"SERVER_FINISH"},
 {ERR_FUNC(SSL_F_SERVER_HELLO),	"SERVER_HELLO"},
 {ERR_FUNC(SSL_F_SERVER_VERIFY),	"SERVER_VERIFY"},
+{ERR_FUNC(SSL_F_SPP_DGRAM_FORWARD),	"SPP_dgram_forward"},
+{ERR_FUNC(SSL_F_SPP_DGRAM_READ),	"SPP_dgram_read"},
+{ERR_FUNC(SSL_F_SPP_DGRAM_WRITE),	"SPP_dgram_write"},
+{ERR_FUNC(SSL_F_SPP_ENC),	"SPP_ENC"},
+{ERR_FUNC(SSL_F_SPP_SET_DGRAM_BIO),	"SPP_set_dgram_bio"},
 {ERR_FUNC(SSL_F_SSL23_ACCEPT),	"SSL23_ACCEPT"},
 {ERR_FUNC(SSL_F_SSL23_CLIENT_HELLO),	"SSL23_CLIENT_HELLO"},
 {ERR_FUNC(SSL_F_SSL23_CONNECT),	"SSL23_CONNECT"},
@@ -205,6 +210,7 @@ static ERR_STRING_DATA SSL_str_functs[]=
 {ERR_FUNC(SSL_F_SSL_CREATE_CIPHER_LIST),	"SSL_CREATE_CIPHER_LIST"},
 {ERR_FUNC(SSL_F_SSL_CTRL),	"SSL_ctrl"},
 {ERR_FUNC(SSL_F_SSL_CTX_CHECK_PRIVATE_KEY),	"SSL_CTX_check_private_key"},
+{ERR_FUNC(SSL_F_SSL_CTX_GET_SPP_STATS_SNAPSHOT),	"SSL_CTX_get_spp_stats_snapshot"},
 {ERR_FUNC(SSL_F_SSL_CTX_MAKE_PROFILES),	"SSL_CTX_MAKE_PROFILES"},
 {ERR_FUNC(SSL_F_SSL_CTX_NEW),	"SSL_CTX_new"},
 {ERR_FUNC(SSL_F_SSL_CTX_SET_CIPHER_LIST),	"SSL_CTX_set_cipher_list"},
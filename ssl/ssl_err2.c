@@ -60,11 +60,29 @@
 #include <openssl/err.h>
 #include <openssl/ssl.h>
 
+#ifndef OPENSSL_NO_ERR
+/* The SPP reason codes are not known to mkerr.pl, see ssl.h */
+static ERR_STRING_DATA SPP_str_reasons[]=
+	{
+{ERR_PACK(ERR_LIB_SSL,0,SPP_R_DGRAM_BIO_NOT_SET),"dgram bio not set"},
+{ERR_PACK(ERR_LIB_SSL,0,SPP_R_DGRAM_BUFFER_TOO_SMALL),"dgram buffer too small"},
+{ERR_PACK(ERR_LIB_SSL,0,SPP_R_DGRAM_SEQUENCE_EXHAUSTED),"dgram sequence exhausted"},
+{ERR_PACK(ERR_LIB_SSL,0,SPP_R_INVALID_PROXY_ID),"invalid proxy id"},
+{ERR_PACK(ERR_LIB_SSL,0,SPP_R_INVALID_SLICE_ID),"invalid slice id"},
+{ERR_PACK(ERR_LIB_SSL,0,SPP_R_MISSING_PROXY),"missing proxy"},
+{ERR_PACK(ERR_LIB_SSL,0,SPP_R_MISSING_SLICE),"missing slice"},
+{ERR_PACK(ERR_LIB_SSL,0,SPP_R_UNSUPPORTED_DGRAM_CIPHER),"unsupported dgram cipher"},
+{0,NULL}
+	};
+#endif
+
 void SSL_load_error_strings(void)
 	{
 #ifndef OPENSSL_NO_ERR
 	ERR_load_crypto_strings();
 	ERR_load_SSL_strings();
+	if (ERR_reason_error_string(SPP_str_reasons[0].error) == NULL)
+		ERR_load_strings(0,SPP_str_reasons);
 #endif
 	}
 
@@ -238,6 +238,22 @@ int SSL_clear(SSL *s)
 
 	s->first_packet=0;
 
+	if (s->spp_pk != NULL)
+		{
+		OPENSSL_free(s->spp_pk);
+		s->spp_pk=NULL;
+		}
+	s->spp_pk_len=0;
+
+	/* SSL_clear() is also called from within the handshake, where the
+	 * arena is in use */
+	if (s->hs_mem_depth == 0)
+		{
+		CRYPTO_mem_arena_free(s->hs_arena);
+		s->hs_arena=NULL;
+		s->hs_mem_running=0;
+		}
+
 #if 1
 	/* Check to see if we were changed into a different method, if
 	 * so, revert back if we are not doing session-id reuse. */
@@ -341,6 +357,9 @@ SSL *SSL_new(SSL_CTX *ctx)
 #endif
 	s->quiet_shutdown=ctx->quiet_shutdown;
 	s->max_send_fragment = ctx->max_send_fragment;
+	s->spp_record_small = ctx->spp_record_small;
+	s->spp_record_boost = ctx->spp_record_boost;
+	s->spp_record_idle = ctx->spp_record_idle;
 
 	CRYPTO_add(&ctx->references,1,CRYPTO_LOCK_SSL_CTX);
 	s->ctx=ctx;
@@ -393,16 +412,22 @@ SSL *SSL_new(SSL_CTX *ctx)
         spp_init_slice(s->def_ctx);
         s->def_ctx->slice_id = 1;
         s->def_ctx->read_mac = (SPP_MAC*)OPENSSL_malloc(sizeof(SPP_MAC));
+        memset(s->def_ctx->read_mac, 0, sizeof(SPP_MAC));
         s->def_ctx->write_mac = s->def_ctx->read_mac;
         s->def_ctx->read_ciph = (SPP_CIPH*)OPENSSL_malloc(sizeof(SPP_CIPH));
+        /* A proxy never gets the endpoint keys and forwards the records of
+         * the default context as they are. */
+        memset(s->def_ctx->read_ciph, 0, sizeof(SPP_CIPH));
         s->spp_server_address = NULL;
         /* Stats variables */
-        s->read_stats.bytes = s->read_stats.app_bytes = s->read_stats.pad_bytes 
-                = s->read_stats.header_bytes = s->read_stats.handshake_bytes
-                = s->read_stats.alert_bytes = s->read_stats.mac_bytes = 0;
-        s->write_stats.bytes = s->write_stats.app_bytes = s->write_stats.pad_bytes 
-                = s->write_stats.header_bytes = s->write_stats.handshake_bytes
-                = s->write_stats.alert_bytes = s->write_stats.mac_bytes = 0;
+        memset(&s->read_stats, 0, sizeof(s->read_stats));
+        memset(&s->write_stats, 0, sizeof(s->write_stats));
+        memset(s->stats_folded, 0, sizeof(s->stats_folded));
+        spp_stats_attach(s);
+        spp_trace_inherit(s);
+        /* Timing is a diagnostic, carry on without it if out of memory */
+        if (ctx->spp_timing_on)
+            SSL_set_spp_timing(s, 1);
 
 	return(s);
 err:
@@ -490,9 +515,7 @@ int SSL_has_matching_session_id(const SSL *ssl, const unsigned char *id,
 		r.session_id_length = SSL2_SSL_SESSION_ID_LENGTH;
 		}
 
-	CRYPTO_r_lock(CRYPTO_LOCK_SSL_CTX);
-	p = lh_SSL_SESSION_retrieve(ssl->ctx->sessions, &r);
-	CRYPTO_r_unlock(CRYPTO_LOCK_SSL_CTX);
+	p = ssl_sess_cache_get(ssl->ctx, &r, 0);
 	return (p != NULL);
 	}
 
@@ -546,6 +569,15 @@ void SSL_free(SSL *s)
 		}
 #endif
 
+	/* Hand the counters of this connection to its SSL_CTX while the
+	 * slices are still around */
+	spp_stats_detach(s);
+	if (s->spp_timing != NULL)
+		OPENSSL_free(s->spp_timing);
+	if (s->spp_pk != NULL)
+		OPENSSL_free(s->spp_pk);
+	CRYPTO_mem_arena_free(s->hs_arena);
+
 	if (s->param)
 		X509_VERIFY_PARAM_free(s->param);
 
@@ -589,6 +621,7 @@ void SSL_free(SSL *s)
             s->proxy_key_mat_shared_secret = NULL;
             s->proxy_key_mat_shared_secret_len = 0;
         }
+        spp_dgram_free(s->spp_dgram);
 
 	if (s->cert != NULL) ssl_cert_free(s->cert);
 	/* Free up if allocated */
@@ -968,7 +1001,7 @@ int SSL_accept(SSL *s)
 		/* Not properly initialized yet */
 		SSL_set_accept_state(s);
 
-	return(s->method->ssl_accept(s));
+	return(ssl_run_handshake(s,s->method->ssl_accept));
 	}
 
 int SSL_connect(SSL *s)
@@ -977,7 +1010,7 @@ int SSL_connect(SSL *s)
 		/* Not properly initialized yet */
 		SSL_set_connect_state(s);
 
-	return(s->method->ssl_connect(s));
+	return(ssl_run_handshake(s,s->method->ssl_connect));
 	}
 int SPP_connect(SSL *ssl, SPP_SLICE* slices[], int slices_len, SPP_PROXY *proxies[], int proxies_len) {
     int i;
@@ -1162,15 +1195,53 @@ int SPP_write_record(SSL *s,const void *buf,int num,SPP_SLICE *slice) {
     s->write_slice = NULL;
     return ret;
 }
+/* Forward a record read with SPP_read_record(). ctx holds the MACs of the
+ * original record and is freed once all num bytes have been written (or
+ * the write failed for good), so after a partial write or a retryable error
+ * pass the same ctx again. Unless modified is set the data goes out as a
+ * single record so the MACs we cannot regenerate stay valid. */
 int SPP_forward_record(SSL *s,const void *buf,int num,SPP_SLICE *slice,SPP_CTX *ctx,int modified) {
     int ret;
     s->write_slice = slice;
     s->spp_write_ctx = ctx;
+    s->spp_write_modified = modified;
     ret = SSL_write(s,buf,num);
+    if (ret <= 0 && s->rwstate == SSL_NOTHING)
+        spp_free_write_ctx(s);
     s->spp_write_ctx = NULL;
+    s->spp_write_modified = 0;
     s->write_slice = NULL;
     return ret;
 }
+
+/* Dynamic record sizing: send application data in records of at most
+ * small bytes until boost bytes have gone out, and again once the
+ * connection has been idle for idle_ms milliseconds (0: never). A small
+ * record gets the first bytes to the peer within one or two TCP segments,
+ * e.g. 1300 bytes keep an SPP record with three SHA-256 MACs in a single
+ * 1460 byte segment. Larger records, up to max_send_fragment, are used for
+ * bulk transfers. small == 0 disables the policy. Proxies apply it to the
+ * records they originate and to records they modify and can re-MAC. */
+int SSL_CTX_set_spp_record_sizing(SSL_CTX *ctx, unsigned int small,
+                                  unsigned long boost, unsigned long idle_ms) {
+    if (small != 0 && (small < 512 || small > SSL3_RT_MAX_PLAIN_LENGTH))
+        return 0;
+    ctx->spp_record_small = small;
+    ctx->spp_record_boost = boost;
+    ctx->spp_record_idle = idle_ms;
+    return 1;
+}
+
+int SSL_set_spp_record_sizing(SSL *s, unsigned int small,
+                              unsigned long boost, unsigned long idle_ms) {
+    if (small != 0 && (small < 512 || small > SSL3_RT_MAX_PLAIN_LENGTH))
+        return 0;
+    s->spp_record_small = small;
+    s->spp_record_boost = boost;
+    s->spp_record_idle = idle_ms;
+    s->spp_record_sent = 0;
+    return 1;
+}
 int SSL_write(SSL *s,const void *buf,int num)
 	{
 	if (s->handshake_func == 0)
@@ -1342,6 +1413,12 @@ long SSL_CTX_ctrl(SSL_CTX *ctx,int cmd,long larg,void *parg)
 		return(l);
 	case SSL_CTRL_GET_SESS_CACHE_SIZE:
 		return(ctx->session_cache_size);
+	case SSL_CTRL_SET_SESS_CACHE_SHARDS:
+		if (larg < 1 || larg > SSL_SESSION_CACHE_MAX_SHARDS)
+			return 0;
+		return ssl_sess_cache_set_shards(ctx,(unsigned int)larg);
+	case SSL_CTRL_GET_SESS_CACHE_SHARDS:
+		return(ctx->sess_nshards);
 	case SSL_CTRL_SET_SESS_CACHE_MODE:
 		l=ctx->session_cache_mode;
 		ctx->session_cache_mode=larg;
@@ -1350,7 +1427,7 @@ long SSL_CTX_ctrl(SSL_CTX *ctx,int cmd,long larg,void *parg)
 		return(ctx->session_cache_mode);
 
 	case SSL_CTRL_SESS_NUMBER:
-		return(lh_SSL_SESSION_num_items(ctx->sessions));
+		return(ssl_sess_cache_num(ctx));
 	case SSL_CTRL_SESS_CONNECT:
 		return(ctx->stats.sess_connect);
 	case SSL_CTRL_SESS_CONNECT_GOOD:
@@ -1386,6 +1463,25 @@ long SSL_CTX_ctrl(SSL_CTX *ctx,int cmd,long larg,void *parg)
 			return 0;
 		ctx->max_send_fragment = larg;
 		return 1;
+	case SSL_CTRL_SET_SPP_SEAL_THREADS:
+		{
+		struct spp_seal_pool_st *pool;
+
+		if (larg < 0 || larg > 64)
+			return 0;
+		/* The pool is (re)started on first use. Writers still sealing
+		 * on the old one hold a reference to it. */
+		CRYPTO_w_lock(CRYPTO_LOCK_SSL_CTX);
+		pool = ctx->spp_seal_pool;
+		ctx->spp_seal_pool = NULL;
+		ctx->spp_seal_threads = larg;
+		CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CTX);
+		if (pool != NULL)
+			spp_seal_pool_free(pool);
+		return 1;
+		}
+	case SSL_CTRL_GET_SPP_SEAL_THREADS:
+		return ctx->spp_seal_threads;
 	default:
 		return(ctx->method->ssl_ctx_ctrl(ctx,cmd,larg,parg));
 		}
@@ -1904,6 +2000,12 @@ static int ssl_session_cmp(const SSL_SESSION *a,const SSL_SESSION *b)
 static IMPLEMENT_LHASH_HASH_FN(ssl_session, SSL_SESSION)
 static IMPLEMENT_LHASH_COMP_FN(ssl_session, SSL_SESSION)
 
+/* A hash table for a shard of the session cache */
+LHASH_OF(SSL_SESSION) *ssl_session_lh_new(void)
+	{
+	return lh_SSL_SESSION_new();
+	}
+
 SSL_CTX *SSL_CTX_new(const SSL_METHOD *meth)
 	{
 	SSL_CTX *ret=NULL;
@@ -1938,8 +2040,6 @@ SSL_CTX *SSL_CTX_new(const SSL_METHOD *meth)
 	ret->cert_store=NULL;
 	ret->session_cache_mode=SSL_SESS_CACHE_SERVER;
 	ret->session_cache_size=SSL_SESSION_CACHE_MAX_SIZE_DEFAULT;
-	ret->session_cache_head=NULL;
-	ret->session_cache_tail=NULL;
 
 	/* We take the system default */
 	ret->session_timeout=meth->get_timeout();
@@ -1984,8 +2084,8 @@ SSL_CTX *SSL_CTX_new(const SSL_METHOD *meth)
 	ret->app_gen_cookie_cb=0;
 	ret->app_verify_cookie_cb=0;
 
-	ret->sessions=lh_SSL_SESSION_new();
-	if (ret->sessions == NULL) goto err;
+	if (!ssl_sess_cache_set_shards(ret,SSL_SESSION_CACHE_SHARDS_DEFAULT))
+		goto err;
 	ret->cert_store=X509_STORE_new();
 	if (ret->cert_store == NULL) goto err;
 
@@ -2058,21 +2158,8 @@ SSL_CTX *SSL_CTX_new(const SSL_METHOD *meth)
 #endif
 #ifndef OPENSSL_NO_BUF_FREELISTS
 	ret->freelist_max_len = SSL_MAX_BUF_FREELIST_LEN_DEFAULT;
-	ret->rbuf_freelist = OPENSSL_malloc(sizeof(SSL3_BUF_FREELIST));
-	if (!ret->rbuf_freelist)
+	if (!ssl3_new_buf_freelists(ret))
 		goto err;
-	ret->rbuf_freelist->chunklen = 0;
-	ret->rbuf_freelist->len = 0;
-	ret->rbuf_freelist->head = NULL;
-	ret->wbuf_freelist = OPENSSL_malloc(sizeof(SSL3_BUF_FREELIST));
-	if (!ret->wbuf_freelist)
-		{
-		OPENSSL_free(ret->rbuf_freelist);
-		goto err;
-		}
-	ret->wbuf_freelist->chunklen = 0;
-	ret->wbuf_freelist->len = 0;
-	ret->wbuf_freelist->head = NULL;
 #endif
 #ifndef OPENSSL_NO_ENGINE
 	ret->client_cert_engine = NULL;
@@ -2112,20 +2199,6 @@ static void SSL_COMP_free(SSL_COMP *comp)
     { OPENSSL_free(comp); }
 #endif
 
-#ifndef OPENSSL_NO_BUF_FREELISTS
-static void
-ssl_buf_freelist_free(SSL3_BUF_FREELIST *list)
-	{
-	SSL3_BUF_FREELIST_ENTRY *ent, *next;
-	for (ent = list->head; ent; ent = next)
-		{
-		next = ent->next;
-		OPENSSL_free(ent);
-		}
-	OPENSSL_free(list);
-	}
-#endif
-
 void SSL_CTX_free(SSL_CTX *a)
 	{
 	int i;
@@ -2162,8 +2235,7 @@ void SSL_CTX_free(SSL_CTX *a)
 
 	CRYPTO_free_ex_data(CRYPTO_EX_INDEX_SSL_CTX, a, &a->ex_data);
 
-	if (a->sessions != NULL)
-		lh_SSL_SESSION_free(a->sessions);
+	ssl_sess_cache_free(a);
 
 	if (a->cert_store != NULL)
 		X509_STORE_free(a->cert_store);
@@ -2202,12 +2274,16 @@ void SSL_CTX_free(SSL_CTX *a)
 #endif
 
 #ifndef OPENSSL_NO_BUF_FREELISTS
-	if (a->wbuf_freelist)
-		ssl_buf_freelist_free(a->wbuf_freelist);
-	if (a->rbuf_freelist)
-		ssl_buf_freelist_free(a->rbuf_freelist);
+	ssl3_free_buf_freelists(a);
 #endif
 
+	if (a->spp_seal_pool != NULL)
+		spp_seal_pool_free(a->spp_seal_pool);
+	if (a->spp_slice_stats != NULL)
+		OPENSSL_free(a->spp_slice_stats);
+	if (a->spp_timing != NULL)
+		OPENSSL_free(a->spp_timing);
+
 	OPENSSL_free(a);
 	}
 
@@ -2789,11 +2865,83 @@ int SSL_do_handshake(SSL *s)
 
 	if (SSL_in_init(s) || SSL_in_before(s))
 		{
-		ret=s->handshake_func(s);
+		ret=ssl_run_handshake(s,s->handshake_func);
+		}
+	return(ret);
+	}
+
+/* Runs a step of the handshake of |s|, counting its allocations and, in
+ * SSL_MODE_HANDSHAKE_ARENA, serving them from the handshake's arena. The
+ * counters are reset when a new handshake starts, the arena is freed when
+ * it is over. Calls made from within the handshake run |func| directly. */
+int ssl_run_handshake(SSL *s, int (*func)(SSL *))
+	{
+	CRYPTO_MEM_ARENA *prev=NULL;
+	CRYPTO_MEM_STATS before,after;
+	int ret;
+
+	if (s->hs_mem_depth > 0)
+		return func(s);
+
+	if (!s->hs_mem_running)
+		{
+		memset(&s->hs_mem_stats,0,sizeof(s->hs_mem_stats));
+		if ((s->mode & SSL_MODE_HANDSHAKE_ARENA) && s->hs_arena == NULL)
+			s->hs_arena=CRYPTO_mem_arena_new();
+		s->hs_mem_running=1;
+		}
+
+	s->hs_mem_depth++;
+	if (s->hs_arena != NULL)
+		prev=CRYPTO_mem_arena_switch(s->hs_arena);
+	CRYPTO_mem_stats(&before);
+	ret=func(s);
+	CRYPTO_mem_stats(&after);
+	if (s->hs_arena != NULL)
+		CRYPTO_mem_arena_switch(prev);
+	s->hs_mem_depth--;
+
+	s->hs_mem_stats.allocs+=after.allocs-before.allocs;
+	s->hs_mem_stats.frees+=after.frees-before.frees;
+	s->hs_mem_stats.bytes+=after.bytes-before.bytes;
+	s->hs_mem_stats.cached+=after.cached-before.cached;
+	s->hs_mem_stats.arena+=after.arena-before.arena;
+
+	if (!SSL_in_init(s))
+		{
+		CRYPTO_mem_arena_free(s->hs_arena);
+		s->hs_arena=NULL;
+		s->hs_mem_running=0;
 		}
 	return(ret);
 	}
 
+/* Objects made during a handshake that stay with the connection or the
+ * session (the session, the peer's certificate and keys, the cipher state)
+ * are kept out of the handshake's arena, where they would each hold on to
+ * a chunk of it after the handshake. ssl_arena_leave() returns the arena to
+ * hand back to ssl_arena_enter() when done. */
+CRYPTO_MEM_ARENA *ssl_arena_leave(SSL *s)
+	{
+	if (s->hs_arena == NULL)
+		return NULL;
+	return CRYPTO_mem_arena_switch(NULL);
+	}
+
+void ssl_arena_enter(SSL *s, CRYPTO_MEM_ARENA *arena)
+	{
+	if (arena != NULL)
+		CRYPTO_mem_arena_switch(arena);
+	}
+
+/* Allocations made by the current or last handshake of |s|, including
+ * those of a middlebox's other SSL when it is driven from this one. All
+ * zero unless CRYPTO_mem_cache_setup() installed the allocator. */
+void SSL_get_handshake_mem_stats(const SSL *s, CRYPTO_MEM_STATS *st)
+	{
+	*st=s->hs_mem_stats;
+	}
+
 /* For the next 2 functions, SSL_clear() sets shutdown and so
  * one of these calls will reset it */
 void SSL_set_accept_state(SSL *s)
@@ -2994,6 +3142,7 @@ void spp_clear_slice_ctx(SSL *s, SPP_SLICE *slice){
     if (slice->read_mac != NULL) {
         ssl_clear_hash_ctx(&slice->read_mac->read_hash);
         ssl_clear_hash_ctx(&slice->read_mac->write_hash);
+        OPENSSL_cleanse(slice->read_mac, sizeof(SPP_MAC));
         OPENSSL_free(slice->read_mac);
         slice->read_mac = NULL;
     }
@@ -3008,6 +3157,18 @@ void spp_clear_slice_ctx(SSL *s, SPP_SLICE *slice){
         }
         slice->read_ciph = NULL;
     }
+    if (slice->write_ciph != NULL) {
+        if (slice->write_ciph->enc_read_ctx != NULL) {
+            EVP_CIPHER_CTX_cleanup(slice->write_ciph->enc_read_ctx);
+            OPENSSL_free(slice->write_ciph->enc_read_ctx);
+        }
+        if (slice->write_ciph->enc_write_ctx != NULL) {
+            EVP_CIPHER_CTX_cleanup(slice->write_ciph->enc_write_ctx);
+            OPENSSL_free(slice->write_ciph->enc_write_ctx);
+        }
+        OPENSSL_free(slice->write_ciph);
+        slice->write_ciph = NULL;
+    }
     if (slice->purpose != NULL) {
         OPENSSL_free(slice->purpose);
         slice->purpose = NULL;
@@ -3070,6 +3231,9 @@ void ssl_clear_cipher_ctx(SSL *s)
 		s->compress=NULL;
 		}
 #endif
+	/* The keys themselves are kept in s->s3 or in the SPP slices. */
+	s->read_hmac=NULL;
+	s->write_hmac=NULL;
 	}
 
 /* Fix this function so that it takes an optional type parameter */
@@ -3237,9 +3401,13 @@ SSL_CTX *SSL_set_SSL_CTX(SSL *ssl, SSL_CTX* ctx)
 		ssl_cert_free(ocert);
 		}
 	CRYPTO_add(&ctx->references,1,CRYPTO_LOCK_SSL_CTX);
+	/* the traffic so far stays with the old context */
+	spp_stats_detach(ssl);
 	if (ssl->ctx != NULL)
 		SSL_CTX_free(ssl->ctx); /* decrement reference count */
 	ssl->ctx = ctx;
+	spp_stats_attach(ssl);
+	spp_trace_inherit(ssl);
 	return(ssl->ctx);
 	}
 
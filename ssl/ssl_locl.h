@@ -332,6 +332,7 @@
 #define SSL_SEED		0x00000800L
 #define SSL_AES128GCM		0x00001000L
 #define SSL_AES256GCM		0x00002000L
+#define SSL_CHACHA20POLY1305	0x00004000L
 
 #define SSL_AES        		(SSL_AES128|SSL_AES256|SSL_AES128GCM|SSL_AES256GCM)
 #define SSL_CAMELLIA		(SSL_CAMELLIA128|SSL_CAMELLIA256)
@@ -601,13 +602,27 @@ typedef struct ssl3_comp_st
 #endif
 
 #ifndef OPENSSL_NO_BUF_FREELISTS
+/* Number of buffer sizes kept per direction, see freelist_extract() */
+#define SSL3_BUF_FREELIST_CLASSES	4
+/* Size of a buffer slab for SSL_MODE_SPP_BUFFER_SLABS (a huge page) */
+#define SSL3_BUF_SLAB_SIZE		(2*1024*1024)
+
 typedef struct ssl3_buf_freelist_st
 	{
 	size_t chunklen;
 	unsigned int len;
+	int slab;	/* chunks are carved from slabs and never freed */
 	struct ssl3_buf_freelist_entry_st *head;
 	} SSL3_BUF_FREELIST;
 
+typedef struct ssl3_buf_slab_st
+	{
+	struct ssl3_buf_slab_st *next;
+	unsigned char *base;
+	size_t size;
+	int mapped;
+	} SSL3_BUF_SLAB;
+
 typedef struct ssl3_buf_freelist_entry_st
 	{
 	struct ssl3_buf_freelist_entry_st *next;
@@ -865,6 +880,9 @@ struct openssl_ssl_test_functions
 #ifndef OPENSSL_UNIT_TEST
 
 void ssl_clear_cipher_ctx(SSL *s);
+int ssl_run_handshake(SSL *s, int (*func)(SSL *));
+CRYPTO_MEM_ARENA *ssl_arena_leave(SSL *s);
+void ssl_arena_enter(SSL *s, CRYPTO_MEM_ARENA *arena);
 void spp_clear_slices_ctx(SSL *s);
 void spp_clear_slice_ctx(SSL *s, SPP_SLICE* slice);
 void spp_clear_proxy_ctx(SSL *s, SPP_PROXY* proxy);
@@ -892,6 +910,11 @@ STACK_OF(SSL_CIPHER) *ssl_create_cipher_list(const SSL_METHOD *meth,
 					     STACK_OF(SSL_CIPHER) **sorted,
 					     const char *rule_str);
 void ssl_update_cache(SSL *s, int mode);
+LHASH_OF(SSL_SESSION) *ssl_session_lh_new(void);
+int ssl_sess_cache_set_shards(SSL_CTX *ctx, unsigned int n);
+void ssl_sess_cache_free(SSL_CTX *ctx);
+unsigned long ssl_sess_cache_num(SSL_CTX *ctx);
+SSL_SESSION *ssl_sess_cache_get(SSL_CTX *ctx, const SSL_SESSION *key, int ref);
 int ssl_cipher_get_evp(const SSL_SESSION *s,const EVP_CIPHER **enc,
 		       const EVP_MD **md,int *mac_pkey_type,int *mac_secret_size, SSL_COMP **comp);
 int ssl_get_handshake_digest(int i,long *mask,const EVP_MD **md);			   
@@ -975,8 +998,13 @@ SSL_CIPHER *ssl3_choose_cipher(SSL *ssl,STACK_OF(SSL_CIPHER) *clnt,
 int	ssl3_setup_buffers(SSL *s);
 int	ssl3_setup_read_buffer(SSL *s);
 int	ssl3_setup_write_buffer(SSL *s);
+int	ssl3_grow_write_buffer(SSL *s, size_t len);
 int	ssl3_release_read_buffer(SSL *s);
 int	ssl3_release_write_buffer(SSL *s);
+#ifndef OPENSSL_NO_BUF_FREELISTS
+int	ssl3_new_buf_freelists(SSL_CTX *ctx);
+void	ssl3_free_buf_freelists(SSL_CTX *ctx);
+#endif
 int	ssl3_digest_cached_records(SSL *s);
 int	ssl3_new(SSL *s);
 void	ssl3_free(SSL *s);
@@ -1102,6 +1130,8 @@ int spp_get_end_key_material(SSL *s);
 int spp_get_end_key_material_client(SSL *s);
 int spp_get_end_key_material_server(SSL *s);
 void spp_print_buffer(unsigned char *buf, int len);
+/* The precomputed key of an SPP_MAC half, or NULL if there is none. */
+#define SPP_HMAC_KEY(k)	((k)->type != NID_undef ? (k) : NULL)
 int spp_copy_mac_state(SSL *s, SPP_MAC *mac, int send);
 int spp_copy_mac_back(SSL *s, SPP_MAC *mac, int send);
 int spp_copy_ciph_state(SSL *s, SPP_CIPH *ciph, int send);
@@ -1113,6 +1143,10 @@ SPP_MAC* spp_init_mac_st(SSL* s, SPP_MAC* mac, unsigned char* key, int which);
 int spp_init_integrity_st(SSL *s);
 int spp_init_slices_st(SSL *s, int which);
 int spp_store_defaults(SSL *s, int which);
+int spp_aead_slice(SSL *s, SPP_SLICE *slice);
+int spp_aead_seal(SSL *s, SPP_SLICE *slice, int type, unsigned char *rec,
+                  unsigned int len, SPP_CTX *ctx, int *macs);
+int spp_aead_open(SSL *s, SPP_SLICE *slice, SPP_CTX *ctx, int *macs);
 void spp_init_proxy(SPP_PROXY *proxy);
 void spp_init_slice(SPP_SLICE *slice);
 void log_time(char *message, struct timeval *currTime, struct timeval *prevTime, struct timeval *originTime);
@@ -1156,6 +1190,8 @@ int ssl_init_wbio_buffer(SSL *s, int push);
 void ssl_free_wbio_buffer(SSL *s);
 
 int tls1_change_cipher_state(SSL *s, int which);
+const HMAC_PRECOMP *tls1_precompute_mac(SSL *s, HMAC_PRECOMP *key,
+	const unsigned char *secret, int len);
 int tls1_setup_key_block(SSL *s);
 int tls1_enc(SSL *s, int snd);
 int tls1_final_finish_mac(SSL *s,
@@ -1182,6 +1218,87 @@ int spp_read_bytes(SSL *s, int type, unsigned char *buf, int len, int peek);
 int spp_write_bytes(SSL *s, int type, const void *buf, int len);
 int spp_dispatch_alert(SSL *s);
 long spp_get_message(SSL *s, int st1, int stn, int mt, long max, int *ok);
+
+/* Batched SPP record sealing (spp_par.c) */
+typedef struct spp_seal_pool_st SPP_SEAL_POOL;
+SPP_SEAL_POOL *spp_seal_pool_new(int nthreads);
+void spp_seal_pool_free(SPP_SEAL_POOL *pool);
+int spp_can_write_large(SSL *s, int type, unsigned int len);
+int spp_write_large(SSL *s, int type, const unsigned char *buf, unsigned int len);
+void spp_free_write_ctx(SSL *s);
+long spp_payload_align(SSL *s, const unsigned char *buf, int send);
+void spp_stats_record(SSL *s, SPP_SLICE *slice, int direction,
+                      unsigned int wire, unsigned int app, unsigned int mac,
+                      int opaque);
+void spp_stats_failure(SSL *s, SPP_SLICE *slice, int mac);
+void spp_stats_attach(SSL *s);
+void spp_stats_detach(SSL *s);
+
+typedef struct spp_timing_st {
+    SPP_TIMING_HIST stage[SPP_TIMING_STAGES];
+} SPP_TIMING;
+
+/* Stage timers of the SPP record layer. A timer is a local SPP_COUNTER,
+ * SPP_TIMER() declares one and must come last among the declarations.
+ * SPP_TIMING_LAP() adds the time since the timer was last started or
+ * lapped to a stage (none if stage is -1) and restarts it. All of them
+ * cost one pointer test unless timing is on for the SSL and compile to
+ * nothing with no-spp-timing. */
+#ifndef OPENSSL_NO_SPP_TIMING
+SPP_COUNTER spp_timing_now(void);
+void spp_timing_lap(SSL *s, int stage, SPP_COUNTER *timer);
+#define SPP_TIMER(t)                SPP_COUNTER t = 0
+#define SPP_TIMING_START(s, t)      do { if ((s)->spp_timing != NULL) (t) = spp_timing_now(); } while (0)
+#define SPP_TIMING_LAP(s, stage, t) do { if ((s)->spp_timing != NULL) spp_timing_lap((s), (stage), &(t)); } while (0)
+#else
+#define SPP_TIMER(t)
+#define SPP_TIMING_START(s, t)
+#define SPP_TIMING_LAP(s, stage, t)
+#endif
+
+/* Public key operation accounting, see SPP_get_pk_stats(). SPP_PK_START()
+ * starts an SPP_TIMER() and SPP_PK_END() counts the operation op for the
+ * middlebox proxy_id (0 for the endpoints) with the time since. Unlike the
+ * stage timers these are always on, next to a public key operation a
+ * clock read is noise. spp_pk_sign_op() is the SPP_PK_*_SIGN, or with
+ * verify SPP_PK_*_VERIFY, operation for pkey's type. */
+void spp_pk_count(SSL *s, int op, int proxy_id, SPP_COUNTER start);
+int spp_pk_sign_op(const EVP_PKEY *pkey, int verify);
+#ifndef OPENSSL_NO_SPP_TIMING
+#define SPP_PK_START(t)                 ((t) = spp_timing_now())
+#define SPP_PK_END(s, op, proxy_id, t)  spp_pk_count((s), (op), (proxy_id), (t))
+#else
+#define SPP_PK_START(t)
+#define SPP_PK_END(s, op, proxy_id, t)  spp_pk_count((s), (op), (proxy_id), 0)
+#endif
+
+/* SPP trace events the SSL wants (SPP_TRACE_*) */
+#define SPP_TRACE_FLAGS(s) ((s)->spp_trace_flags)
+void spp_trace_inherit(SSL *s);
+void spp_trace_message(SSL *s, int write_p, int content_type,
+                       const unsigned char *msg, size_t len);
+void spp_trace_record(SSL *s, int write_p, int content_type, SPP_SLICE *slice,
+                      size_t len, size_t wire_len, int macs, int opaque);
+
+typedef struct spp_dgram_st {
+    BIO *bio;
+    unsigned int w_epoch;
+    unsigned int r_epoch;
+    /* Epoch and sequence number of the last record sent */
+    unsigned char w_seq[8];
+    /* Records received in the current epoch */
+    DTLS1_BITMAP bitmap;
+    /* One datagram, SPP_DGRAM_MAX_PACKET_SIZE bytes */
+    unsigned char *buf;
+    /* A record opened but not yet returned by SPP_dgram_read(), because
+     * the caller's buffer was too small; its data is in buf. */
+    SPP_SLICE *pend_slice;
+    SPP_CTX *pend_ctx;
+    unsigned char *pend_data;
+    int pend_len;
+} SPP_DGRAM;
+SPP_DGRAM *spp_dgram_new(void);
+void spp_dgram_free(SPP_DGRAM *d);
 /* TODO: add other needed SPP internal methods here. */
 
 #ifndef OPENSSL_NO_ECDH
@@ -214,6 +214,16 @@ static int ssl_set_pkey(CERT *c, EVP_PKEY *pkey)
 			}
 		}
 
+#ifndef OPENSSL_NO_RSA
+	/* Set up the Montgomery contexts once now, so that the private key
+	 * operations of the handshakes don't check for them under
+	 * CRYPTO_LOCK_RSA; they make them themselves if this fails. */
+	if ((pkey->type == EVP_PKEY_RSA) &&
+		(RSA_get_method(pkey->pkey.rsa) == RSA_PKCS1_SSLeay()) &&
+		!RSA_setup_mont(pkey->pkey.rsa,NULL))
+		ERR_clear_error();
+#endif
+
 	if (c->pkeys[i].privatekey != NULL)
 		EVP_PKEY_free(c->pkeys[i].privatekey);
 	CRYPTO_add(&pkey->references,1,CRYPTO_LOCK_EVP_PKEY);
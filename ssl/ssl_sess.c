@@ -143,9 +143,186 @@
 #endif
 #include "ssl_locl.h"
 
-static void SSL_SESSION_list_remove(SSL_CTX *ctx, SSL_SESSION *s);
-static void SSL_SESSION_list_add(SSL_CTX *ctx,SSL_SESSION *s);
+/* The internal session cache is split into shards by a hash of the session
+ * ID, each with a hash table, a list of its sessions, most recently used
+ * first, a list of them in the order they expire and a dynamic lock of its
+ * own, so that handshakes looking up, adding and expiring different
+ * sessions don't all wait for one another. Without dynamic lock callbacks
+ * when the cache is made, all shards are under CRYPTO_LOCK_SSL_CTX. */
+typedef struct ssl_sess_shard_st
+	{
+	LHASH_OF(SSL_SESSION) *sessions;
+	SSL_SESSION *head;
+	SSL_SESSION *tail;
+	SSL_SESSION *exp_head;	/* expires first */
+	SSL_SESSION *exp_tail;
+	int lock;	/* dynamic lock id, 0 for none */
+	struct CRYPTO_dynlock_value *dynlock;
+	} SSL_SESS_SHARD;
+
+static void SSL_SESSION_list_remove(SSL_SESS_SHARD *sh, SSL_SESSION *s);
+static void SSL_SESSION_list_add(SSL_SESS_SHARD *sh, SSL_SESSION *s);
+static void sess_expiry_add(SSL_SESS_SHARD *sh, SSL_SESSION *s);
+static void sess_expiry_remove(SSL_SESS_SHARD *sh, SSL_SESSION *s);
 static int remove_session_lock(SSL_CTX *ctx, SSL_SESSION *c, int lck);
+static void sess_shard_timeout(SSL_CTX *ctx, SSL_SESS_SHARD *sh, long t);
+
+/* CRYPTO_w_lock() of a dynamic lock id looks it up under
+ * CRYPTO_LOCK_DYNLOCK, which would have every shard wait for one lock
+ * again, so the shard keeps the lock it got and hands it to the dynamic
+ * lock callback itself. */
+static void sess_shard_do_lock(SSL_SESS_SHARD *sh, int mode)
+	{
+	void (*cb)(int mode,struct CRYPTO_dynlock_value *l,const char *file,
+		int line);
+
+	if (sh->dynlock != NULL &&
+		(cb=CRYPTO_get_dynlock_lock_callback()) != NULL)
+		cb(mode|CRYPTO_WRITE,sh->dynlock,__FILE__,__LINE__);
+	else
+		CRYPTO_lock(mode|CRYPTO_WRITE,CRYPTO_LOCK_SSL_CTX,
+			__FILE__,__LINE__);
+	}
+
+#define sess_shard_lock(sh)	sess_shard_do_lock(sh,CRYPTO_LOCK)
+#define sess_shard_unlock(sh)	sess_shard_do_lock(sh,CRYPTO_UNLOCK)
+
+/* The lhash of a shard hashes the first bytes of the ID, so the shard is
+ * picked by an FNV-1a hash of all of it. */
+static SSL_SESS_SHARD *sess_shard(SSL_CTX *ctx, const SSL_SESSION *s)
+	{
+	unsigned long h=2166136261UL;
+	unsigned int i;
+
+	for (i=0; i<s->session_id_length; i++)
+		h=((h^s->session_id[i])*16777619UL)&0xffffffffUL;
+	return &ctx->sess_shards[h%ctx->sess_nshards];
+	}
+
+static void sess_shards_free(SSL_SESS_SHARD *shards, unsigned int n)
+	{
+	unsigned int i;
+
+	for (i=0; i<n; i++)
+		{
+		if (shards[i].sessions == NULL)
+			break;
+		lh_SSL_SESSION_free(shards[i].sessions);
+		if (shards[i].lock != 0)
+			{
+			/* for CRYPTO_get_dynlock_value() and for making it */
+			if (shards[i].dynlock != NULL)
+				CRYPTO_destroy_dynlockid(shards[i].lock);
+			CRYPTO_destroy_dynlockid(shards[i].lock);
+			}
+		}
+	OPENSSL_free(shards);
+	}
+
+/* (Re)makes the session cache of ctx with n shards; fails if it holds
+ * any sessions. */
+int ssl_sess_cache_set_shards(SSL_CTX *ctx, unsigned int n)
+	{
+	SSL_SESS_SHARD *shards;
+	unsigned int i;
+
+	if (n < 1 || n > SSL_SESSION_CACHE_MAX_SHARDS)
+		return 0;
+	if (ctx->sess_shards != NULL && ssl_sess_cache_num(ctx) > 0)
+		return 0;
+	if ((shards=OPENSSL_malloc(n*sizeof(*shards))) == NULL)
+		return 0;
+	memset(shards,0,n*sizeof(*shards));
+	for (i=0; i<n; i++)
+		{
+		if ((shards[i].sessions=ssl_session_lh_new()) == NULL)
+			{
+			sess_shards_free(shards,n);
+			return 0;
+			}
+		if (CRYPTO_get_dynlock_create_callback() != NULL &&
+			(shards[i].lock=CRYPTO_get_new_dynlockid()) != 0)
+			shards[i].dynlock=CRYPTO_get_dynlock_value(shards[i].lock);
+		}
+	ssl_sess_cache_free(ctx);
+	ctx->sess_shards=shards;
+	ctx->sess_nshards=n;
+	ctx->sessions=shards[0].sessions;
+	return 1;
+	}
+
+/* After SSL_CTX_flush_sessions(ctx,0) */
+void ssl_sess_cache_free(SSL_CTX *ctx)
+	{
+	if (ctx->sess_shards != NULL)
+		sess_shards_free(ctx->sess_shards,ctx->sess_nshards);
+	ctx->sess_shards=NULL;
+	ctx->sess_nshards=0;
+	ctx->sessions=NULL;
+	}
+
+unsigned long ssl_sess_cache_num(SSL_CTX *ctx)
+	{
+	unsigned long n=0;
+	unsigned int i;
+
+	for (i=0; i<ctx->sess_nshards; i++)
+		n+=lh_SSL_SESSION_num_items(ctx->sess_shards[i].sessions);
+	return n;
+	}
+
+/* Finds the session with the ID and version of key in the internal cache.
+ * With ref set, the session is returned with a reference of the caller's
+ * own and counts as used; without, the result is only good for comparing
+ * with NULL. */
+SSL_SESSION *ssl_sess_cache_get(SSL_CTX *ctx, const SSL_SESSION *key, int ref)
+	{
+	SSL_SESS_SHARD *sh;
+	SSL_SESSION *ret;
+
+	if (ctx->sess_shards == NULL)
+		return NULL;
+	sh=sess_shard(ctx,key);
+	sess_shard_lock(sh);
+	ret=lh_SSL_SESSION_retrieve(sh->sessions,key);
+	if (ret != NULL && ref)
+		{
+		/* don't allow other threads to steal it: */
+		CRYPTO_add(&ret->references,1,CRYPTO_LOCK_SSL_SESSION);
+		SSL_SESSION_list_add(sh,ret);
+		}
+	sess_shard_unlock(sh);
+	return ret;
+	}
+
+/* The hash table of shard i of the internal cache, NULL past the last one */
+LHASH_OF(SSL_SESSION) *SSL_CTX_sessions_shard(SSL_CTX *ctx, unsigned int i)
+	{
+	if (i >= ctx->sess_nshards)
+		return NULL;
+	return ctx->sess_shards[i].sessions;
+	}
+
+/* Calls func for every session in the internal cache, one shard at a time
+ * with the shard locked, so func must not add sessions to or remove them
+ * from the cache of ctx. */
+void SSL_CTX_sessions_doall(SSL_CTX *ctx,
+	void (*func)(SSL_SESSION *sess, void *arg), void *arg)
+	{
+	SSL_SESS_SHARD *sh;
+	SSL_SESSION *s;
+	unsigned int i;
+
+	for (i=0; i<ctx->sess_nshards; i++)
+		{
+		sh=&ctx->sess_shards[i];
+		sess_shard_lock(sh);
+		for (s=sh->head; s != NULL && s != (SSL_SESSION *)&(sh->tail);
+			s=s->next)
+			func(s,arg);
+		sess_shard_unlock(sh);
+		}
+	}
 
 SSL_SESSION *SSL_get_session(const SSL *ssl)
 /* aka SSL_get0_session; gets 0 objects, just returns a copy of the pointer */
@@ -276,8 +453,13 @@ int ssl_get_new_session(SSL *s, int session)
 	unsigned int tmp;
 	SSL_SESSION *ss=NULL;
 	GEN_SESSION_CB cb = def_generate_session_id;
+	CRYPTO_MEM_ARENA *arena;
 
-	if ((ss=SSL_SESSION_new()) == NULL) return(0);
+	/* the session outlives the handshake */
+	arena=ssl_arena_leave(s);
+	ss=SSL_SESSION_new();
+	ssl_arena_enter(s,arena);
+	if (ss == NULL) return(0);
 
 	/* If the context has a default timeout, use it */
 	if (s->session_ctx->session_timeout == 0)
@@ -512,14 +694,7 @@ int ssl_get_prev_session(SSL *s, unsigned char *session_id, int len,
 		if (len == 0)
 			return 0;
 		memcpy(data.session_id,session_id,len);
-		CRYPTO_r_lock(CRYPTO_LOCK_SSL_CTX);
-		ret=lh_SSL_SESSION_retrieve(s->session_ctx->sessions,&data);
-		if (ret != NULL)
-			{
-			/* don't allow other threads to steal it: */
-			CRYPTO_add(&ret->references,1,CRYPTO_LOCK_SSL_SESSION);
-			}
-		CRYPTO_r_unlock(CRYPTO_LOCK_SSL_CTX);
+		ret=ssl_sess_cache_get(s->session_ctx,&data,1);
 		if (ret == NULL)
 			s->session_ctx->stats.sess_miss++;
 		}
@@ -639,6 +814,8 @@ int SSL_CTX_add_session(SSL_CTX *ctx, SSL_SESSION *c)
 	{
 	int ret=0;
 	SSL_SESSION *s;
+	SSL_SESS_SHARD *sh;
+	unsigned long max;
 
 	/* add just 1 reference count for the SSL_CTX's session cache
 	 * even though it has two ways of access: each session is in a
@@ -646,16 +823,18 @@ int SSL_CTX_add_session(SSL_CTX *ctx, SSL_SESSION *c)
 	CRYPTO_add(&c->references,1,CRYPTO_LOCK_SSL_SESSION);
 	/* if session c is in already in cache, we take back the increment later */
 
-	CRYPTO_w_lock(CRYPTO_LOCK_SSL_CTX);
-	s=lh_SSL_SESSION_insert(ctx->sessions,c);
+	sh=sess_shard(ctx,c);
+	sess_shard_lock(sh);
+	s=lh_SSL_SESSION_insert(sh->sessions,c);
 	
 	/* s != NULL iff we already had a session with the given PID.
 	 * In this case, s == c should hold (then we did not really modify
-	 * ctx->sessions), or we're in trouble. */
+	 * sh->sessions), or we're in trouble. */
 	if (s != NULL && s != c)
 		{
 		/* We *are* in trouble ... */
-		SSL_SESSION_list_remove(ctx,s);
+		SSL_SESSION_list_remove(sh,s);
+		sess_expiry_remove(sh,s);
 		SSL_SESSION_free(s);
 		/* ... so pretend the other session did not exist in cache
 		 * (we cannot handle two SSL_SESSION structures with identical
@@ -667,7 +846,10 @@ int SSL_CTX_add_session(SSL_CTX *ctx, SSL_SESSION *c)
 
  	/* Put at the head of the queue unless it is already in the cache */
 	if (s == NULL)
-		SSL_SESSION_list_add(ctx,c);
+		{
+		SSL_SESSION_list_add(sh,c);
+		sess_expiry_add(sh,c);
+		}
 
 	if (s != NULL)
 		{
@@ -679,24 +861,25 @@ int SSL_CTX_add_session(SSL_CTX *ctx, SSL_SESSION *c)
 		}
 	else
 		{
-		/* new cache entry -- remove old ones if cache has become too large */
+		/* new cache entry -- remove old one if the shard has
+		 * become too large */
 		
 		ret=1;
 
-		if (SSL_CTX_sess_get_cache_size(ctx) > 0)
+		if (ctx->session_cache_size > 0)
 			{
-			while (SSL_CTX_sess_number(ctx) >
-				SSL_CTX_sess_get_cache_size(ctx))
+			max=(ctx->session_cache_size+ctx->sess_nshards-1)/
+				ctx->sess_nshards;
+			while (lh_SSL_SESSION_num_items(sh->sessions) > max)
 				{
-				if (!remove_session_lock(ctx,
-					ctx->session_cache_tail, 0))
+				if (!remove_session_lock(ctx,sh->tail,0))
 					break;
 				else
 					ctx->stats.sess_cache_full++;
 				}
 			}
 		}
-	CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CTX);
+	sess_shard_unlock(sh);
 	return(ret);
 	}
 
@@ -707,20 +890,24 @@ int SSL_CTX_remove_session(SSL_CTX *ctx, SSL_SESSION *c)
 
 static int remove_session_lock(SSL_CTX *ctx, SSL_SESSION *c, int lck)
 	{
+	SSL_SESS_SHARD *sh;
 	SSL_SESSION *r;
 	int ret=0;
 
-	if ((c != NULL) && (c->session_id_length != 0))
+	if ((c != NULL) && (c->session_id_length != 0) &&
+		(ctx->sess_shards != NULL))
 		{
-		if(lck) CRYPTO_w_lock(CRYPTO_LOCK_SSL_CTX);
-		if ((r = lh_SSL_SESSION_retrieve(ctx->sessions,c)) == c)
+		sh=sess_shard(ctx,c);
+		if(lck) sess_shard_lock(sh);
+		if ((r = lh_SSL_SESSION_retrieve(sh->sessions,c)) == c)
 			{
 			ret=1;
-			r=lh_SSL_SESSION_delete(ctx->sessions,c);
-			SSL_SESSION_list_remove(ctx,c);
+			r=lh_SSL_SESSION_delete(sh->sessions,c);
+			SSL_SESSION_list_remove(sh,c);
+			sess_expiry_remove(sh,c);
 			}
 
-		if(lck) CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CTX);
+		if(lck) sess_shard_unlock(sh);
 
 		if (ret)
 			{
@@ -963,46 +1150,46 @@ int SSL_set_session_ticket_ext(SSL *s, void *ext_data, int ext_len)
 	}
 #endif /* OPENSSL_NO_TLSEXT */
 
-typedef struct timeout_param_st
+/* Removes the sessions of a shard expired at time t, all of them if t is
+ * 0. Only those at the head of the expiry list are looked at. A session
+ * whose time or timeout was changed in the cache is where it was when it
+ * was added: if it expires later now it goes back in its new place, if
+ * earlier it stays until its old turn (lookups check the time themselves).
+ * Locked by the caller. */
+static void sess_shard_timeout(SSL_CTX *ctx, SSL_SESS_SHARD *sh, long t)
 	{
-	SSL_CTX *ctx;
-	long time;
-	LHASH_OF(SSL_SESSION) *cache;
-	} TIMEOUT_PARAM;
+	SSL_SESSION *s;
 
-static void timeout_doall_arg(SSL_SESSION *s, TIMEOUT_PARAM *p)
-	{
-	if ((p->time == 0) || (p->time > (s->time+s->timeout))) /* timeout */
+	while ((s=sh->exp_head) != NULL && (t == 0 || t > s->expires))
 		{
+		sess_expiry_remove(sh,s);
+		if ((t != 0) && (t <= (s->time+s->timeout)))
+			{
+			sess_expiry_add(sh,s);
+			continue;
+			}
 		/* The reason we don't call SSL_CTX_remove_session() is to
 		 * save on locking overhead */
-		(void)lh_SSL_SESSION_delete(p->cache,s);
-		SSL_SESSION_list_remove(p->ctx,s);
+		(void)lh_SSL_SESSION_delete(sh->sessions,s);
+		SSL_SESSION_list_remove(sh,s);
 		s->not_resumable=1;
-		if (p->ctx->remove_session_cb != NULL)
-			p->ctx->remove_session_cb(p->ctx,s);
+		if (ctx->remove_session_cb != NULL)
+			ctx->remove_session_cb(ctx,s);
 		SSL_SESSION_free(s);
 		}
 	}
 
-static IMPLEMENT_LHASH_DOALL_ARG_FN(timeout, SSL_SESSION, TIMEOUT_PARAM)
-
 void SSL_CTX_flush_sessions(SSL_CTX *s, long t)
 	{
-	unsigned long i;
-	TIMEOUT_PARAM tp;
-
-	tp.ctx=s;
-	tp.cache=s->sessions;
-	if (tp.cache == NULL) return;
-	tp.time=t;
-	CRYPTO_w_lock(CRYPTO_LOCK_SSL_CTX);
-	i=CHECKED_LHASH_OF(SSL_SESSION, tp.cache)->down_load;
-	CHECKED_LHASH_OF(SSL_SESSION, tp.cache)->down_load=0;
-	lh_SSL_SESSION_doall_arg(tp.cache, LHASH_DOALL_ARG_FN(timeout),
-				 TIMEOUT_PARAM, &tp);
-	CHECKED_LHASH_OF(SSL_SESSION, tp.cache)->down_load=i;
-	CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CTX);
+	unsigned int i;
+
+	if (s->sess_shards == NULL) return;
+	for (i=0; i<s->sess_nshards; i++)
+		{
+		sess_shard_lock(&s->sess_shards[i]);
+		sess_shard_timeout(s,&s->sess_shards[i],t);
+		sess_shard_unlock(&s->sess_shards[i]);
+		}
 	}
 
 int ssl_clear_bad_session(SSL *s)
@@ -1018,30 +1205,30 @@ int ssl_clear_bad_session(SSL *s)
 		return(0);
 	}
 
-/* locked by SSL_CTX in the calling function */
-static void SSL_SESSION_list_remove(SSL_CTX *ctx, SSL_SESSION *s)
+/* locked by the shard in the calling function */
+static void SSL_SESSION_list_remove(SSL_SESS_SHARD *sh, SSL_SESSION *s)
 	{
 	if ((s->next == NULL) || (s->prev == NULL)) return;
 
-	if (s->next == (SSL_SESSION *)&(ctx->session_cache_tail))
+	if (s->next == (SSL_SESSION *)&(sh->tail))
 		{ /* last element in list */
-		if (s->prev == (SSL_SESSION *)&(ctx->session_cache_head))
+		if (s->prev == (SSL_SESSION *)&(sh->head))
 			{ /* only one element in list */
-			ctx->session_cache_head=NULL;
-			ctx->session_cache_tail=NULL;
+			sh->head=NULL;
+			sh->tail=NULL;
 			}
 		else
 			{
-			ctx->session_cache_tail=s->prev;
-			s->prev->next=(SSL_SESSION *)&(ctx->session_cache_tail);
+			sh->tail=s->prev;
+			s->prev->next=(SSL_SESSION *)&(sh->tail);
 			}
 		}
 	else
 		{
-		if (s->prev == (SSL_SESSION *)&(ctx->session_cache_head))
+		if (s->prev == (SSL_SESSION *)&(sh->head))
 			{ /* first element in list */
-			ctx->session_cache_head=s->next;
-			s->next->prev=(SSL_SESSION *)&(ctx->session_cache_head);
+			sh->head=s->next;
+			s->next->prev=(SSL_SESSION *)&(sh->head);
 			}
 		else
 			{ /* middle of list */
@@ -1052,25 +1239,65 @@ static void SSL_SESSION_list_remove(SSL_CTX *ctx, SSL_SESSION *s)
 	s->prev=s->next=NULL;
 	}
 
-static void SSL_SESSION_list_add(SSL_CTX *ctx, SSL_SESSION *s)
+static void SSL_SESSION_list_add(SSL_SESS_SHARD *sh, SSL_SESSION *s)
 	{
 	if ((s->next != NULL) && (s->prev != NULL))
-		SSL_SESSION_list_remove(ctx,s);
+		SSL_SESSION_list_remove(sh,s);
 
-	if (ctx->session_cache_head == NULL)
+	if (sh->head == NULL)
 		{
-		ctx->session_cache_head=s;
-		ctx->session_cache_tail=s;
-		s->prev=(SSL_SESSION *)&(ctx->session_cache_head);
-		s->next=(SSL_SESSION *)&(ctx->session_cache_tail);
+		sh->head=s;
+		sh->tail=s;
+		s->prev=(SSL_SESSION *)&(sh->head);
+		s->next=(SSL_SESSION *)&(sh->tail);
 		}
 	else
 		{
-		s->next=ctx->session_cache_head;
+		s->next=sh->head;
 		s->next->prev=s;
-		s->prev=(SSL_SESSION *)&(ctx->session_cache_head);
-		ctx->session_cache_head=s;
+		s->prev=(SSL_SESSION *)&(sh->head);
+		sh->head=s;
+		}
+	}
+
+/* Sessions mostly come with the same timeout as the last ones, so the
+ * place of a new one is looked for from the end. Locked by the caller. */
+static void sess_expiry_add(SSL_SESS_SHARD *sh, SSL_SESSION *s)
+	{
+	SSL_SESSION *p;
+
+	s->expires=s->time+s->timeout;
+	for (p=sh->exp_tail; p != NULL && p->expires > s->expires;
+		p=p->exp_prev)
+		;
+	s->exp_prev=p;
+	if (p != NULL)
+		{
+		s->exp_next=p->exp_next;
+		p->exp_next=s;
 		}
+	else
+		{
+		s->exp_next=sh->exp_head;
+		sh->exp_head=s;
+		}
+	if (s->exp_next != NULL)
+		s->exp_next->exp_prev=s;
+	else
+		sh->exp_tail=s;
+	}
+
+static void sess_expiry_remove(SSL_SESS_SHARD *sh, SSL_SESSION *s)
+	{
+	if (s->exp_prev != NULL)
+		s->exp_prev->exp_next=s->exp_next;
+	else
+		sh->exp_head=s->exp_next;
+	if (s->exp_next != NULL)
+		s->exp_next->exp_prev=s->exp_prev;
+	else
+		sh->exp_tail=s->exp_prev;
+	s->exp_prev=s->exp_next=NULL;
 	}
 
 void SSL_CTX_sess_set_new_cb(SSL_CTX *ctx,
@@ -316,6 +316,23 @@ static int tls1_generate_key_block(SSL *s, unsigned char *km,
 	return ret;
 	}
 
+/* Precompute the HMAC pads of a record MAC key under the pending cipher
+ * suite. Returns |key|, or NULL (and marks |key| unused) if tls1_mac() has
+ * to go through EVP for this suite. DTLS is left out as it swaps write_hash
+ * behind our back to retransmit under an old epoch. */
+const HMAC_PRECOMP *tls1_precompute_mac(SSL *s, HMAC_PRECOMP *key,
+	const unsigned char *secret, int len)
+	{
+	const EVP_MD *m = s->s3->tmp.new_hash;
+
+	if (m != NULL && !SSL_IS_DTLS(s) &&
+	    s->s3->tmp.new_mac_pkey_type == EVP_PKEY_HMAC &&
+	    HMAC_precompute(key, secret, len, m))
+		return key;
+	key->type = NID_undef;
+	return NULL;
+	}
+
 int tls1_change_cipher_state(SSL *s, int which)
 	{
 	static const unsigned char empty[]="";
@@ -339,7 +356,10 @@ int tls1_change_cipher_state(SSL *s, int which)
 	EVP_PKEY *mac_key;
 	int is_export,n,i,j,k,exp_label_len,cl;
 	int reuse_dd = 0;
+	CRYPTO_MEM_ARENA *arena;
 
+	/* the cipher state outlives the handshake */
+	arena=ssl_arena_leave(s);
 	is_export=SSL_C_IS_EXPORT(s->s3->tmp.new_cipher);
 	c=s->s3->tmp.new_sym_enc;
 	m=s->s3->tmp.new_hash;
@@ -502,6 +522,12 @@ int tls1_change_cipher_state(SSL *s, int which)
 		EVP_DigestSignInit(mac_ctx,NULL,m,NULL,mac_key);
 		EVP_PKEY_free(mac_key);
 		}
+	if (which & SSL3_CC_READ)
+		s->read_hmac = tls1_precompute_mac(s, &s->s3->read_hmac_key,
+			mac_secret, *mac_secret_size);
+	else
+		s->write_hmac = tls1_precompute_mac(s, &s->s3->write_hmac_key,
+			mac_secret, *mac_secret_size);
 #ifdef TLS_DEBUG
 printf("which = %04X\nmac key=",which);
 { int z; for (z=0; z<i; z++) printf("%02X%c",ms[z],((z+1)%16)?' ':'\n'); }
@@ -573,10 +599,12 @@ printf("\n");
 	OPENSSL_cleanse(tmp2,sizeof(tmp1));
 	OPENSSL_cleanse(iv1,sizeof(iv1));
 	OPENSSL_cleanse(iv2,sizeof(iv2));
+	ssl_arena_enter(s,arena);
 	return(1);
 err:
 	SSLerr(SSL_F_TLS1_CHANGE_CIPHER_STATE,ERR_R_MALLOC_FAILURE);
 err2:
+	ssl_arena_enter(s,arena);
 	return(0);
 	}
 
@@ -964,6 +992,7 @@ int tls1_mac(SSL *ssl, unsigned char *md, int send)
 	SSL3_RECORD *rec;
 	unsigned char *seq;
 	EVP_MD_CTX *hash;
+	const HMAC_PRECOMP *key;
 	size_t md_size, orig_len;
 	int i;
 	EVP_MD_CTX hmac, *mac_ctx;
@@ -976,30 +1005,20 @@ int tls1_mac(SSL *ssl, unsigned char *md, int send)
 		rec= &(ssl->s3->wrec);
 		seq= &(ssl->s3->write_sequence[0]);
 		hash=ssl->write_hash;
+		key=ssl->write_hmac;
 		}
 	else
 		{
 		rec= &(ssl->s3->rrec);
 		seq= &(ssl->s3->read_sequence[0]);
 		hash=ssl->read_hash;
+		key=ssl->read_hmac;
 		}
 
 	t=EVP_MD_CTX_size(hash);
 	OPENSSL_assert(t >= 0);
 	md_size=t;
 
-	/* I should fix this up TLS TLS TLS TLS TLS XXXXXXXX */
-	if (stream_mac) 
-		{
-			mac_ctx = hash;
-		}
-		else
-		{
-			if (!EVP_MD_CTX_copy(&hmac,hash))
-				return -1;
-			mac_ctx = &hmac;
-		}
-
 	if (ssl->version == DTLS1_VERSION || ssl->version == DTLS1_BAD_VER)
 		{
 		unsigned char dtlsseq[8],*p=dtlsseq;
@@ -1024,14 +1043,15 @@ int tls1_mac(SSL *ssl, unsigned char *md, int send)
 
 	if (!send &&
 	    EVP_CIPHER_CTX_mode(ssl->enc_read_ctx) == EVP_CIPH_CBC_MODE &&
-	    ssl3_cbc_record_digest_supported(mac_ctx))
+	    ssl3_cbc_record_digest_supported(hash))
 		{
 		/* This is a CBC-encrypted record. We must avoid leaking any
 		 * timing-side channel information about how many blocks of
 		 * data we are hashing because that gives an attacker a
-		 * timing-oracle. */
+		 * timing-oracle. Only the digest type is taken from |hash|,
+		 * so it needs no copy. */
 		ssl3_cbc_digest_record(
-			mac_ctx,
+			hash,
 			md, &md_size,
 			header, rec->input,
 			rec->length + md_size, orig_len,
@@ -1039,8 +1059,26 @@ int tls1_mac(SSL *ssl, unsigned char *md, int send)
 			ssl->s3->read_mac_secret_size,
 			0 /* not SSLv3 */);
 		}
+	else if (key != NULL && !stream_mac)
+		{
+		HMAC_PRECOMP_CTX hctx;
+
+		HMAC_precomp_Init(&hctx,key);
+		HMAC_precomp_Update(&hctx,header,sizeof(header));
+		HMAC_precomp_Update(&hctx,rec->input,rec->length);
+		HMAC_precomp_Final(&hctx,md);
+		}
 	else
 		{
+		/* I should fix this up TLS TLS TLS TLS TLS XXXXXXXX */
+		if (stream_mac)
+			mac_ctx = hash;
+		else
+			{
+			if (!EVP_MD_CTX_copy(&hmac,hash))
+				return -1;
+			mac_ctx = &hmac;
+			}
 		EVP_DigestSignUpdate(mac_ctx,header,sizeof(header));
 		EVP_DigestSignUpdate(mac_ctx,rec->input,rec->length);
 		t=EVP_DigestSignFinal(mac_ctx,md,&md_size);
@@ -1052,10 +1090,9 @@ int tls1_mac(SSL *ssl, unsigned char *md, int send)
 					mac_ctx, rec->input,
 					rec->length, orig_len);
 #endif
+		if (!stream_mac)
+			EVP_MD_CTX_cleanup(&hmac);
 		}
-		
-	if (!stream_mac)
-		EVP_MD_CTX_cleanup(&hmac);
 #ifdef TLS_DEBUG
 printf("seq=");
 {int z; for (z=0; z<8; z++) printf("%02X ",seq[z]); printf("\n"); }
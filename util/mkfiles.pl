@@ -16,6 +16,9 @@ my @dirs = (
 "crypto/mdc2",
 "crypto/hmac",
 "crypto/cmac",
+"crypto/chacha",
+"crypto/poly1305",
+"crypto/threads",
 "crypto/ripemd",
 "crypto/des",
 "crypto/rc2",